@@ -1,7 +1,10 @@
 LOCAL_PATH := $(call my-dir)
 
 include $(CLEAR_VARS)
-include /Applications/eclipse/OpenCV-android-sdk/sdk/native/jni/OpenCV.mk
+# location of the OpenCV Android SDK, override with ndk-build OPENCV_ANDROID_SDK=<path>
+OPENCV_ANDROID_SDK ?= /Applications/eclipse/OpenCV-android-sdk
+
+include $(OPENCV_ANDROID_SDK)/sdk/native/jni/OpenCV.mk
 
 LOCAL_MODULE    := \
 	NativeProcessingComponent
@@ -12,18 +15,71 @@ LOCAL_SRC_FILES := \
 	AuxiliaryClasses/Box.hpp \
 	AuxiliaryClasses/Storage.hpp \
 	AuxiliaryClasses/TypeValidator.hpp \
+	AuxiliaryClasses/ThreadPool.hpp \
+	AuxiliaryClasses/TaskGraph.hpp \
+	AuxiliaryClasses/Trace.hpp \
+	AuxiliaryClasses/PerfCounters.hpp \
+	AuxiliaryClasses/AllocationTracker.hpp \
+	AuxiliaryClasses/AtomicSnapshot.hpp \
+	AuxiliaryClasses/ModelImage.hpp \
+	AuxiliaryClasses/PlacementIndex.hpp \
+	AuxiliaryClasses/BoardTable.hpp \
+	AuxiliaryClasses/Model.hpp \
+	AuxiliaryClasses/ModelCache.hpp \
+	AuxiliaryClasses/FrameResult.hpp \
+	AuxiliaryClasses/WorkOrder.hpp \
+	AuxiliaryClasses/Recording.hpp \
+	AuxiliaryClasses/LatencyMonitor.hpp \
+	AuxiliaryClasses/QualityController.hpp \
+	AuxiliaryClasses/WhiteBalance.hpp \
+	AuxiliaryClasses/RegionStatistics.hpp \
+	AuxiliaryClasses/CameraModel.hpp \
+	AuxiliaryClasses/Session.hpp \
+	Boards/BoardTables.hpp \
 	Functions/ProcessingFunctions.hpp \
 	Functions/FileReadingFunctions.hpp \
 	Functions/GeometryFunctions.hpp \
+	Functions/MarkerFunctions.hpp \
+	Functions/CodeFunctions.hpp \
+	Functions/KernelFunctions.hpp \
 	JNI_Functions/JNI_Functions.hpp \
 	Functions/ProcessingFunctions.cpp \
 	JNI_Functions/ColorCorrection.cpp \
 	JNI_Functions/Detection.cpp \
 	JNI_Functions/ColorMeasurement.cpp \
-	Functions/GeometryFunctions.cpp 
-	
+	JNI_Functions/SessionHandling.cpp \
+	JNI_Functions/ModelCaching.cpp \
+	JNI_Functions/Tracing.cpp \
+	JNI_Functions/Recording.cpp \
+	JNI_Functions/CodeScanning.cpp \
+	Functions/AllocationHooks.cpp \
+	Functions/GeometryFunctions.cpp \
+	Functions/MarkerFunctions.cpp \
+	Functions/CodeFunctions.cpp \
+	Functions/KernelFunctions.cpp \
+	Functions/KernelFunctionsSSE41.cpp \
+	Functions/KernelFunctionsAVX2.cpp
+
+# the kernels are selected at runtime, NEON is optional on armeabi-v7a, so only its file is built with NEON by the .neon suffix
+ifeq ($(TARGET_ARCH_ABI),armeabi-v7a)
+LOCAL_SRC_FILES += Functions/KernelFunctionsNEON.cpp.neon
+else
+LOCAL_SRC_FILES += Functions/KernelFunctionsNEON.cpp
+endif
+
+# stage timing and hardware counters, recorded only while enabled at runtime via NativeHandler.setTracing() and NativeHandler.setPerfCounters()
+# add -DBA_ALLOC to replace the global operator new and delete for the allocation accounting of NativeHandler.setAllocationTracking()
+LOCAL_CPPFLAGS += \
+	-DBA_TRACE \
+	-DBA_PERF
+
 LOCAL_LDLIBS += \
 	-llog \
 	-ldl
+
+# the NEON support of armeabi-v7a devices is read by android_getCpuFeatures()
+LOCAL_STATIC_LIBRARIES += cpufeatures
 	
 include $(BUILD_SHARED_LIBRARY)
+
+$(call import-module,android/cpufeatures)
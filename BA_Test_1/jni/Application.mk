@@ -1,4 +1,4 @@
 APP_STL := gnustl_static 
 APP_CPPFLAGS := -frtti -fexceptions -std=c++11
-APP_ABI := armeabi-v7a
-APP_Platform := android-8
\ No newline at end of file
+APP_ABI := armeabi-v7a arm64-v8a x86 x86_64
+APP_Platform := android-8
\ No newline at end of file
@@ -0,0 +1,483 @@
+#ifndef AUXILIARYCLASSES_ALLOCATIONTRACKER_HPP_
+#define AUXILIARYCLASSES_ALLOCATIONTRACKER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <opencv2/core/core.hpp>
+
+/**
+	ALLOCATION_SCOPE(name) counts the allocations of the calling thread until the end of the enclosing block,
+	ALLOCATION_FRAME_SCOPE(name) counts the allocations of all threads until the end of the enclosing block and
+	ALLOCATION_TRACK(mat) makes the buffers of a cv::Mat counted if the software is built with BA_ALLOC, all expand to nothing otherwise
+*/
+#ifdef BA_ALLOC
+#define ALLOCATION_SCOPE_CONCAT_(a, b) a ## b
+#define ALLOCATION_SCOPE_CONCAT(a, b) ALLOCATION_SCOPE_CONCAT_(a, b)
+#define ALLOCATION_SCOPE(name) aux::AllocationScope ALLOCATION_SCOPE_CONCAT(allocationScope, __LINE__)(name, false)
+#define ALLOCATION_FRAME_SCOPE(name) aux::AllocationScope ALLOCATION_SCOPE_CONCAT(allocationScope, __LINE__)(name, true)
+#define ALLOCATION_TRACK(mat) aux::AllocationTracker::track(mat)
+#else
+#define ALLOCATION_SCOPE(name)
+#define ALLOCATION_FRAME_SCOPE(name)
+#define ALLOCATION_TRACK(mat)
+#endif
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class AllocationTracker
+		\brief AllocationTracker class serving as the accounting of heap allocations per frame and per stage
+
+		Usage: This class serves as the counter of all allocations of the native processing, it is opt-in via BA_ALLOC!
+		The global operator new and delete of Functions/AllocationHooks.cpp and the cv::MatAllocator attached by track() report every
+		allocation and deallocation with its usable size to a thread local and a process wide counter. A scope of a stage reads the counters
+		of its thread, a scope of a frame the process wide ones, which include concurrently processed frames of other sessions.
+		Each stage keeps the number of runs, the allocations and bytes summed up and of the worst run and the highest peak of live bytes,
+		so a test can fail once a stage exceeds its allocation budget.
+
+		@see Counters
+		@see Stage
+		@see aux::AllocationScope
+		@see exceeds()
+	*/
+	class AllocationTracker
+	{
+		public:
+
+			/**
+				\struct Counters
+				\brief the number of allocations and allocated bytes so far together with the live bytes and their peak
+			*/
+			struct Counters
+			{
+				std::uint64_t count;
+				std::uint64_t bytes;
+				std::int64_t live;
+				std::int64_t peak;
+			};
+
+		private:
+
+			/**
+				\struct Stage
+				\brief the allocations of all runs of a stage
+			*/
+			struct Stage
+			{
+				std::uint64_t runs;
+				std::uint64_t count;
+				std::uint64_t bytes;
+				std::uint64_t maxCount;
+				std::uint64_t maxBytes;
+				std::int64_t peak;
+			};
+
+			/**
+				\class MatAllocator
+				\brief a cv::MatAllocator allocating like the default allocator of OpenCV 2.4 and reporting the buffers
+
+				The reference counter follows the data aligned to its size like in OpenCV, as CV_XADD faults on an unaligned counter on ARM.
+				Both functions account the aligned size, which deallocate() derives from the position of the counter
+			*/
+			class MatAllocator : public cv::MatAllocator
+			{
+				public:
+
+					void allocate(int dims, int const * sizes, int type, int *& refcount, uchar *& datastart, uchar *& data, std::size_t * step)
+					{
+						std::size_t total = CV_ELEM_SIZE(type);
+
+						for(int i = dims - 1; i >= 0; i--)
+						{
+							if(step) step[i] = total;
+
+							total *= sizes[i];
+						}
+
+						total = cv::alignSize(total, (int) sizeof(*refcount));
+
+						uchar * buffer = (uchar *) cv::fastMalloc(total + sizeof(*refcount));
+
+						datastart = data = buffer;
+						refcount = (int *) (buffer + total);
+						*refcount = 1;
+
+						AllocationTracker::allocated(total + sizeof(*refcount));
+					}
+
+					void deallocate(int * refcount, uchar * datastart, uchar * data)
+					{
+						if(datastart == nullptr) return;
+
+						AllocationTracker::freed((uchar *) refcount - datastart + sizeof(*refcount));
+
+						cv::fastFree(datastart);
+					}
+			};
+
+			/**
+				a std::map containing the stages by name guarded by d_mutex
+			*/
+			std::map<std::string, Stage> d_stages;
+
+			/**
+				a std::mutex guarding the stages
+			*/
+			mutable std::mutex d_mutex;
+
+			/**
+				a std::atomic bool containing whether scopes are recorded (true) or not (false)
+			*/
+			std::atomic<bool> d_enabled;
+
+			/**
+				default constructor
+			*/
+			AllocationTracker() : d_enabled(false) {}
+
+			/**
+				\brief private static inline function
+
+				@return a pointer to the std::atomic counters of all threads in the order count, bytes, live and peak
+			*/
+			static std::atomic<std::int64_t> inline * global()
+			{
+				static std::atomic<std::int64_t> counters[4] = { {0}, {0}, {0}, {0} };
+
+				return counters;
+			}
+
+			/**
+				\brief private static inline function
+
+				@return a reference to a bool containing whether the calling thread is updating the stages, its allocations and deallocations are not counted meanwhile
+			*/
+			static bool inline & suspended()
+			{
+				static thread_local bool value = false;
+
+				return value;
+			}
+
+		public:
+
+			AllocationTracker(AllocationTracker const &) = delete;
+			AllocationTracker & operator=(AllocationTracker const &) = delete;
+
+			/**
+				\brief public static inline function
+
+				@return a reference to the process wide aux::AllocationTracker object
+			*/
+			static AllocationTracker inline & shared()
+			{
+				static AllocationTracker tracker;
+
+				return tracker;
+			}
+
+			/**
+				\brief public static inline function
+
+				@return a reference to the Counters of the calling thread, a trivial thread local which never allocates
+			*/
+			static Counters inline & local()
+			{
+				static thread_local Counters counters = { 0, 0, 0, 0 };
+
+				return counters;
+			}
+
+			/**
+				\brief public static inline function
+
+				@return the Counters of all threads
+			*/
+			static Counters inline process()
+			{
+				std::atomic<std::int64_t> * g = AllocationTracker::global();
+				Counters c = { (std::uint64_t) g[0].load(std::memory_order_relaxed), (std::uint64_t) g[1].load(std::memory_order_relaxed), g[2].load(std::memory_order_relaxed), g[3].load(std::memory_order_relaxed) };
+
+				return c;
+			}
+
+			/**
+				\brief public static inline function
+
+				@param bytes a std::size_t containing the usable size of the allocated block
+
+				Called by the allocation hooks, must not allocate
+			*/
+			static void inline allocated(std::size_t const bytes)
+			{
+				if(AllocationTracker::suspended()) return;
+
+				Counters & c = AllocationTracker::local();
+
+				c.count++;
+				c.bytes += bytes;
+				c.live += bytes;
+				c.peak = std::max(c.peak, c.live);
+
+				std::atomic<std::int64_t> * g = AllocationTracker::global();
+
+				g[0].fetch_add(1, std::memory_order_relaxed);
+				g[1].fetch_add(bytes, std::memory_order_relaxed);
+
+				std::int64_t const live = g[2].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+				std::int64_t peak = g[3].load(std::memory_order_relaxed);
+
+				while(live > peak && !g[3].compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+			}
+
+			/**
+				\brief public static inline function
+
+				@param bytes a std::size_t containing the usable size of the freed block
+
+				Called by the deallocation hooks, must not allocate
+			*/
+			static void inline freed(std::size_t const bytes)
+			{
+				if(AllocationTracker::suspended()) return;
+
+				AllocationTracker::local().live -= bytes;
+				AllocationTracker::global()[2].fetch_sub(bytes, std::memory_order_relaxed);
+			}
+
+			/**
+				\brief public static inline function
+
+				@param live a std::int64_t containing the live bytes the peak of all threads is reset to
+
+				@return a std::int64_t containing the peak of all threads before the reset
+			*/
+			static std::int64_t inline resetPeak(std::int64_t const live)
+			{
+				return AllocationTracker::global()[3].exchange(live, std::memory_order_relaxed);
+			}
+
+			/**
+				\brief public static inline function
+
+				@param mat a reference to a cv::Mat whose buffers are counted from its next allocation on
+
+				@see MatAllocator
+			*/
+			static void inline track(cv::Mat & mat)
+			{
+				static MatAllocator allocator;
+
+				mat.allocator = &allocator;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param enabled a bool containing whether scopes are recorded from now on (true) or not (false)
+			*/
+			void inline enable(bool const enabled)
+			{
+				this->d_enabled.store(enabled, std::memory_order_relaxed);
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_enabled
+				@return true if scopes are recorded, false otherwise
+			*/
+			bool inline enabled() const
+			{
+				return this->d_enabled.load(std::memory_order_relaxed);
+			}
+
+			/**
+				\brief public member inline function
+
+				Discards all recorded stages
+			*/
+			void inline clear()
+			{
+				AllocationTracker::suspended() = true;
+
+				{
+					std::lock_guard<std::mutex> lock(this->d_mutex);
+					this->d_stages.clear();
+				}
+
+				AllocationTracker::suspended() = false;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param name a constant char pointer to the name of the stage
+				@param count a std::uint64_t containing the number of allocations of the run
+				@param bytes a std::uint64_t containing the number of allocated bytes of the run
+				@param peak a std::int64_t containing the peak of live bytes above the live bytes at the begin of the run
+
+				Adds the run to the stage, the allocations of the bookkeeping itself are not counted
+			*/
+			void inline record(char const * name, std::uint64_t const count, std::uint64_t const bytes, std::int64_t const peak)
+			{
+				AllocationTracker::suspended() = true;
+
+				{
+					std::lock_guard<std::mutex> lock(this->d_mutex);
+
+					Stage & stage = this->d_stages[name];
+
+					stage.runs++;
+					stage.count += count;
+					stage.bytes += bytes;
+					stage.maxCount = std::max(stage.maxCount, count);
+					stage.maxBytes = std::max(stage.maxBytes, bytes);
+					stage.peak = std::max(stage.peak, peak);
+				}
+
+				AllocationTracker::suspended() = false;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param name a constant reference to a std::string containing the name of the stage
+				@param maxCount a std::uint64_t containing the maximum number of allocations of a single run
+				@param maxBytes a std::uint64_t containing the maximum number of allocated bytes of a single run
+
+				@return true if the worst run of the stage exceeds one of the budgets, false otherwise or if the stage never ran
+			*/
+			bool inline exceeds(std::string const & name, std::uint64_t const maxCount, std::uint64_t const maxBytes) const
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				std::map<std::string, Stage>::const_iterator it = this->d_stages.find(name);
+
+				return it != this->d_stages.end() && (it->second.maxCount > maxCount || it->second.maxBytes > maxBytes);
+			}
+
+			/**
+				\brief public member inline function
+
+				@return a std::string containing a JSON object with the runs, the mean and maximum allocations and bytes per run and the peak of live bytes of each stage
+			*/
+			std::string inline summary() const
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+				std::ostringstream out;
+
+				out.precision(1);
+				out << std::fixed << "{";
+
+				for(std::map<std::string, Stage>::const_iterator it = this->d_stages.begin(); it != this->d_stages.end(); ++it)
+				{
+					Stage const & s = it->second;
+
+					out << (it == this->d_stages.begin() ? "\n" : ",\n") << "\"" << it->first << "\":{\"runs\":" << s.runs
+						<< ",\"allocations\":" << (double) s.count / s.runs << ",\"maxAllocations\":" << s.maxCount
+						<< ",\"bytes\":" << (double) s.bytes / s.runs << ",\"maxBytes\":" << s.maxBytes
+						<< ",\"peakBytes\":" << s.peak << "}";
+				}
+
+				out << "\n}";
+
+				return out.str();
+			}
+	};
+
+	/**
+		\class AllocationScope
+		\brief AllocationScope class serving as the scoped allocation accounting of a stage or a frame
+
+		Usage: This class serves as the measurement of a block, use it through ALLOCATION_SCOPE(name) or ALLOCATION_FRAME_SCOPE(name)!
+		Nothing is recorded if recording is disabled when the block is entered.
+
+		@see aux::AllocationTracker::record()
+	*/
+	class AllocationScope
+	{
+		private:
+
+			/**
+				a constant char pointer to the name of the stage, nullptr if nothing is recorded
+			*/
+			char const * d_name;
+
+			/**
+				a bool containing whether the allocations of all threads (true) or of the calling thread (false) are counted
+			*/
+			bool d_frame;
+
+			/**
+				the Counters when the block was entered, peak contains the peak of the enclosing scope
+			*/
+			AllocationTracker::Counters d_begin;
+
+			/**
+				\brief private member inline function
+
+				@return the current Counters of the thread or of all threads
+			*/
+			AllocationTracker::Counters inline counters() const
+			{
+				return this->d_frame ? AllocationTracker::process() : AllocationTracker::local();
+			}
+
+		public:
+
+			/**
+				explicit constructor
+
+				@param name a constant char pointer to the name of the stage
+				@param frame a bool containing whether the allocations of all threads (true) or of the calling thread (false) are counted
+			*/
+			explicit AllocationScope(char const * name, bool const frame)
+				:
+					d_name(AllocationTracker::shared().enabled() ? name : nullptr),
+					d_frame(frame)
+			{
+				if(this->d_name == nullptr) return;
+
+				this->d_begin = this->counters();
+
+				if(this->d_frame)
+					this->d_begin.peak = AllocationTracker::resetPeak(this->d_begin.live);
+				else
+					AllocationTracker::local().peak = this->d_begin.live;
+			}
+
+			/**
+				default destructor
+
+				Records the allocations of the block and restores the peak of the enclosing scope
+			*/
+			~AllocationScope()
+			{
+				if(this->d_name == nullptr) return;
+
+				AllocationTracker::Counters end = this->counters();
+
+				AllocationTracker::shared().record(this->d_name, end.count - this->d_begin.count, end.bytes - this->d_begin.bytes, end.peak - this->d_begin.live);
+
+				if(this->d_frame)
+					AllocationTracker::resetPeak(std::max(end.peak, this->d_begin.peak));
+				else
+					AllocationTracker::local().peak = std::max(end.peak, this->d_begin.peak);
+			}
+
+			AllocationScope(AllocationScope const &) = delete;
+			AllocationScope & operator=(AllocationScope const &) = delete;
+	};
+}
+
+#endif /* AUXILIARYCLASSES_ALLOCATIONTRACKER_HPP_ */
@@ -0,0 +1,174 @@
+#ifndef AUXILIARYCLASSES_ATOMICSNAPSHOT_HPP_
+#define AUXILIARYCLASSES_ATOMICSNAPSHOT_HPP_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class AtomicSnapshot
+		\brief AtomicSnapshot class serving as a read-copy-update cell for immutable, reference counted objects
+
+		@tparam T the type of the immutable object
+
+		Usage: This class serves as the publication point of immutable snapshots!
+		A writer publishes a new snapshot with an atomic pointer swap while a reader keeps using the snapshot it has acquired.
+		The reader side is lock free: acquire() announces the snapshot in a hazard pointer and confirms it is still current.
+		Replaced snapshots are kept alive by the writer until the reader no longer announces them.
+		There is one hazard pointer, so a single thread acquires at a time. Writers are serialized by a mutex and never block the reader.
+
+		@see d_current
+		@see d_hazard
+		@see d_owned
+	*/
+	template <typename T>
+	class AtomicSnapshot
+	{
+		private:
+
+			/**
+				a std::atomic pointer to the currently published snapshot
+			*/
+			std::atomic<T const *> d_current;
+
+			/**
+				a std::atomic pointer to the snapshot in use by the reader, nullptr if the reader uses none
+			*/
+			std::atomic<T const *> d_hazard;
+
+			/**
+				a std::vector containing the owning references to the current and all replaced snapshots which may still be in use
+			*/
+			std::vector<std::shared_ptr<T const>> d_owned;
+
+			/**
+				a std::mutex serializing the writers
+			*/
+			std::mutex d_writeMutex;
+
+			/**
+				\brief private member inline function
+
+				Drops the owning references to all replaced snapshots the reader does not announce and any empty one. Has to be called with d_writeMutex held
+			*/
+			void inline reclaim()
+			{
+				T const * current = this->d_current.load();
+				T const * hazard = this->d_hazard.load();
+
+				typename std::vector<std::shared_ptr<T const>>::iterator it = this->d_owned.begin();
+
+				while(it != this->d_owned.end())
+				{
+					if(!*it || (it->get() != current && it->get() != hazard))
+						it = this->d_owned.erase(it);
+					else
+						++it;
+				}
+			}
+
+		public:
+
+			/**
+				default constructor
+
+				Starts without a published snapshot
+			*/
+			AtomicSnapshot() : d_current(nullptr), d_hazard(nullptr) {}
+
+			/**
+				default destructor
+			*/
+			~AtomicSnapshot() {}
+
+			AtomicSnapshot(AtomicSnapshot const &) = delete;
+			AtomicSnapshot & operator=(AtomicSnapshot const &) = delete;
+
+			/**
+				\brief public member inline function
+
+				@param snapshot a std::shared_ptr to the immutable object to be published
+
+				Publishes the snapshot. The reader picks it up with its next acquire(), an empty one clears the cell
+			*/
+			void inline publish(std::shared_ptr<T const> const & snapshot)
+			{
+				std::lock_guard<std::mutex> lock(this->d_writeMutex);
+
+				if(snapshot) this->d_owned.push_back(snapshot);
+				this->d_current.store(snapshot.get());
+
+				this->reclaim();
+			}
+
+			/**
+				\brief public member inline function
+
+				Withdraws the current snapshot without publishing a new one. The reader gets nullptr with its next acquire()
+			*/
+			void inline clear()
+			{
+				std::lock_guard<std::mutex> lock(this->d_writeMutex);
+
+				this->d_current.store(nullptr);
+
+				this->reclaim();
+			}
+
+			/**
+				\brief public member inline function
+
+				@return a std::shared_ptr to the currently published snapshot, empty if nothing was published
+			*/
+			std::shared_ptr<T const> inline current()
+			{
+				std::lock_guard<std::mutex> lock(this->d_writeMutex);
+
+				T const * current = this->d_current.load();
+
+				for(typename std::vector<std::shared_ptr<T const>>::iterator it = this->d_owned.begin(); it != this->d_owned.end(); ++it)
+					if(it->get() == current) return *it;
+
+				return std::shared_ptr<T const>();
+			}
+
+			/**
+				\brief public member inline function
+
+				Announces and returns the current snapshot. It stays valid until the next acquire() or release() of the reader
+
+				@return a constant pointer to the current snapshot, nullptr if nothing was published
+			*/
+			T const inline * acquire()
+			{
+				T const * snapshot;
+
+				do
+				{
+					snapshot = this->d_current.load();
+					this->d_hazard.store(snapshot);
+				}
+				while(snapshot != this->d_current.load());
+
+				return snapshot;
+			}
+
+			/**
+				\brief public member inline function
+
+				Withdraws the announcement of the reader so the writer may free the snapshot
+			*/
+			void inline release()
+			{
+				this->d_hazard.store(nullptr);
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_ATOMICSNAPSHOT_HPP_ */
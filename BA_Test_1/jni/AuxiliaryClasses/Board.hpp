@@ -1,10 +1,13 @@
 #ifndef BOARD_HPP_
 #define BOARD_HPP_
 
+#include <utility>
 #include "Component.hpp"
 #include <opencv2/opencv.hpp>
 #include "TypeValidator.hpp"
+#ifdef __ANDROID__
 #include "android/log.h"
+#endif
 
 /** \namespace
 	part of the namespace aux which supports the software with datastructures
@@ -29,6 +32,7 @@ namespace aux
 	@see d_boardDimensions
 	@see d_rotated
 	@see d_distRefToCorners
+	@see d_markers
 */
 	template <typename T>
 	class Board
@@ -79,6 +83,11 @@ namespace aux
 			*/
 			cv::Mat d_distRefToCorners;
 
+			/**
+				a bool variable containing whether the board and its storage are referenced by binary fiducial markers (true) or by colored stickers (false)
+			*/
+			bool d_markers;
+
 		public:
 
 			/**
@@ -93,6 +102,7 @@ namespace aux
 				@param bd a std::vector containing the board dimensions
 				@param r a bool containing the coordinate system rotation
 				@param m a cv::Mat containing the the geometric vectors of the reference stickers to the board corners
+				@param mk a bool containing whether the reference stickers are binary fiducial markers
 
 				Fills the private data members with their respective data.
 				Checks if T is a primitive number data type
@@ -104,15 +114,17 @@ namespace aux
 					std::vector<T> rd,
 					std::vector<T> bd,
 					bool r,
-					cv::Mat m)
+					cv::Mat m,
+					bool mk = false)
 				:
 					d_name(n),
-					d_components(cs),
+					d_components(std::move(cs)),
 					d_originXY(o),
 					d_refDimensions(rd),
 					d_boardDimensions(bd),
 					d_rotated(r),
-					d_distRefToCorners(m)
+					d_distRefToCorners(m),
+					d_markers(mk)
 			{
 				T validator;
 				TypeValidator::validateType(validator);
@@ -121,7 +133,7 @@ namespace aux
 			/**
 				default constructor
 			*/
-			Board() {}
+			Board() : d_markers(false) {}
 
 			/**
 				default destructor
@@ -135,7 +147,7 @@ namespace aux
 				@see d_name
 				@return a std::string containing the name of the Board as constant reference
 			*/
-			std::string inline const & name()
+			std::string inline const & name() const
 			{
 				return this->d_name;
 			}
@@ -147,7 +159,7 @@ namespace aux
 				@see d_components
 				@return a std::vector of components as constant reference
 			*/
-			std::vector<Component<T>> inline const & components()
+			std::vector<Component<T>> inline const & components() const
 			{
 				return this->d_components;
 			}
@@ -159,7 +171,7 @@ namespace aux
 			 	@see d_originXY
 			 	@return a std::vector of geometric vectors to the origin as constant reference
 			*/
-			std::vector<T> inline const & originXY()
+			std::vector<T> inline const & originXY() const
 			{
 				return this->d_originXY;
 			}
@@ -171,7 +183,7 @@ namespace aux
 				@see d_refDimensions
 				@return a std::vector of the reference sticker dimensions as constant reference
 			*/
-			std::vector<T> inline const & refDimensions()
+			std::vector<T> inline const & refDimensions() const
 			{
 				return this->d_refDimensions;
 			}
@@ -183,7 +195,7 @@ namespace aux
 				@see d_boardDimensions
 				@return a std::vector of the board dimensions as constant reference
 			*/
-			std::vector<T> inline const & boardDimensions()
+			std::vector<T> inline const & boardDimensions() const
 			{
 				return this->d_boardDimensions;
 			}
@@ -195,7 +207,7 @@ namespace aux
 				@return a bool containing the value whether the real word coordinate system is rotated relative
 				to the camera coordinate system (true) or not (false)
 			*/
-			bool inline const & rotated()
+			bool inline const & rotated() const
 			{
 				return this->d_rotated;
 			}
@@ -207,10 +219,21 @@ namespace aux
 				@return a cv::Mat object containing the geometric vectors from each reference sticker
 				to its respective closest board corner
 			*/
-			cv::Mat inline const & distRefToCorners()
+			cv::Mat inline const & distRefToCorners() const
 			{
 				return this->d_distRefToCorners;
 			}
+
+			/**
+				\brief public member inline function
+
+				@see d_markers
+				@return a bool containing whether the board and its storage are referenced by binary fiducial markers (true) or by colored stickers (false)
+			*/
+			bool inline markers() const
+			{
+				return this->d_markers;
+			}
 	};
 }
 
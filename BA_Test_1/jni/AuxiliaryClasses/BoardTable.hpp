@@ -0,0 +1,69 @@
+#ifndef AUXILIARYCLASSES_BOARDTABLE_HPP_
+#define AUXILIARYCLASSES_BOARDTABLE_HPP_
+
+#include "PlacementIndex.hpp"
+#include "Constants.hpp"
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\struct BoardTable
+		\brief BoardTable struct serving as the compiled in, constant expression counterpart of a board and storage configuration
+
+		Usage: This struct serves as the description of a fixed production board which never changes!
+		BoardTables are generated from the xml configuration file by the board table generator into a header of constexpr tables
+		containing the coordinates, the precomputed placements and the grids of all components as well as the precomputed target vector factors.
+		A BoardTable is used through aux::Model like any other configuration or directly through the geo:: overloads taking a BoardTable.
+		The distance matrices are expected to be cnst::NUMBER_CORNERS x 2 like the ones read by geo::targetVectorFactors<T>().
+
+		@see Component
+		@see aux::Model
+		@see aux::PlacementIndex::GridView
+	*/
+	struct BoardTable
+	{
+		/**
+			\struct Component
+			\brief the constant counterpart of aux::Component including its placement grid, coordinates contains occurrences rows of x, y, mX and mY
+		*/
+		struct Component
+		{
+			char const * name;
+			int occurrences;
+			double width;
+			double height;
+			bool polarity;
+			int boxNum;
+			double const (* coordinates)[4];
+			PlacementIndex::GridView grid;
+		};
+
+		char const * id;
+		char const * name;
+		bool rotated;
+		bool markers;
+		double originXY[2];
+		double refDimensions[2];
+		double boardDimensions[2];
+		double boardDistRefsToCorners[cnst::NUMBER_CORNERS][2];
+
+		int storageMatrix[2];
+		double refMidDimensions[2];
+		double refCornerDimensions[2];
+		double boxOffsetXY[2];
+		double boxDimensions[2];
+		double storageDistRefsToCorners[cnst::NUMBER_CORNERS][2];
+
+		double boardTargetPointsVectors[cnst::NUMBER_CORNERS][2];
+		double storageTargetPointsVectors[cnst::NUMBER_CORNERS][2];
+
+		int componentCount;
+		Component const * components;
+		PlacementIndex::GridView const * grids;
+	};
+}
+
+#endif /* AUXILIARYCLASSES_BOARDTABLE_HPP_ */
@@ -79,7 +79,7 @@ namespace aux
 				@see d_topLeftCorner
 				@return a cv::Point object for the top left corner as constant reference
 			*/
-			cv::Point inline const & topLeftCorner()
+			cv::Point inline const & topLeftCorner() const
 			{
 				return this->d_topLeftCorner;
 			}
@@ -90,7 +90,7 @@ namespace aux
 				@see d_bottomLeftCorner
 				@return a cv::Point object for the bottom left corner as constant reference
 			*/
-			cv::Point inline const & bottomLeftCorner()
+			cv::Point inline const & bottomLeftCorner() const
 			{
 				return this->d_bottomLeftCorner;
 			}
@@ -101,7 +101,7 @@ namespace aux
 				@see d_bottomRightCorner
 				@return a cv::Point object for the bottom right corner as constant reference
 			*/
-			cv::Point inline const & bottomRightCorner()
+			cv::Point inline const & bottomRightCorner() const
 			{
 				return this->d_bottomRightCorner;
 			}
@@ -112,7 +112,7 @@ namespace aux
 				@see d_topRightCorner
 				@return a cv::Point object for the top right corner as constant reference
 			*/
-			cv::Point inline const & topRightCorner()
+			cv::Point inline const & topRightCorner() const
 			{
 				return this->d_topRightCorner;
 			}
@@ -127,7 +127,7 @@ namespace aux
 
 				@return a std::vector containing cv::Point objects representing the corner points as constant
 			*/
-			std::vector<cv::Point> inline const corners()
+			std::vector<cv::Point> inline const corners() const
 			{
 				return std::vector<cv::Point>
 				{
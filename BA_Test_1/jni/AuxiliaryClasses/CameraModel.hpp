@@ -0,0 +1,389 @@
+#ifndef AUXILIARYCLASSES_CAMERAMODEL_HPP_
+#define AUXILIARYCLASSES_CAMERAMODEL_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <opencv2/core/core.hpp>
+#include "Constants.hpp"
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class CameraModel
+		\brief CameraModel class serving as the lens model of a camera mapping points between the distorted frame and an ideal pinhole frame
+
+		Usage: This class serves as the lens correction of the overlay of one aux::Session!
+		The model holds the intrinsics and the distortion coefficients k1, k2, p1, p2 and k3 of a calibration as cv::calibrateCamera() determines them
+		and is built for the size of the frames, the intrinsics are scaled from the calibrated image size to it. Instead of undistorting the frame only the
+		detected reference points are undistorted and only the vertices of the overlay are distorted again, both by a bilinear lookup in a grid with a node
+		every cnst::CAMERA_GRID_STEP pixels which is computed once at construction. The pinhole frame is shifted so the bounding rectangle of the undistorted
+		frame starts at the origin, so the geometry and its culling work on it like on the frame itself with size() as dimensions.
+		Once built the model is immutable and shared between threads.
+
+		@see d_cameraMatrix
+		@see d_distortion
+		@see d_undistortGrid
+		@see d_distortGrid
+	*/
+	class CameraModel
+	{
+		private:
+
+			/**
+				a cv::Matx33d containing the camera matrix of the calibration
+			*/
+			cv::Matx33d d_cameraMatrix;
+
+			/**
+				a cv::Vec containing the distortion coefficients k1, k2, p1, p2 and k3 of the calibration
+			*/
+			cv::Vec<double, cnst::CAMERA_DISTORTION_COEFFICIENTS> d_distortion;
+
+			/**
+				a cv::Size object containing the dimensions of the calibrated images
+			*/
+			cv::Size d_calibrationSize;
+
+			/**
+				a cv::Size object containing the dimensions of the frames the model is built for
+			*/
+			cv::Size d_frameSize;
+
+			/**
+				a cv::Point2d object containing the focal lengths of the camera matrix scaled to the frames
+			*/
+			cv::Point2d d_focal;
+
+			/**
+				a cv::Point2d object containing the principal point of the camera matrix scaled to the frames
+			*/
+			cv::Point2d d_center;
+
+			/**
+				a cv::Point2d object containing the position of the origin of the pinhole frame in undistorted pixel coordinates
+			*/
+			cv::Point2d d_offset;
+
+			/**
+				a cv::Size object containing the dimensions of the bounding rectangle of the undistorted frame
+			*/
+			cv::Size d_size;
+
+			/**
+				a double containing the largest squared radius of the undistorted frame in normalized coordinates, the radial distortion is not extrapolated beyond it
+			*/
+			double d_maxRadiusSquared;
+
+			/**
+				a cv::Size object containing the number of columns and rows of nodes of d_undistortGrid
+			*/
+			cv::Size d_undistortNodes;
+
+			/**
+				a std::vector containing the pinhole frame position of every node of the frame, row by row
+			*/
+			std::vector<cv::Point2f> d_undistortGrid;
+
+			/**
+				a cv::Size object containing the number of columns and rows of nodes of d_distortGrid
+			*/
+			cv::Size d_distortNodes;
+
+			/**
+				a std::vector containing the frame position of every node of the pinhole frame, row by row
+			*/
+			std::vector<cv::Point2f> d_distortGrid;
+
+			/**
+				\brief private static member inline function
+
+				@param grid a constant reference to a std::vector containing the positions of the nodes
+				@param nodes a constant reference to a cv::Size object containing the number of columns and rows of nodes
+				@param point a constant reference to a cv::Point2d object containing the position to be looked up
+
+				A position outside of the grid is extrapolated from the nearest cell
+
+				@return a cv::Point2d containing the position interpolated bilinearly between the four nodes of the cell of the point
+			*/
+			static cv::Point2d inline lookup(std::vector<cv::Point2f> const & grid, cv::Size const & nodes, cv::Point2d const & point)
+			{
+				double const gx = point.x / cnst::CAMERA_GRID_STEP;
+				double const gy = point.y / cnst::CAMERA_GRID_STEP;
+				int const i = std::min(std::max((int) std::floor(gx), 0), nodes.width - 2);
+				int const j = std::min(std::max((int) std::floor(gy), 0), nodes.height - 2);
+				double const fx = gx - i;
+				double const fy = gy - j;
+
+				cv::Point2f const * top = &grid[j * nodes.width + i];
+				cv::Point2f const * bottom = top + nodes.width;
+
+				return cv::Point2d(
+					(top[0].x * (1.0 - fx) + top[1].x * fx) * (1.0 - fy) + (bottom[0].x * (1.0 - fx) + bottom[1].x * fx) * fy,
+					(top[0].y * (1.0 - fx) + top[1].y * fx) * (1.0 - fy) + (bottom[0].y * (1.0 - fx) + bottom[1].y * fx) * fy);
+			}
+
+			/**
+				\brief private member inline function
+
+				@param p a constant reference to a cv::Point2d object containing a distorted position in normalized coordinates
+
+				Inverts the distortion by the fixed point iteration of cv::undistortPoints() with cnst::CAMERA_UNDISTORT_ITERATIONS steps
+
+				@return a cv::Point2d containing the undistorted position in normalized coordinates
+			*/
+			cv::Point2d inline undistortNormalized(cv::Point2d const & p) const
+			{
+				double const k1 = this->d_distortion[0], k2 = this->d_distortion[1], p1 = this->d_distortion[2], p2 = this->d_distortion[3], k3 = this->d_distortion[4];
+				double x = p.x, y = p.y;
+
+				for(int i = 0; i < cnst::CAMERA_UNDISTORT_ITERATIONS; i++)
+				{
+					double const r2 = x * x + y * y;
+					double const radial = 1.0 + ((k3 * r2 + k2) * r2 + k1) * r2;
+
+					if(!(radial > 0.0)) break;
+
+					double const dx = 2.0 * p1 * x * y + p2 * (r2 + 2.0 * x * x);
+					double const dy = p1 * (r2 + 2.0 * y * y) + 2.0 * p2 * x * y;
+
+					x = (p.x - dx) / radial;
+					y = (p.y - dy) / radial;
+				}
+
+				return cv::Point2d(x, y);
+			}
+
+			/**
+				\brief private member inline function
+
+				@param p a constant reference to a cv::Point2d object containing an undistorted position in normalized coordinates
+
+				Applies the distortion of the lens, the radial factor is kept constant beyond d_maxRadiusSquared, where the polynomial of the calibration is not supported by data and may fold back
+
+				@return a cv::Point2d containing the distorted position in normalized coordinates
+			*/
+			cv::Point2d inline distortNormalized(cv::Point2d const & p) const
+			{
+				double const k1 = this->d_distortion[0], k2 = this->d_distortion[1], p1 = this->d_distortion[2], p2 = this->d_distortion[3], k3 = this->d_distortion[4];
+				double const r2 = p.x * p.x + p.y * p.y;
+				double const c2 = std::min(r2, this->d_maxRadiusSquared);
+				double const radial = 1.0 + ((k3 * c2 + k2) * c2 + k1) * c2;
+
+				return cv::Point2d(
+					p.x * radial + 2.0 * p1 * p.x * p.y + p2 * (r2 + 2.0 * p.x * p.x),
+					p.y * radial + p1 * (r2 + 2.0 * p.y * p.y) + 2.0 * p2 * p.x * p.y);
+			}
+
+			/**
+				\brief private member inline function
+
+				Scales the intrinsics to the frames and computes both grids. The undistortion grid covers the frame and determines the pinhole frame,
+				the distortion grid covers the pinhole frame
+			*/
+			void inline build()
+			{
+				int const step = cnst::CAMERA_GRID_STEP;
+
+				double const sx = (double) this->d_frameSize.width / this->d_calibrationSize.width;
+				double const sy = (double) this->d_frameSize.height / this->d_calibrationSize.height;
+
+				this->d_focal = cv::Point2d(this->d_cameraMatrix(0, 0) * sx, this->d_cameraMatrix(1, 1) * sy);
+				this->d_center = cv::Point2d(this->d_cameraMatrix(0, 2) * sx, this->d_cameraMatrix(1, 2) * sy);
+				this->d_maxRadiusSquared = 0.0;
+
+				this->d_undistortNodes = cv::Size(this->d_frameSize.width / step + 2, this->d_frameSize.height / step + 2);
+				this->d_undistortGrid.resize(this->d_undistortNodes.area());
+
+				double left = std::numeric_limits<double>::max(), top = left, right = -left, bottom = -left;
+
+				for(int j = 0; j < this->d_undistortNodes.height; j++)
+				{
+					for(int i = 0; i < this->d_undistortNodes.width; i++)
+					{
+						cv::Point2d const n = this->undistortNormalized(cv::Point2d((i * step - this->d_center.x) / this->d_focal.x, (j * step - this->d_center.y) / this->d_focal.y));
+						cv::Point2d const u(n.x * this->d_focal.x + this->d_center.x, n.y * this->d_focal.y + this->d_center.y);
+
+						this->d_maxRadiusSquared = std::max(this->d_maxRadiusSquared, n.x * n.x + n.y * n.y);
+
+						left = std::min(left, u.x);
+						right = std::max(right, u.x);
+						top = std::min(top, u.y);
+						bottom = std::max(bottom, u.y);
+
+						this->d_undistortGrid[j * this->d_undistortNodes.width + i] = cv::Point2f((float) u.x, (float) u.y);
+					}
+				}
+
+				this->d_offset = cv::Point2d(std::floor(left), std::floor(top));
+				this->d_size = cv::Size((int) std::ceil(right - this->d_offset.x) + 1, (int) std::ceil(bottom - this->d_offset.y) + 1);
+
+				for(std::size_t k = 0; k < this->d_undistortGrid.size(); k++)
+					this->d_undistortGrid[k] -= cv::Point2f((float) this->d_offset.x, (float) this->d_offset.y);
+
+				this->d_distortNodes = cv::Size(this->d_size.width / step + 2, this->d_size.height / step + 2);
+				this->d_distortGrid.resize(this->d_distortNodes.area());
+
+				for(int j = 0; j < this->d_distortNodes.height; j++)
+				{
+					for(int i = 0; i < this->d_distortNodes.width; i++)
+					{
+						cv::Point2d const d = this->distortNormalized(cv::Point2d((i * step + this->d_offset.x - this->d_center.x) / this->d_focal.x, (j * step + this->d_offset.y - this->d_center.y) / this->d_focal.y));
+
+						this->d_distortGrid[j * this->d_distortNodes.width + i] = cv::Point2f((float) (d.x * this->d_focal.x + this->d_center.x), (float) (d.y * this->d_focal.y + this->d_center.y));
+					}
+				}
+			}
+
+		public:
+
+			/**
+				constructor
+
+				@param cameraMatrix a constant reference to a cv::Matx33d containing the camera matrix of the calibration, its focal lengths have to be positive
+				@param distortion a constant reference to a cv::Vec containing the distortion coefficients k1, k2, p1, p2 and k3 of the calibration
+				@param calibrationSize a constant reference to a cv::Size object containing the dimensions of the calibrated images, which have to be positive
+				@param frameSize a constant reference to a cv::Size object containing the dimensions of the frames the model is used for
+			*/
+			CameraModel(cv::Matx33d const & cameraMatrix, cv::Vec<double, cnst::CAMERA_DISTORTION_COEFFICIENTS> const & distortion, cv::Size const & calibrationSize, cv::Size const & frameSize)
+				: d_cameraMatrix(cameraMatrix), d_distortion(distortion), d_calibrationSize(calibrationSize), d_frameSize(frameSize)
+			{
+				this->build();
+			}
+
+			/**
+				constructor
+
+				@param model a constant reference to the aux::CameraModel whose calibration is used
+				@param frameSize a constant reference to a cv::Size object containing the dimensions of the frames the model is used for
+			*/
+			CameraModel(CameraModel const & model, cv::Size const & frameSize) : CameraModel(model.d_cameraMatrix, model.d_distortion, model.d_calibrationSize, frameSize) {}
+
+			/**
+				default destructor
+			*/
+			~CameraModel() {}
+
+			/**
+				\brief public member inline function
+
+				@see d_cameraMatrix
+				@return a constant reference to a cv::Matx33d containing the camera matrix of the calibration
+			*/
+			cv::Matx33d const inline & cameraMatrix() const
+			{
+				return this->d_cameraMatrix;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_distortion
+				@return a constant reference to a cv::Vec containing the distortion coefficients of the calibration
+			*/
+			cv::Vec<double, cnst::CAMERA_DISTORTION_COEFFICIENTS> const inline & distortion() const
+			{
+				return this->d_distortion;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_calibrationSize
+				@return a constant reference to a cv::Size object containing the dimensions of the calibrated images
+			*/
+			cv::Size const inline & calibrationSize() const
+			{
+				return this->d_calibrationSize;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_frameSize
+				@return a constant reference to a cv::Size object containing the dimensions of the frames the model is built for
+			*/
+			cv::Size const inline & frameSize() const
+			{
+				return this->d_frameSize;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_size
+				@return a constant reference to a cv::Size object containing the dimensions of the pinhole frame
+			*/
+			cv::Size const inline & size() const
+			{
+				return this->d_size;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param point a constant reference to a cv::Point object containing a position in the frame
+
+				@return a cv::Point containing the position in the pinhole frame
+			*/
+			cv::Point inline undistort(cv::Point const & point) const
+			{
+				cv::Point2d const p = lookup(this->d_undistortGrid, this->d_undistortNodes, cv::Point2d(point.x, point.y));
+
+				return cv::Point(cvRound(p.x), cvRound(p.y));
+			}
+
+			/**
+				\brief public member inline function
+
+				@param point a constant reference to a cv::Point object containing a position in the pinhole frame
+
+				@return a cv::Point containing the position in the frame
+			*/
+			cv::Point inline distort(cv::Point const & point) const
+			{
+				cv::Point2d const p = lookup(this->d_distortGrid, this->d_distortNodes, cv::Point2d(point.x, point.y));
+
+				return cv::Point(cvRound(p.x), cvRound(p.y));
+			}
+
+			/**
+				\brief public member inline function
+
+				@param[out] undistorted a reference to a std::vector containing cv::Point objects to be filled with the positions in the pinhole frame as function output
+				@param[in] points a constant reference to a std::vector containing cv::Point objects depicting positions in the frame
+			*/
+			void inline undistort(std::vector<cv::Point> & undistorted, std::vector<cv::Point> const & points) const
+			{
+				undistorted.resize(points.size());
+
+				for(std::size_t i = 0; i < points.size(); i++) undistorted[i] = this->undistort(points[i]);
+			}
+
+			/**
+				\brief public member inline function
+
+				@param[in,out] points a reference to a std::vector containing cv::Point objects depicting positions in the pinhole frame to be moved to the frame as function output
+			*/
+			void inline distort(std::vector<cv::Point> & points) const
+			{
+				for(std::size_t i = 0; i < points.size(); i++) points[i] = this->distort(points[i]);
+			}
+
+			/**
+				\brief public member inline function
+
+				@param[in,out] polygons a reference to a std::vector of std::vectors containing cv::Point objects depicting polygons in the pinhole frame to be moved to the frame as function output
+			*/
+			void inline distort(std::vector<std::vector<cv::Point>> & polygons) const
+			{
+				for(std::size_t i = 0; i < polygons.size(); i++) this->distort(polygons[i]);
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_CAMERAMODEL_HPP_ */
@@ -0,0 +1,77 @@
+#ifndef AUXILIARYCLASSES_FRAMERESULT_HPP_
+#define AUXILIARYCLASSES_FRAMERESULT_HPP_
+
+#include <vector>
+#include <opencv2/core/core.hpp>
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\struct FrameResult
+		\brief FrameResult struct serving as the geometric output of the pipeline for one frame
+
+		Usage: This struct serves as the comparable result of a processed frame!
+		It is filled by proc::wdr::processWithdrawal() and proc::asmb::processImplementation() and is what a recording stores and a replay verifies,
+		proc::cmb::processCombined() fills one for each of both objects.
+		The outline contains the corner points of the storage or board, the overlay the corners of all boxes or assembly locations in drawing order.
+
+		@see aux::RecordingWriter
+	*/
+	struct FrameResult
+	{
+		/**
+			a bool containing whether the frame was processed (true) or left untouched because the session is not calibrated yet (false)
+		*/
+		bool processed;
+
+		/**
+			a std::vector containing the center points of the detected reference stickers
+		*/
+		std::vector<cv::Point> referencePoints;
+
+		/**
+			a std::vector containing the corner points of the storage or board
+		*/
+		std::vector<cv::Point> outline;
+
+		/**
+			a std::vector of std::vectors containing the corner points of every highlighted box or assembly location
+		*/
+		std::vector<std::vector<cv::Point>> overlay;
+
+		/**
+			default constructor
+		*/
+		FrameResult() : processed(false) {}
+
+		/**
+			\brief public member inline function
+
+			Empties the result so the object can be reused for the next frame without giving up its capacity
+		*/
+		void inline clear()
+		{
+			this->processed = false;
+			this->referencePoints.clear();
+			this->outline.clear();
+			this->overlay.clear();
+		}
+
+		/**
+			\brief public member inline function
+
+			@param other a constant reference to the FrameResult to be compared with
+
+			@return true if both results contain exactly the same points, false otherwise
+		*/
+		bool inline operator==(FrameResult const & other) const
+		{
+			return this->processed == other.processed && this->referencePoints == other.referencePoints && this->outline == other.outline && this->overlay == other.overlay;
+		}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_FRAMERESULT_HPP_ */
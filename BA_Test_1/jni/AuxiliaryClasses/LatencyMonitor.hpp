@@ -0,0 +1,352 @@
+#ifndef AUXILIARYCLASSES_LATENCYMONITOR_HPP_
+#define AUXILIARYCLASSES_LATENCYMONITOR_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include "Constants.hpp"
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class LatencyMonitor
+		\brief LatencyMonitor class serving as the rolling account of the latency, processing time, frame rate and dropped frames of a camera stream
+
+		Usage: This class serves as the always on service level measurement of one aux::Session!
+		Every produced result is recorded with the capture timestamp of its frame, the timestamp the frame entered the native layer and the one its result was produced.
+		The times are counted in logarithmic histograms of cnst::LATENCY_BUCKETS_PER_OCTAVE buckets per doubling starting at cnst::LATENCY_BUCKET_BASE_MS,
+		so a percentile is exact to about 19 percent at any magnitude. Two windows of cnst::LATENCY_WINDOW_SECONDS are kept, the statistics cover the last complete
+		and the running one, so they follow the stream without ever being empty right after a window is started.
+		The camera view counts the frames it overwrote before delivering them, each recorded frame carries the ones dropped right before it.
+		All timestamps are nanoseconds of the steady clock, which is the clock of System.nanoTime() on Android.
+
+		@see record()
+		@see statistics()
+	*/
+	class LatencyMonitor
+	{
+		public:
+
+			/**
+				\enum Metric
+				\brief the measured times of a frame
+			*/
+			enum Metric
+			{
+				LATENCY,
+				PROCESSING,
+				INTERVAL,
+				METRICS
+			};
+
+			/**
+				\struct Percentiles
+				\brief the 50th, 90th and 99th percentile and the maximum of a metric in milliseconds, 0 if nothing was measured
+			*/
+			struct Percentiles
+			{
+				double p50;
+				double p90;
+				double p99;
+				double max;
+			};
+
+			/**
+				\struct Statistics
+				\brief a snapshot of the counters and the percentiles of the windows
+			*/
+			struct Statistics
+			{
+				std::uint64_t frames;
+				std::uint64_t dropped;
+				std::uint64_t windowFrames;
+				std::uint64_t windowDropped;
+				double windowSeconds;
+				double fps;
+				Percentiles metrics[METRICS];
+			};
+
+		private:
+
+			/**
+				\struct Window
+				\brief the histograms and counters of one window
+			*/
+			struct Window
+			{
+				std::int64_t start;
+				std::uint64_t frames;
+				std::uint64_t dropped;
+				std::int64_t max[METRICS];
+				std::uint32_t counts[METRICS][cnst::LATENCY_BUCKETS];
+			};
+
+			/**
+				a std::mutex guarding all members, recording and querying only copy counters while holding it
+			*/
+			mutable std::mutex d_mutex;
+
+			/**
+				the two Window objects, the running one at index d_current
+			*/
+			Window d_windows[2];
+
+			/**
+				an int containing the index of the running Window
+			*/
+			int d_current;
+
+			/**
+				a std::uint64_t containing the number of recorded frames since construction
+			*/
+			std::uint64_t d_frames;
+
+			/**
+				a std::uint64_t containing the number of dropped frames since construction
+			*/
+			std::uint64_t d_dropped;
+
+			/**
+				a std::int64_t containing the result timestamp of the last recorded frame, 0 before the first one
+			*/
+			std::int64_t d_lastResult;
+
+			/**
+				\brief private static inline function
+
+				@param window a reference to the Window to be emptied
+				@param start a std::int64_t containing the timestamp the window starts at, 0 for a window not started yet
+			*/
+			static void inline clear(Window & window, std::int64_t const start)
+			{
+				std::memset(&window, 0, sizeof(Window));
+				window.start = start;
+			}
+
+			/**
+				\brief private static inline function
+
+				@param nanoseconds a std::int64_t containing a duration
+
+				@return an int containing the index of the histogram bucket of the duration
+			*/
+			static int inline bucket(std::int64_t const nanoseconds)
+			{
+				double const milliseconds = nanoseconds / 1e6;
+
+				if(!(milliseconds > cnst::LATENCY_BUCKET_BASE_MS)) return 0;
+
+				int const index = (int) (std::log2(milliseconds / cnst::LATENCY_BUCKET_BASE_MS) * cnst::LATENCY_BUCKETS_PER_OCTAVE) + 1;
+
+				return std::min(index, cnst::LATENCY_BUCKETS - 1);
+			}
+
+			/**
+				\brief private static inline function
+
+				@param index an int containing the index of a histogram bucket
+
+				@return a double containing the upper bound of the bucket in milliseconds
+			*/
+			static double inline upperBound(int const index)
+			{
+				return cnst::LATENCY_BUCKET_BASE_MS * std::pow(2.0, (double) index / cnst::LATENCY_BUCKETS_PER_OCTAVE);
+			}
+
+			/**
+				\brief private static inline function
+
+				@param window a reference to the running Window
+				@param metric the Metric to be counted
+				@param nanoseconds a std::int64_t containing the measured duration
+			*/
+			static void inline count(Window & window, Metric const metric, std::int64_t const nanoseconds)
+			{
+				window.counts[metric][LatencyMonitor::bucket(nanoseconds)]++;
+				window.max[metric] = std::max(window.max[metric], nanoseconds);
+			}
+
+			/**
+				\brief private member inline function
+
+				@param timestamp a std::int64_t containing the timestamp of the current result
+
+				@return a reference to the running Window after starting a new one if the running one is complete,
+				both windows are emptied after a pause of more than a window
+			*/
+			Window inline & window(std::int64_t const timestamp)
+			{
+				std::int64_t const length = (std::int64_t) cnst::LATENCY_WINDOW_SECONDS * 1000000000LL;
+				Window & running = this->d_windows[this->d_current];
+
+				if(running.start == 0)
+				{
+					running.start = timestamp;
+				}
+				else if(timestamp - running.start >= 2 * length)
+				{
+					LatencyMonitor::clear(this->d_windows[1 - this->d_current], 0);
+					LatencyMonitor::clear(running, timestamp);
+				}
+				else if(timestamp - running.start >= length)
+				{
+					this->d_current = 1 - this->d_current;
+					LatencyMonitor::clear(this->d_windows[this->d_current], running.start + length);
+				}
+
+				return this->d_windows[this->d_current];
+			}
+
+		public:
+
+			/**
+				default constructor
+			*/
+			LatencyMonitor()
+				:
+					d_current(0),
+					d_frames(0),
+					d_dropped(0),
+					d_lastResult(0)
+			{
+				LatencyMonitor::clear(this->d_windows[0], 0);
+				LatencyMonitor::clear(this->d_windows[1], 0);
+			}
+
+			/**
+				default destructor
+			*/
+			~LatencyMonitor() {}
+
+			/**
+				\brief public member inline function
+
+				@param captureTimestamp a std::int64_t containing the time the frame was captured, 0 or less if unknown
+				@param entryTimestamp a std::int64_t containing the time the frame entered the native layer
+				@param resultTimestamp a std::int64_t containing the time the result of the frame was produced
+				@param droppedFrames a std::int64_t containing the number of frames the camera overwrote right before this one was delivered, 0 or less if none
+
+				Counts the capture to result latency, the processing time and the interval since the previous result.
+				Intervals spanning a pause of more than a window, e.g. while no task is active, are not counted.
+				The dropped frames are counted as passed, the caller leaves out the frames dropped while it did not process the stream
+			*/
+			void inline record(std::int64_t const captureTimestamp, std::int64_t const entryTimestamp, std::int64_t const resultTimestamp, std::int64_t const droppedFrames)
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				std::int64_t const length = (std::int64_t) cnst::LATENCY_WINDOW_SECONDS * 1000000000LL;
+				Window & w = this->window(resultTimestamp);
+
+				w.frames++;
+				this->d_frames++;
+
+				if(captureTimestamp > 0) LatencyMonitor::count(w, LATENCY, resultTimestamp - captureTimestamp);
+
+				LatencyMonitor::count(w, PROCESSING, resultTimestamp - entryTimestamp);
+
+				if(this->d_lastResult > 0 && resultTimestamp - this->d_lastResult < length) LatencyMonitor::count(w, INTERVAL, resultTimestamp - this->d_lastResult);
+
+				if(droppedFrames > 0)
+				{
+					w.dropped += droppedFrames;
+					this->d_dropped += droppedFrames;
+				}
+
+				this->d_lastResult = resultTimestamp;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param timestamp a std::int64_t containing the current time
+
+				@return the Statistics of both windows up to the timestamp, the frame rate is the number of frames divided by the time the windows cover
+			*/
+			Statistics inline statistics(std::int64_t const timestamp) const
+			{
+				std::uint32_t counts[METRICS][cnst::LATENCY_BUCKETS];
+				std::int64_t max[METRICS] = { 0, 0, 0 };
+				std::int64_t start = 0;
+
+				Statistics s;
+
+				{
+					std::lock_guard<std::mutex> lock(this->d_mutex);
+
+					Window const & running = this->d_windows[this->d_current];
+					Window const & previous = this->d_windows[1 - this->d_current];
+
+					s.frames = this->d_frames;
+					s.dropped = this->d_dropped;
+					s.windowFrames = running.frames + previous.frames;
+					s.windowDropped = running.dropped + previous.dropped;
+
+					start = previous.start != 0 ? previous.start : running.start;
+
+					for(int m = 0; m < METRICS; m++)
+					{
+						max[m] = std::max(running.max[m], previous.max[m]);
+
+						for(int b = 0; b < cnst::LATENCY_BUCKETS; b++) counts[m][b] = running.counts[m][b] + previous.counts[m][b];
+					}
+				}
+
+				s.windowSeconds = start != 0 && timestamp > start ? (timestamp - start) / 1e9 : 0.0;
+				s.fps = s.windowSeconds > 0 ? s.windowFrames / s.windowSeconds : 0.0;
+
+				for(int m = 0; m < METRICS; m++)
+				{
+					std::uint64_t total = 0;
+
+					for(int b = 0; b < cnst::LATENCY_BUCKETS; b++) total += counts[m][b];
+
+					double const ranks[] = { 0.5, 0.9, 0.99 };
+					double values[] = { 0.0, 0.0, 0.0 };
+					double const maximum = max[m] / 1e6;
+
+					for(int r = 0; r < 3 && total > 0; r++)
+					{
+						std::uint64_t const rank = (std::uint64_t) std::ceil(ranks[r] * total);
+						std::uint64_t seen = 0;
+						int b = 0;
+
+						for(; b < cnst::LATENCY_BUCKETS - 1 && seen + counts[m][b] < rank; b++) seen += counts[m][b];
+
+						values[r] = std::min(LatencyMonitor::upperBound(b), maximum);
+					}
+
+					s.metrics[m].p50 = values[0];
+					s.metrics[m].p90 = values[1];
+					s.metrics[m].p99 = values[2];
+					s.metrics[m].max = maximum;
+				}
+
+				return s;
+			}
+
+			/**
+				\brief public member inline function
+
+				Empties both windows and all counters, e.g. after the camera stream was restarted
+			*/
+			void inline reset()
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				LatencyMonitor::clear(this->d_windows[0], 0);
+				LatencyMonitor::clear(this->d_windows[1], 0);
+
+				this->d_current = 0;
+				this->d_frames = 0;
+				this->d_dropped = 0;
+				this->d_lastResult = 0;
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_LATENCYMONITOR_HPP_ */
@@ -0,0 +1,337 @@
+#ifndef AUXILIARYCLASSES_MODEL_HPP_
+#define AUXILIARYCLASSES_MODEL_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Board.hpp"
+#include "Storage.hpp"
+#include "ModelImage.hpp"
+#include "PlacementIndex.hpp"
+#include "BoardTable.hpp"
+#include "Constants.hpp"
+#include "Functions/GeometryFunctions.hpp"
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class Model
+		\brief Model class serving as an immutable snapshot of the board and storage a session works with
+
+		Usage: This class serves as the unit of exchange for board and storage data!
+		All derived values are calculated once in the constructor and never change afterwards,
+		so a Model can be shared between threads and sessions without synchronization.
+		A Model created from an aux::ModelImage keeps the mapping alive and references its coordinate matrices in place.
+		A Model created from an aux::BoardTable references the constant tables of the compiled in board, nothing is parsed or indexed at runtime.
+
+		@see d_image
+		@see d_table
+		@see d_board
+		@see d_storage
+		@see d_boardTargetPointsVectors
+		@see d_storageTargetPointsVectors
+		@see d_placementIndex
+		@see d_memorySize
+	*/
+	class Model
+	{
+		private:
+
+			/**
+				a std::shared_ptr to the aux::ModelImage the matrices of this Model reference, empty if the Model was not created from an image
+			*/
+			std::shared_ptr<ModelImage const> d_image;
+
+			/**
+				a constant pointer to the compiled in aux::BoardTable the matrices and grids of this Model reference, nullptr if the Model was not created from a table
+			*/
+			BoardTable const * d_table;
+
+			/**
+				the aux::Board object used for all calculations based on board specific values
+			*/
+			Board<double> d_board;
+
+			/**
+				the aux::Storage object used for all calculations based on storage specific values
+			*/
+			Storage<double> d_storage;
+
+			/**
+				the shrinking or stretching factors used to calculate the target points needed for assembly
+			*/
+			std::vector<std::vector<double>> d_boardTargetPointsVectors;
+
+			/**
+				the shrinking or stretching factors used to calculate the target points needed for withdrawal
+			*/
+			std::vector<std::vector<double>> d_storageTargetPointsVectors;
+
+			/**
+				the aux::PlacementIndex over all placements of the board
+			*/
+			PlacementIndex d_placementIndex;
+
+			/**
+				a std::size_t containing the estimated number of bytes held by this Model
+			*/
+			std::size_t d_memorySize;
+
+			/**
+				\brief private member inline function
+
+				@return a std::size_t containing the estimated number of bytes held by this Model including the mapped image
+			*/
+			std::size_t inline estimateMemorySize() const
+			{
+				std::size_t size = sizeof(Model) + this->d_board.name().size() + this->d_placementIndex.memorySize();
+
+				bool const owned = !this->d_image && this->d_table == nullptr;
+
+				if(this->d_image)
+					size += this->d_image->size();
+				else if(owned)
+					size += (this->d_board.distRefToCorners().total() + this->d_storage.distRefsToCorners().total()) * sizeof(double);
+
+				for(std::size_t i = 0; i < this->d_board.components().size(); i++)
+				{
+					Component<double> const & c = this->d_board.components()[i];
+
+					size += sizeof(Component<double>) + c.name().size();
+
+					if(owned) size += c.coordinates().total() * c.coordinates().elemSize();
+				}
+
+				return size;
+			}
+
+		public:
+
+			/**
+				explicit constructor
+
+				@param board a constant reference to the aux::Board object
+				@param storage a constant reference to the aux::Storage object
+
+				Stores board and storage, calculates the target vector factors of both and indexes all placements of the board
+
+				@see geo::targetVectorFactors<T>()
+				@see cnst::INVERSION_FACTOR
+			*/
+			explicit Model(Board<double> const & board, Storage<double> const & storage)
+				:
+					d_table(nullptr),
+					d_board(board),
+					d_storage(storage)
+			{
+				geo::targetVectorFactors<double>(this->d_boardTargetPointsVectors, board.refDimensions()[0], board.refDimensions()[1], board.distRefToCorners());
+				geo::targetVectorFactors<double>(this->d_storageTargetPointsVectors, storage.refMidDimensions()[0], storage.refMidDimensions()[1], storage.distRefsToCorners());
+
+				for(std::size_t i = 0; i < this->d_storageTargetPointsVectors.size(); i++)
+					for(std::size_t k = 0; k < this->d_storageTargetPointsVectors[i].size(); k++)
+						this->d_storageTargetPointsVectors[i][k] *= cnst::INVERSION_FACTOR;
+
+				this->d_placementIndex = PlacementIndex(this->d_board);
+				this->d_memorySize = this->estimateMemorySize();
+			}
+
+			/**
+				explicit constructor
+
+				@param image a std::shared_ptr to a valid aux::ModelImage
+
+				Creates board and storage from the image without parsing. The coordinate matrices and the placement grids reference the mapped image,
+				only the strings are copied. The target vector factors are taken precomputed from the image
+
+				@see aux::ModelImage
+			*/
+			explicit Model(std::shared_ptr<ModelImage const> const & image)
+				:
+					d_image(image),
+					d_table(nullptr)
+			{
+				ModelImage::Header const & h = image->header();
+
+				std::vector<Component<double>> components;
+				std::vector<PlacementIndex::GridView> grids;
+				components.reserve(h.componentCount);
+				grids.reserve(h.componentCount);
+
+				for(std::uint32_t i = 0; i < h.componentCount; i++)
+				{
+					ModelImage::Component const & c = image->component(i);
+
+					components.push_back(Component<double>(image->string(c.name), c.occurrences, image->matrix(c.coordinates), c.width, c.height, c.polarity != 0, c.boxNum));
+					grids.push_back(image->grid(i));
+				}
+
+				this->d_board = Board<double>(
+						image->string(h.boardName),
+						std::move(components),
+						std::vector<double> {h.originXY[0], h.originXY[1]},
+						std::vector<double> {h.refDimensions[0], h.refDimensions[1]},
+						std::vector<double> {h.boardDimensions[0], h.boardDimensions[1]},
+						h.rotated != 0,
+						image->matrix(h.boardDistRefsToCorners),
+						h.markers != 0);
+
+				this->d_storage = Storage<double>(
+						std::vector<int> {h.storageMatrix[0], h.storageMatrix[1]},
+						std::vector<double> {h.refMidDimensions[0], h.refMidDimensions[1]},
+						std::vector<double> {h.refCornerDimensions[0], h.refCornerDimensions[1]},
+						std::vector<double> {h.boxOffsetXY[0], h.boxOffsetXY[1]},
+						std::vector<double> {h.boxDimensions[0], h.boxDimensions[1]},
+						image->matrix(h.storageDistRefsToCorners));
+
+				for(int i = 0; i < cnst::NUMBER_CORNERS; i++)
+				{
+					this->d_boardTargetPointsVectors.push_back(std::vector<double> {h.boardTargetPointsVectors[i][0], h.boardTargetPointsVectors[i][1]});
+					this->d_storageTargetPointsVectors.push_back(std::vector<double> {h.storageTargetPointsVectors[i][0], h.storageTargetPointsVectors[i][1]});
+				}
+
+				this->d_placementIndex = PlacementIndex(grids.data(), (int) grids.size());
+				this->d_memorySize = this->estimateMemorySize();
+			}
+
+			/**
+				explicit constructor
+
+				@param table a constant reference to a compiled in aux::BoardTable with static storage duration
+
+				Creates board and storage from the table without parsing. The coordinate matrices and the placement grids reference the constant tables,
+				only the strings are copied. The target vector factors are taken precomputed from the table
+
+				@see aux::BoardTable
+			*/
+			explicit Model(BoardTable const & table)
+				:
+					d_table(&table)
+			{
+				std::vector<Component<double>> components;
+				components.reserve(table.componentCount);
+
+				for(int i = 0; i < table.componentCount; i++)
+				{
+					BoardTable::Component const & c = table.components[i];
+					cv::Mat coordinates(c.occurrences, 4, CV_64F, (void *) c.coordinates);
+
+					components.push_back(Component<double>(c.name, c.occurrences, coordinates, c.width, c.height, c.polarity, c.boxNum));
+				}
+
+				this->d_board = Board<double>(
+						table.name,
+						std::move(components),
+						std::vector<double> {table.originXY[0], table.originXY[1]},
+						std::vector<double> {table.refDimensions[0], table.refDimensions[1]},
+						std::vector<double> {table.boardDimensions[0], table.boardDimensions[1]},
+						table.rotated,
+						cv::Mat(cnst::NUMBER_CORNERS, 2, CV_64F, (void *) table.boardDistRefsToCorners),
+						table.markers);
+
+				this->d_storage = Storage<double>(
+						std::vector<int> {table.storageMatrix[0], table.storageMatrix[1]},
+						std::vector<double> {table.refMidDimensions[0], table.refMidDimensions[1]},
+						std::vector<double> {table.refCornerDimensions[0], table.refCornerDimensions[1]},
+						std::vector<double> {table.boxOffsetXY[0], table.boxOffsetXY[1]},
+						std::vector<double> {table.boxDimensions[0], table.boxDimensions[1]},
+						cv::Mat(cnst::NUMBER_CORNERS, 2, CV_64F, (void *) table.storageDistRefsToCorners));
+
+				for(int i = 0; i < cnst::NUMBER_CORNERS; i++)
+				{
+					this->d_boardTargetPointsVectors.push_back(std::vector<double> {table.boardTargetPointsVectors[i][0], table.boardTargetPointsVectors[i][1]});
+					this->d_storageTargetPointsVectors.push_back(std::vector<double> {table.storageTargetPointsVectors[i][0], table.storageTargetPointsVectors[i][1]});
+				}
+
+				this->d_placementIndex = PlacementIndex(table.grids, table.componentCount);
+				this->d_memorySize = this->estimateMemorySize();
+			}
+
+			/**
+				default destructor
+			*/
+			~Model() {}
+
+			/**
+				\brief public member inline function
+
+				@see d_table
+				@return a constant pointer to the compiled in aux::BoardTable of this Model, nullptr if the Model was not created from a table
+			*/
+			BoardTable const inline * table() const
+			{
+				return this->d_table;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_board
+				@return the aux::Board object as constant reference
+			*/
+			Board<double> inline const & board() const
+			{
+				return this->d_board;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_storage
+				@return the aux::Storage object as constant reference
+			*/
+			Storage<double> inline const & storage() const
+			{
+				return this->d_storage;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_boardTargetPointsVectors
+				@return a std::vector of std::vectors containing the factors needed for assembly as constant reference
+			*/
+			std::vector<std::vector<double>> inline const & boardTargetPointsVectors() const
+			{
+				return this->d_boardTargetPointsVectors;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_storageTargetPointsVectors
+				@return a std::vector of std::vectors containing the factors needed for withdrawal as constant reference
+			*/
+			std::vector<std::vector<double>> inline const & storageTargetPointsVectors() const
+			{
+				return this->d_storageTargetPointsVectors;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_placementIndex
+				@return the aux::PlacementIndex over all placements of the board as constant reference
+			*/
+			PlacementIndex inline const & placementIndex() const
+			{
+				return this->d_placementIndex;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_memorySize
+				@return a std::size_t containing the estimated number of bytes held by this Model
+			*/
+			std::size_t inline memorySize() const
+			{
+				return this->d_memorySize;
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_MODEL_HPP_ */
@@ -0,0 +1,353 @@
+#ifndef AUXILIARYCLASSES_MODELCACHE_HPP_
+#define AUXILIARYCLASSES_MODELCACHE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <dirent.h>
+#include "Model.hpp"
+#include "Functions/FileReadingFunctions.hpp"
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class ModelCache
+		\brief ModelCache class serving as a store of ready to use aux::Model objects indexed by board id
+
+		Usage: This class serves as the source of models when switching between boards!
+		A directory of configuration files is registered once, the board id of a file is its name without extension,
+		so the QR code of a board names its file. A compiled aux::ModelImage (.bin) is preferred over an xml file (.xml) of the same id.
+		Models are built in the background by preload() or on first use by get() and kept in least recently used order.
+		The estimated memory of all resident models is kept within the budget by evicting the least recently used ones,
+		an evicted model is rebuilt from its file when it is requested again. Models still in use by a aux::Session stay alive until released there.
+		Models of compiled in aux::BoardTables are added pinned, they take precedence over files of the same id and are never evicted.
+		All member functions are thread safe.
+
+		@see d_entries
+		@see d_lru
+		@see d_budget
+		@see aux::Model::memorySize()
+	*/
+	class ModelCache
+	{
+		private:
+
+			/**
+				\struct Entry
+				\brief a registered board, its file and its model if resident, pinned models are compiled in and neither counted nor evicted
+			*/
+			struct Entry
+			{
+				std::string path;
+				std::shared_ptr<Model const> model;
+				std::list<std::string>::iterator lru;
+				bool pinned = false;
+			};
+
+			/**
+				a std::map containing all registered boards by board id guarded by d_mutex
+			*/
+			std::map<std::string, Entry> d_entries;
+
+			/**
+				a std::list containing the board ids of all resident models, the most recently used first, guarded by d_mutex
+			*/
+			std::list<std::string> d_lru;
+
+			/**
+				a std::size_t containing the maximum estimated number of bytes of all resident models
+			*/
+			std::size_t d_budget;
+
+			/**
+				a std::size_t containing the estimated number of bytes of all resident models guarded by d_mutex
+			*/
+			std::size_t d_bytes;
+
+			/**
+				a std::mutex guarding the entries
+			*/
+			mutable std::mutex d_mutex;
+
+			/**
+				a std::thread building models in the background
+			*/
+			std::thread d_loader;
+
+			/**
+				a std::atomic bool containing whether the background loading has to stop (true) or not (false)
+			*/
+			std::atomic<bool> d_stop;
+
+			/**
+				\brief private static inline function
+
+				@param filename a constant reference to a std::string containing the name of a file without directory
+				@param[out] isImage a reference to a bool set to whether the file is a compiled model image (true) or an xml file (false)
+
+				@return a std::string containing the board id of the file, empty if the file is no configuration file
+			*/
+			static std::string inline boardId(std::string const & filename, bool & isImage)
+			{
+				std::string::size_type dot = filename.rfind('.');
+
+				if(dot == std::string::npos || dot == 0) return std::string();
+
+				std::string extension = filename.substr(dot);
+
+				isImage = extension == ".bin";
+
+				return (isImage || extension == ".xml") ? filename.substr(0, dot) : std::string();
+			}
+
+			/**
+				\brief private member inline function
+
+				@param id a constant reference to a std::string containing the board id
+				@param model a constant reference to a std::shared_ptr to the built aux::Model
+				@param evict a bool containing whether other models are evicted to stay within the budget (true) or the model is dropped if it does not fit (false)
+
+				Makes the model resident as most recently used unless another thread did so before. Has to be called with d_mutex held
+
+				@return a std::shared_ptr to the resident aux::Model, empty if it was dropped
+			*/
+			std::shared_ptr<Model const> insert(std::string const & id, std::shared_ptr<Model const> const & model, bool const evict)
+			{
+				Entry & entry = this->d_entries[id];
+
+				if(entry.model) return entry.model;
+
+				if(!evict && this->d_bytes + model->memorySize() > this->d_budget) return std::shared_ptr<Model const>();
+
+				entry.model = model;
+				entry.lru = this->d_lru.insert(this->d_lru.begin(), id);
+				this->d_bytes += model->memorySize();
+
+				while(this->d_bytes > this->d_budget && this->d_lru.size() > 1)
+				{
+					Entry & victim = this->d_entries[this->d_lru.back()];
+
+					this->d_bytes -= victim.model->memorySize();
+					victim.model.reset();
+					this->d_lru.pop_back();
+				}
+
+				return model;
+			}
+
+		public:
+
+			/**
+				explicit constructor
+
+				@param budget a std::size_t containing the maximum estimated number of bytes of all resident models.
+				The most recently used model is kept even if it exceeds the budget on its own
+			*/
+			explicit ModelCache(std::size_t const budget)
+				:
+					d_budget(budget),
+					d_bytes(0),
+					d_stop(false)
+			{}
+
+			/**
+				default destructor
+
+				Stops and joins the background loading
+			*/
+			~ModelCache()
+			{
+				this->d_stop = true;
+
+				if(this->d_loader.joinable()) this->d_loader.join();
+			}
+
+			ModelCache(ModelCache const &) = delete;
+			ModelCache & operator=(ModelCache const &) = delete;
+
+			/**
+				\brief public member inline function
+
+				@param directory a constant reference to a std::string containing the path of the directory containing the configuration files
+
+				Registers all configuration files of the directory without building their models
+
+				@return a std::vector of std::strings containing the board ids found in the directory
+			*/
+			std::vector<std::string> inline scan(std::string const & directory)
+			{
+				std::vector<std::string> ids;
+				DIR * dir = opendir(directory.c_str());
+
+				if(dir == nullptr) return ids;
+
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				for(struct dirent * file = readdir(dir); file != nullptr; file = readdir(dir))
+				{
+					bool isImage = false;
+					std::string id = ModelCache::boardId(file->d_name, isImage);
+
+					if(id.empty()) continue;
+
+					Entry & entry = this->d_entries[id];
+
+					if(entry.path.empty()) ids.push_back(id);
+
+					if(entry.path.empty() || isImage) entry.path = directory + "/" + file->d_name;
+				}
+
+				closedir(dir);
+
+				return ids;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param directory a constant reference to a std::string containing the path of the directory containing the configuration files
+
+				Registers the directory and builds its models on a background thread until the budget is reached.
+				Models built in the background never evict models already resident
+
+				@see scan()
+			*/
+			void inline preload(std::string const & directory)
+			{
+				this->d_stop = true;
+
+				if(this->d_loader.joinable()) this->d_loader.join();
+
+				this->d_stop = false;
+
+				this->d_loader = std::thread([this, directory] {
+					std::vector<std::string> ids = this->scan(directory);
+
+					for(std::size_t i = 0; i < ids.size() && !this->d_stop; i++)
+					{
+						std::string path;
+
+						{
+							std::lock_guard<std::mutex> lock(this->d_mutex);
+
+							Entry const & entry = this->d_entries[ids[i]];
+
+							if(entry.model) continue;
+
+							path = entry.path;
+						}
+
+						std::shared_ptr<Model const> model = readf::readModel(path);
+
+						if(!model) continue;
+
+						std::lock_guard<std::mutex> lock(this->d_mutex);
+
+						if(!this->insert(ids[i], model, false)) break;
+					}
+				});
+			}
+
+			/**
+				\brief public member inline function
+
+				@param id a constant reference to a std::string containing the board id
+
+				Returns the resident model and marks it as most recently used or builds it from its registered file
+
+				@return a std::shared_ptr to the aux::Model of the board, empty if the board id is unknown or its file is invalid
+			*/
+			std::shared_ptr<Model const> inline get(std::string const & id)
+			{
+				std::string path;
+
+				{
+					std::lock_guard<std::mutex> lock(this->d_mutex);
+
+					std::map<std::string, Entry>::iterator it = this->d_entries.find(id);
+
+					if(it == this->d_entries.end()) return std::shared_ptr<Model const>();
+
+					if(it->second.pinned) return it->second.model;
+
+					if(it->second.model)
+					{
+						this->d_lru.splice(this->d_lru.begin(), this->d_lru, it->second.lru);
+						return it->second.model;
+					}
+
+					path = it->second.path;
+				}
+
+				std::shared_ptr<Model const> model = readf::readModel(path);
+
+				if(!model) return model;
+
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				return this->insert(id, model, true);
+			}
+
+			/**
+				\brief public member inline function
+
+				@param id a constant reference to a std::string containing the board id
+				@param model a constant reference to a std::shared_ptr to the aux::Model of a compiled in board
+
+				Registers the model pinned, replacing a resident model of the same id. Pinned models do not count against the budget
+			*/
+			void inline add(std::string const & id, std::shared_ptr<Model const> const & model)
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				Entry & entry = this->d_entries[id];
+
+				if(entry.model && !entry.pinned)
+				{
+					this->d_bytes -= entry.model->memorySize();
+					this->d_lru.erase(entry.lru);
+				}
+
+				entry.model = model;
+				entry.pinned = true;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param id a constant reference to a std::string containing the board id
+
+				@return true if the board id is registered, false otherwise
+			*/
+			bool inline contains(std::string const & id) const
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				return this->d_entries.find(id) != this->d_entries.end();
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_bytes
+				@return a std::size_t containing the estimated number of bytes of all resident models
+			*/
+			std::size_t inline bytes() const
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				return this->d_bytes;
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_MODELCACHE_HPP_ */
@@ -0,0 +1,584 @@
+#ifndef AUXILIARYCLASSES_MODELIMAGE_HPP_
+#define AUXILIARYCLASSES_MODELIMAGE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <opencv2/core/core.hpp>
+#include "Board.hpp"
+#include "Storage.hpp"
+#include "PlacementIndex.hpp"
+#include "CameraModel.hpp"
+#include "Constants.hpp"
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class ModelImage
+		\brief ModelImage class serving as a read only, memory mapped view of a compiled board and storage configuration
+
+		Usage: This class serves as the binary counterpart of the xml configuration file!
+		A model image is produced offline by the model compiler from the xml file. It starts with a Header followed by the Component table,
+		the coordinate matrices as doubles, the placement grids and the strings. All offsets are relative to the start of the image and aligned to cnst::MODEL_IMAGE_ALIGNMENT,
+		so the image is used in place right after mapping without any parsing. The derived target vector factors and the aux::PlacementIndex grids are stored precomputed,
+		the optional aux::CameraModel calibration of the xml file is carried along in the header.
+		Mapping only checks magic, version, size and the bounds of the tables, which touches the header, the component table and the cell tables but none of the
+		matrices or placements. The checksum over the whole image is verified on request, e.g. by the model compiler.
+
+		@see Header
+		@see Component
+		@see Grid
+		@see verify()
+		@see compile()
+		@see aux::Model
+	*/
+	class ModelImage
+	{
+		public:
+
+			/**
+				\struct String
+				\brief a string of the image given by its offset and its length without terminator
+			*/
+			struct String
+			{
+				std::uint64_t offset;
+				std::uint32_t length;
+				std::uint32_t reserved;
+			};
+
+			/**
+				\struct Matrix
+				\brief a row major matrix of doubles of the image given by its offset and its dimensions
+			*/
+			struct Matrix
+			{
+				std::uint64_t offset;
+				std::uint32_t rows;
+				std::uint32_t cols;
+			};
+
+			/**
+				\struct Grid
+				\brief the placement grid of one component, the counterpart of aux::PlacementIndex::GridView
+
+				The cell table holds columns * rows + 1 ints, the placements are aux::PlacementIndex::Placement values packed cell by cell
+			*/
+			struct Grid
+			{
+				std::int32_t columns;
+				std::int32_t rows;
+				double cellWidth;
+				double cellHeight;
+				double maxCornerX;
+				double maxCornerY;
+				std::uint64_t cellStartOffset;
+				std::uint64_t placementsOffset;
+				std::uint32_t placementCount;
+				std::uint32_t reserved;
+			};
+
+			/**
+				\struct Component
+				\brief an entry of the component table, the counterpart of aux::Component
+			*/
+			struct Component
+			{
+				String name;
+				Matrix coordinates;
+				Grid grid;
+				double width;
+				double height;
+				std::int32_t occurrences;
+				std::int32_t polarity;
+				std::int32_t boxNum;
+				std::int32_t reserved;
+			};
+
+			/**
+				\struct Header
+				\brief the header at the start of the image containing the scalar values of aux::Board and aux::Storage, the precomputed target vector factors and the camera calibration
+
+				The checksum covers all bytes following the header. The calibrated image size is zero if the configuration has no camera model
+			*/
+			struct Header
+			{
+				char magic[8];
+				std::uint32_t version;
+				std::uint32_t headerSize;
+				std::uint64_t imageSize;
+				std::uint64_t checksum;
+
+				String boardName;
+				std::uint64_t componentsOffset;
+				std::uint32_t componentCount;
+				std::uint32_t rotated;
+				std::uint32_t markers;
+				std::uint32_t reserved;
+				double originXY[2];
+				double refDimensions[2];
+				double boardDimensions[2];
+				Matrix boardDistRefsToCorners;
+
+				std::int32_t storageMatrix[2];
+				double refMidDimensions[2];
+				double refCornerDimensions[2];
+				double boxOffsetXY[2];
+				double boxDimensions[2];
+				Matrix storageDistRefsToCorners;
+
+				double boardTargetPointsVectors[cnst::NUMBER_CORNERS][2];
+				double storageTargetPointsVectors[cnst::NUMBER_CORNERS][2];
+
+				std::int32_t cameraCalibrationSize[2];
+				double cameraMatrix[9];
+				double cameraDistortion[cnst::CAMERA_DISTORTION_COEFFICIENTS];
+			};
+
+			static_assert(std::is_standard_layout<Header>::value && sizeof(Header) % cnst::MODEL_IMAGE_ALIGNMENT == 0, "ModelImage::Header layout");
+			static_assert(std::is_standard_layout<Component>::value && sizeof(Component) % cnst::MODEL_IMAGE_ALIGNMENT == 0, "ModelImage::Component layout");
+			static_assert(std::is_standard_layout<PlacementIndex::Placement>::value && sizeof(PlacementIndex::Placement) % cnst::MODEL_IMAGE_ALIGNMENT == 0, "PlacementIndex::Placement layout");
+
+		private:
+
+			/**
+				a constant unsigned char pointer to the start of the mapped image, nullptr if mapping or validation failed
+			*/
+			unsigned char const * d_data;
+
+			/**
+				a std::size_t containing the size of the mapping in bytes
+			*/
+			std::size_t d_size;
+
+			/**
+				\brief private member inline function
+
+				@param offset a std::uint64_t containing the offset of a range within the image
+				@param bytes a std::uint64_t containing the length of the range in bytes
+
+				@return true if the range lies within the image and its offset is aligned, false otherwise
+			*/
+			bool inline contains(std::uint64_t const offset, std::uint64_t const bytes) const
+			{
+				return offset % cnst::MODEL_IMAGE_ALIGNMENT == 0 && offset <= this->d_size && bytes <= this->d_size - offset;
+			}
+
+			/**
+				\brief private member inline function
+
+				@param matrix a constant reference to a Matrix of the image
+
+				@return true if the matrix lies within the image, false otherwise
+			*/
+			bool inline contains(Matrix const & matrix) const
+			{
+				return this->contains(matrix.offset, (std::uint64_t) matrix.rows * matrix.cols * sizeof(double));
+			}
+
+			/**
+				\brief private member inline function
+
+				@param grid a constant reference to a Grid of the image
+
+				@return true if the cell table and the placements lie within the image and the cell table indexes exactly the placements, false otherwise
+			*/
+			bool inline contains(Grid const & grid) const
+			{
+				if(grid.columns <= 0 || grid.rows <= 0) return false;
+
+				std::uint64_t const cells = (std::uint64_t) grid.columns * grid.rows + 1;
+
+				if(!this->contains(grid.cellStartOffset, cells * sizeof(std::int32_t))) return false;
+				if(!this->contains(grid.placementsOffset, (std::uint64_t) grid.placementCount * sizeof(PlacementIndex::Placement))) return false;
+
+				std::int32_t const * cellStart = (std::int32_t const *) (this->d_data + grid.cellStartOffset);
+
+				if(cellStart[0] != 0 || cellStart[cells - 1] != (std::int64_t) grid.placementCount) return false;
+
+				for(std::uint64_t k = 1; k < cells; k++)
+					if(cellStart[k] < cellStart[k - 1]) return false;
+
+				return true;
+			}
+
+			/**
+				\brief private member inline function
+
+				Checks magic, version, size and the bounds of all tables of the mapped image, the matrices and placements are not read
+
+				@return true if the image can be used in place, false otherwise
+			*/
+			bool inline validate() const
+			{
+				if(this->d_size < sizeof(Header)) return false;
+
+				Header const & h = this->header();
+
+				if(std::memcmp(h.magic, cnst::MODEL_IMAGE_MAGIC, sizeof(h.magic)) != 0) return false;
+				if(h.version != cnst::MODEL_IMAGE_VERSION || h.headerSize != sizeof(Header) || h.imageSize != this->d_size) return false;
+
+				if(!this->contains(h.componentsOffset, (std::uint64_t) h.componentCount * sizeof(Component))) return false;
+				if(!this->contains(h.boardName.offset, h.boardName.length) || !this->contains(h.boardDistRefsToCorners) || !this->contains(h.storageDistRefsToCorners)) return false;
+
+				for(std::uint32_t i = 0; i < h.componentCount; i++)
+				{
+					Component const & c = this->component(i);
+
+					if(!this->contains(c.name.offset, c.name.length) || !this->contains(c.coordinates) || !this->contains(c.grid)) return false;
+				}
+
+				return true;
+			}
+
+		public:
+
+			/**
+				explicit constructor
+
+				@param filepath a constant reference to a std::string containing the path of the compiled model image
+
+				Maps the file read only and validates its header and tables. The mapping is released again if the file is no valid model image
+
+				@see valid()
+				@see verify()
+			*/
+			explicit ModelImage(std::string const & filepath)
+				:
+					d_data(nullptr),
+					d_size(0)
+			{
+				int fd = open(filepath.c_str(), O_RDONLY);
+
+				if(fd < 0) return;
+
+				struct stat st;
+
+				if(fstat(fd, &st) == 0 && st.st_size > 0)
+				{
+					void * mapping = mmap(nullptr, (std::size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+					if(mapping != MAP_FAILED)
+					{
+						this->d_data = (unsigned char const *) mapping;
+						this->d_size = (std::size_t) st.st_size;
+					}
+				}
+
+				close(fd);
+
+				if(this->d_data != nullptr && !this->validate())
+				{
+					munmap((void *) this->d_data, this->d_size);
+
+					this->d_data = nullptr;
+					this->d_size = 0;
+				}
+			}
+
+			/**
+				default destructor
+
+				Releases the mapping
+			*/
+			~ModelImage()
+			{
+				if(this->d_data != nullptr) munmap((void *) this->d_data, this->d_size);
+			}
+
+			ModelImage(ModelImage const &) = delete;
+			ModelImage & operator=(ModelImage const &) = delete;
+
+			/**
+				\brief public member inline function
+
+				@return true if the file is mapped and is a valid model image, false otherwise
+			*/
+			bool inline valid() const
+			{
+				return this->d_data != nullptr;
+			}
+
+			/**
+				\brief public member inline function
+
+				Hashes every byte following the header, so the whole mapping is read. Meant for the model compiler and tools, not for loading on the device
+
+				@return true if the image is valid and its checksum matches, false otherwise
+			*/
+			bool inline verify() const
+			{
+				return this->valid() && ModelImage::checksum(this->d_data + sizeof(Header), this->d_size - sizeof(Header)) == this->header().checksum;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_size
+				@return a std::size_t containing the size of the mapped image in bytes
+			*/
+			std::size_t inline size() const
+			{
+				return this->d_size;
+			}
+
+			/**
+				\brief public member inline function
+
+				@return the Header of the image as constant reference
+			*/
+			Header inline const & header() const
+			{
+				return *(Header const *) this->d_data;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param index a std::uint32_t containing the index of the entry in the component table
+
+				@return the Component entry as constant reference
+			*/
+			Component inline const & component(std::uint32_t const index) const
+			{
+				return ((Component const *) (this->d_data + this->header().componentsOffset))[index];
+			}
+
+			/**
+				\brief public member inline function
+
+				@param s a constant reference to a String of the image
+
+				@return a std::string containing a copy of the string
+			*/
+			std::string inline string(String const & s) const
+			{
+				return std::string((char const *) (this->d_data + s.offset), s.length);
+			}
+
+			/**
+				\brief public member inline function
+
+				@param m a constant reference to a Matrix of the image
+
+				@return a cv::Mat of type CV_64F referencing the mapped doubles without copying them. The data is read only and must not be written
+			*/
+			cv::Mat inline matrix(Matrix const & m) const
+			{
+				return cv::Mat((int) m.rows, (int) m.cols, CV_64F, (void *) (this->d_data + m.offset));
+			}
+
+			/**
+				\brief public member inline function
+
+				@param index a std::uint32_t containing the index of the entry in the component table
+
+				@return an aux::PlacementIndex::GridView referencing the cell table and the placements of the component in the mapped image
+			*/
+			PlacementIndex::GridView inline grid(std::uint32_t const index) const
+			{
+				Grid const & g = this->component(index).grid;
+				PlacementIndex::GridView view = { g.columns, g.rows, g.cellWidth, g.cellHeight, g.maxCornerX, g.maxCornerY,
+					(int const *) (this->d_data + g.cellStartOffset), (PlacementIndex::Placement const *) (this->d_data + g.placementsOffset) };
+
+				return view;
+			}
+
+			/**
+				\brief public member inline function
+
+				@return a std::shared_ptr to an aux::CameraModel built for the calibrated image size, empty if the image carries no camera model
+			*/
+			std::shared_ptr<CameraModel const> inline camera() const
+			{
+				Header const & h = this->header();
+
+				if(h.cameraCalibrationSize[0] <= 0 || h.cameraCalibrationSize[1] <= 0) return std::shared_ptr<CameraModel const>();
+
+				cv::Matx33d cameraMatrix;
+				cv::Vec<double, cnst::CAMERA_DISTORTION_COEFFICIENTS> distortion;
+				cv::Size const size(h.cameraCalibrationSize[0], h.cameraCalibrationSize[1]);
+
+				for(int i = 0; i < 9; i++) cameraMatrix.val[i] = h.cameraMatrix[i];
+				for(int i = 0; i < cnst::CAMERA_DISTORTION_COEFFICIENTS; i++) distortion[i] = h.cameraDistortion[i];
+
+				return std::make_shared<CameraModel const>(cameraMatrix, distortion, size, size);
+			}
+
+			/**
+				\brief public static inline function
+
+				@param data a constant unsigned char pointer to the bytes to be hashed
+				@param size a std::size_t containing the number of bytes
+
+				@return a std::uint64_t containing the 64 bit FNV-1a hash of the bytes
+			*/
+			static std::uint64_t inline checksum(unsigned char const * data, std::size_t const size)
+			{
+				std::uint64_t hash = 14695981039346656037ULL;
+
+				for(std::size_t i = 0; i < size; i++)
+				{
+					hash ^= data[i];
+					hash *= 1099511628211ULL;
+				}
+
+				return hash;
+			}
+
+			/**
+				\brief public static inline function
+
+				@param board a constant reference to the aux::Board object to be compiled
+				@param storage a constant reference to the aux::Storage object to be compiled
+				@param boardFactors a constant reference to a std::vector of std::vectors containing the factors needed for assembly
+				@param storageFactors a constant reference to a std::vector of std::vectors containing the factors needed for withdrawal
+				@param camera a constant pointer to the aux::CameraModel of the configuration, nullptr if it has none
+
+				Lays out board, storage, factors, the placement grids of the board and the camera calibration as a model image. Matrices are converted to doubles
+
+				@return a std::vector of unsigned char containing the complete image including header and checksum
+			*/
+			static std::vector<unsigned char> compile(
+					Board<double> const & board,
+					Storage<double> const & storage,
+					std::vector<std::vector<double>> const & boardFactors,
+					std::vector<std::vector<double>> const & storageFactors,
+					CameraModel const * camera)
+			{
+				std::vector<unsigned char> image(sizeof(Header), 0);
+
+				struct Append
+				{
+					std::vector<unsigned char> & image;
+
+					std::uint64_t operator()(void const * bytes, std::size_t const size)
+					{
+						std::size_t offset = (image.size() + cnst::MODEL_IMAGE_ALIGNMENT - 1) / cnst::MODEL_IMAGE_ALIGNMENT * cnst::MODEL_IMAGE_ALIGNMENT;
+
+						image.resize(offset + size, 0);
+
+						if(size > 0) std::memcpy(&image[offset], bytes, size);
+
+						return offset;
+					}
+
+					String operator()(std::string const & s)
+					{
+						String result = { (*this)(s.data(), s.size()), (std::uint32_t) s.size(), 0 };
+						return result;
+					}
+
+					Matrix operator()(cv::Mat const & mat)
+					{
+						cv::Mat m;
+						mat.convertTo(m, CV_64F);
+						m = m.isContinuous() ? m : m.clone();
+
+						Matrix result = { (*this)(m.data, m.total() * sizeof(double)), (std::uint32_t) m.rows, (std::uint32_t) m.cols };
+						return result;
+					}
+				} append = { image };
+
+				Header h;
+				std::memset(&h, 0, sizeof(h));
+
+				PlacementIndex const index(board);
+
+				std::vector<Component> components(board.components().size());
+				std::memset(components.data(), 0, components.size() * sizeof(Component));
+
+				for(std::size_t i = 0; i < components.size(); i++)
+				{
+					aux::Component<double> const & c = board.components()[i];
+
+					components[i].name = append(c.name());
+					components[i].coordinates = append(c.coordinates());
+					components[i].width = c.width();
+					components[i].height = c.height();
+					components[i].occurrences = c.occurrences();
+					components[i].polarity = c.polarity() ? 1 : 0;
+					components[i].boxNum = c.boxNum();
+
+					PlacementIndex::GridView const g = index.grid((int) i);
+					std::size_t const cells = (std::size_t) g.columns * g.rows + 1;
+					std::size_t const placements = (std::size_t) g.cellStart[cells - 1];
+
+					components[i].grid.columns = g.columns;
+					components[i].grid.rows = g.rows;
+					components[i].grid.cellWidth = g.cellWidth;
+					components[i].grid.cellHeight = g.cellHeight;
+					components[i].grid.maxCornerX = g.maxCornerX;
+					components[i].grid.maxCornerY = g.maxCornerY;
+					components[i].grid.cellStartOffset = append(g.cellStart, cells * sizeof(int));
+					components[i].grid.placementsOffset = append(g.placements, placements * sizeof(PlacementIndex::Placement));
+					components[i].grid.placementCount = (std::uint32_t) placements;
+				}
+
+				h.componentsOffset = append(components.data(), components.size() * sizeof(Component));
+				h.componentCount = (std::uint32_t) components.size();
+
+				h.boardName = append(board.name());
+				h.rotated = board.rotated() ? 1 : 0;
+				h.markers = board.markers() ? 1 : 0;
+				h.boardDistRefsToCorners = append(board.distRefToCorners());
+				h.storageDistRefsToCorners = append(storage.distRefsToCorners());
+
+				for(int i = 0; i < 2; i++)
+				{
+					h.originXY[i] = board.originXY()[i];
+					h.refDimensions[i] = board.refDimensions()[i];
+					h.boardDimensions[i] = board.boardDimensions()[i];
+
+					h.storageMatrix[i] = storage.storageMatrix()[i];
+					h.refMidDimensions[i] = storage.refMidDimensions()[i];
+					h.refCornerDimensions[i] = storage.refCornerDimensions()[i];
+					h.boxOffsetXY[i] = storage.boxOffsetXY()[i];
+					h.boxDimensions[i] = storage.boxDimensions()[i];
+				}
+
+				for(int i = 0; i < cnst::NUMBER_CORNERS; i++)
+				{
+					for(int k = 0; k < 2; k++)
+					{
+						h.boardTargetPointsVectors[i][k] = boardFactors[i][k];
+						h.storageTargetPointsVectors[i][k] = storageFactors[i][k];
+					}
+				}
+
+				if(camera != nullptr)
+				{
+					h.cameraCalibrationSize[0] = camera->calibrationSize().width;
+					h.cameraCalibrationSize[1] = camera->calibrationSize().height;
+
+					for(int i = 0; i < 9; i++) h.cameraMatrix[i] = camera->cameraMatrix().val[i];
+					for(int i = 0; i < cnst::CAMERA_DISTORTION_COEFFICIENTS; i++) h.cameraDistortion[i] = camera->distortion()[i];
+				}
+
+				image.resize((image.size() + cnst::MODEL_IMAGE_ALIGNMENT - 1) / cnst::MODEL_IMAGE_ALIGNMENT * cnst::MODEL_IMAGE_ALIGNMENT, 0);
+
+				std::memcpy(h.magic, cnst::MODEL_IMAGE_MAGIC, sizeof(h.magic));
+				h.version = cnst::MODEL_IMAGE_VERSION;
+				h.headerSize = sizeof(Header);
+				h.imageSize = image.size();
+				h.checksum = ModelImage::checksum(&image[sizeof(Header)], image.size() - sizeof(Header));
+
+				std::memcpy(&image[0], &h, sizeof(Header));
+
+				return image;
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_MODELIMAGE_HPP_ */
@@ -0,0 +1,370 @@
+#ifndef AUXILIARYCLASSES_PERFCOUNTERS_HPP_
+#define AUXILIARYCLASSES_PERFCOUNTERS_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include "Constants.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+	opens a aux::PerfScope named name over pixels pixels until the end of the enclosing block if the software is built with BA_PERF, expands to nothing otherwise
+*/
+#ifdef BA_PERF
+#define PERF_SCOPE_CONCAT_(a, b) a ## b
+#define PERF_SCOPE_CONCAT(a, b) PERF_SCOPE_CONCAT_(a, b)
+#define PERF_SCOPE(name, pixels) aux::PerfScope PERF_SCOPE_CONCAT(perfScope, __LINE__)(name, pixels)
+#else
+#define PERF_SCOPE(name, pixels)
+#endif
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class PerfCounters
+		\brief PerfCounters class serving as the collector of hardware performance counters per pipeline stage
+
+		Usage: This class serves as the source of cycles, instructions, cache misses and branch misses of the stages of a frame!
+		Each thread opens its own group of counters via perf_event_open on first use, counting user space only,
+		so the counters work with the default perf_event_paranoid setting of Android. A stage reads the group when it begins and ends,
+		the differences are summed up per stage name together with the number of pixels processed.
+		The summary reports the mean per run, the instructions per cycle and the bytes per pixel estimated from the cache misses.
+		Counters which are not supported by the hardware read as 0, nothing is counted if the group cannot be opened at all.
+
+		@see Counter
+		@see Stage
+		@see aux::PerfScope
+		@see summary()
+	*/
+	class PerfCounters
+	{
+		public:
+
+			/**
+				\enum Counter
+				\brief the indices of the counted hardware events
+			*/
+			enum Counter
+			{
+				CYCLES,
+				INSTRUCTIONS,
+				CACHE_MISSES,
+				BRANCH_MISSES,
+				NUMBER_COUNTERS
+			};
+
+			/**
+				\struct Sample
+				\brief the values of all counters of the calling thread at one point in time, valid is false if the counters are not available
+			*/
+			struct Sample
+			{
+				std::uint64_t values[NUMBER_COUNTERS];
+				bool valid;
+			};
+
+		private:
+
+			/**
+				\struct Stage
+				\brief the summed up counter differences of all runs of a stage
+			*/
+			struct Stage
+			{
+				std::uint64_t runs;
+				std::uint64_t pixels;
+				std::uint64_t values[NUMBER_COUNTERS];
+			};
+
+			/**
+				\struct Group
+				\brief the counter group of a thread, fd contains the file descriptor of each counter or -1, closed when the thread ends
+			*/
+			struct Group
+			{
+				int fd[NUMBER_COUNTERS];
+				int slot[NUMBER_COUNTERS];
+				int opened;
+
+				Group() : opened(0)
+				{
+					for(int i = 0; i < NUMBER_COUNTERS; i++) fd[i] = slot[i] = -1;
+#ifdef __linux__
+					std::uint64_t const configs[NUMBER_COUNTERS] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+
+					for(int i = 0; i < NUMBER_COUNTERS; i++)
+					{
+						struct perf_event_attr attr;
+						std::memset(&attr, 0, sizeof(attr));
+
+						attr.size = sizeof(attr);
+						attr.type = PERF_TYPE_HARDWARE;
+						attr.config = configs[i];
+						attr.exclude_kernel = 1;
+						attr.exclude_hv = 1;
+						attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+						fd[i] = (int) syscall(__NR_perf_event_open, &attr, 0, -1, i == CYCLES ? -1 : fd[CYCLES], 0);
+
+						if(fd[i] >= 0) slot[i] = opened++;
+
+						if(i == CYCLES && fd[i] < 0) break;
+					}
+#endif
+				}
+
+				~Group()
+				{
+#ifdef __linux__
+					for(int i = NUMBER_COUNTERS - 1; i >= 0; i--)
+						if(fd[i] >= 0) close(fd[i]);
+#endif
+				}
+			};
+
+			/**
+				a std::map containing the summed up stages by name guarded by d_mutex
+			*/
+			std::map<std::string, Stage> d_stages;
+
+			/**
+				a std::mutex guarding the stages
+			*/
+			mutable std::mutex d_mutex;
+
+			/**
+				a std::atomic bool containing whether stages are counted (true) or not (false)
+			*/
+			std::atomic<bool> d_enabled;
+
+			/**
+				default constructor
+			*/
+			PerfCounters() : d_enabled(false) {}
+
+			/**
+				\brief private static inline function
+
+				@return a reference to the counter group of the calling thread, opened on first use
+			*/
+			static Group inline & group()
+			{
+				static thread_local Group local;
+
+				return local;
+			}
+
+		public:
+
+			PerfCounters(PerfCounters const &) = delete;
+			PerfCounters & operator=(PerfCounters const &) = delete;
+
+			/**
+				\brief public static inline function
+
+				@return a reference to the process wide aux::PerfCounters object
+			*/
+			static PerfCounters inline & shared()
+			{
+				static PerfCounters counters;
+
+				return counters;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param enabled a bool containing whether stages are counted from now on (true) or not (false)
+			*/
+			void inline enable(bool const enabled)
+			{
+				this->d_enabled.store(enabled, std::memory_order_relaxed);
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_enabled
+				@return true if stages are counted, false otherwise
+			*/
+			bool inline enabled() const
+			{
+				return this->d_enabled.load(std::memory_order_relaxed);
+			}
+
+			/**
+				\brief public member inline function
+
+				Discards all stages counted so far
+			*/
+			void inline clear()
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				this->d_stages.clear();
+			}
+
+			/**
+				\brief public static inline function
+
+				Reads the counter group of the calling thread with a single read, values of multiplexed groups are scaled to the enabled time
+
+				@return a Sample containing the current counter values of the calling thread
+			*/
+			static Sample inline sample()
+			{
+				Sample s;
+				std::memset(&s, 0, sizeof(s));
+#ifdef __linux__
+				Group & g = PerfCounters::group();
+
+				if(g.opened == 0) return s;
+
+				std::uint64_t buffer[3 + NUMBER_COUNTERS];
+
+				if(read(g.fd[CYCLES], buffer, sizeof(buffer)) < (ssize_t) ((3 + g.opened) * sizeof(std::uint64_t))) return s;
+
+				double const scale = buffer[2] > 0 && buffer[2] < buffer[1] ? (double) buffer[1] / buffer[2] : 1.0;
+
+				for(int i = 0; i < NUMBER_COUNTERS; i++)
+					if(g.slot[i] >= 0) s.values[i] = (std::uint64_t) (buffer[3 + g.slot[i]] * scale);
+
+				s.valid = true;
+#endif
+				return s;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param name a constant char pointer to the name of the stage
+				@param begin a constant reference to the Sample taken when the stage began
+				@param end a constant reference to the Sample taken when the stage ended
+				@param pixels a std::uint64_t containing the number of pixels processed by the stage
+
+				Adds the counter differences to the stage
+			*/
+			void inline record(char const * name, Sample const & begin, Sample const & end, std::uint64_t const pixels)
+			{
+				if(!begin.valid || !end.valid) return;
+
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				Stage & stage = this->d_stages[name];
+
+				stage.runs++;
+				stage.pixels += pixels;
+
+				for(int i = 0; i < NUMBER_COUNTERS; i++)
+					stage.values[i] += end.values[i] > begin.values[i] ? end.values[i] - begin.values[i] : 0;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see cnst::CACHE_LINE_SIZE
+				@return a std::string containing a JSON object with the number of runs, the mean counter values per run, the instructions per cycle,
+				the branch misses per thousand instructions and the bytes per pixel of each stage
+			*/
+			std::string inline summary() const
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+				std::ostringstream out;
+
+				out.precision(3);
+				out << std::fixed << "{";
+
+				for(std::map<std::string, Stage>::const_iterator it = this->d_stages.begin(); it != this->d_stages.end(); ++it)
+				{
+					Stage const & s = it->second;
+					double const runs = (double) s.runs;
+
+					out << (it == this->d_stages.begin() ? "\n" : ",\n") << "\"" << it->first << "\":{\"runs\":" << s.runs
+						<< ",\"cycles\":" << s.values[CYCLES] / runs
+						<< ",\"instructions\":" << s.values[INSTRUCTIONS] / runs
+						<< ",\"cacheMisses\":" << s.values[CACHE_MISSES] / runs
+						<< ",\"branchMisses\":" << s.values[BRANCH_MISSES] / runs
+						<< ",\"ipc\":" << (s.values[CYCLES] > 0 ? (double) s.values[INSTRUCTIONS] / s.values[CYCLES] : 0.0)
+						<< ",\"branchMissesPerKiloInstruction\":" << (s.values[INSTRUCTIONS] > 0 ? 1000.0 * s.values[BRANCH_MISSES] / s.values[INSTRUCTIONS] : 0.0)
+						<< ",\"bytesPerPixel\":" << (s.pixels > 0 ? (double) s.values[CACHE_MISSES] * cnst::CACHE_LINE_SIZE / s.pixels : 0.0) << "}";
+				}
+
+				out << "\n}";
+
+				return out.str();
+			}
+	};
+
+	/**
+		\class PerfScope
+		\brief PerfScope class serving as a scoped hardware counter measurement of a stage
+
+		Usage: This class serves as the measurement of a block, use it through PERF_SCOPE(name, pixels)!
+		Nothing is measured if counting is disabled when the block is entered.
+
+		@see aux::PerfCounters::record()
+	*/
+	class PerfScope
+	{
+		private:
+
+			/**
+				a constant char pointer to the name of the stage, nullptr if nothing is measured
+			*/
+			char const * d_name;
+
+			/**
+				a std::uint64_t containing the number of pixels processed by the stage
+			*/
+			std::uint64_t d_pixels;
+
+			/**
+				a PerfCounters::Sample containing the counter values when the stage began
+			*/
+			PerfCounters::Sample d_begin;
+
+		public:
+
+			/**
+				explicit constructor
+
+				@param name a constant char pointer to the name of the stage
+				@param pixels a std::uint64_t containing the number of pixels processed by the stage
+			*/
+			explicit PerfScope(char const * name, std::uint64_t const pixels)
+				:
+					d_name(PerfCounters::shared().enabled() ? name : nullptr),
+					d_pixels(pixels)
+			{
+				if(this->d_name != nullptr) this->d_begin = PerfCounters::sample();
+			}
+
+			/**
+				default destructor
+
+				Records the stage if it is measured
+			*/
+			~PerfScope()
+			{
+				if(this->d_name != nullptr) PerfCounters::shared().record(this->d_name, this->d_begin, PerfCounters::sample(), this->d_pixels);
+			}
+
+			PerfScope(PerfScope const &) = delete;
+			PerfScope & operator=(PerfScope const &) = delete;
+	};
+}
+
+#endif /* AUXILIARYCLASSES_PERFCOUNTERS_HPP_ */
@@ -0,0 +1,298 @@
+#ifndef AUXILIARYCLASSES_PLACEMENTINDEX_HPP_
+#define AUXILIARYCLASSES_PLACEMENTINDEX_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <opencv2/core/core.hpp>
+#include "Board.hpp"
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class PlacementIndex
+		\brief PlacementIndex class serving as a uniform grid over all placements of each component in board coordinates
+
+		Usage: This class serves as the spatial index used to find the placements of a component within a region of the board!
+		Each component gets its own grid over the board dimensions with about two placements per cell. A placement is stored once
+		in the cell containing its center, the placements of a grid are packed cell by cell so a query only touches the cells overlapping the region.
+		The location values of each placement are precomputed in the same way geo::assemblyPointsVector<T>() derives them.
+		Grids are either built and owned by the index or referenced as constant tables of a compiled in aux::BoardTable.
+
+		@see Placement
+		@see GridView
+		@see d_grids
+		@see d_tables
+		@see query()
+	*/
+	class PlacementIndex
+	{
+		public:
+
+			/**
+				\struct Placement
+				\brief the location values of one occurrence of a component as expected by geo::generateAssemblyLocation<T>()
+			*/
+			struct Placement
+			{
+				double coordX;
+				double coordY;
+				double mX;
+				double mY;
+				double cornerX;
+				double cornerY;
+			};
+
+			/**
+				\struct GridView
+				\brief a non owning view of the grid of one component, cellStart contains the index of the first placement of each cell and the total number of placements at the end
+
+				A GridView is a literal type, so the grids of compiled in boards are constant expressions
+			*/
+			struct GridView
+			{
+				int columns;
+				int rows;
+				double cellWidth;
+				double cellHeight;
+				double maxCornerX;
+				double maxCornerY;
+				int const * cellStart;
+				Placement const * placements;
+			};
+
+		private:
+
+			/**
+				\struct Grid
+				\brief the grid of one component, cellStart contains the index of the first placement of each cell and the total number of placements at the end
+			*/
+			struct Grid
+			{
+				int columns;
+				int rows;
+				double cellWidth;
+				double cellHeight;
+				double maxCornerX;
+				double maxCornerY;
+				std::vector<int> cellStart;
+				std::vector<Placement> placements;
+			};
+
+			/**
+				a std::vector containing one owned Grid for each component of the board, empty if the grids are referenced tables
+			*/
+			std::vector<Grid> d_grids;
+
+			/**
+				a std::vector containing one GridView for each component referencing constant tables, empty if the grids are owned
+			*/
+			std::vector<GridView> d_tables;
+
+			/**
+				\brief private static inline function
+
+				@param value a double containing a coordinate
+				@param cellSize a double containing the size of a cell along the coordinate
+				@param cells an int containing the number of cells along the coordinate
+
+				@return an int containing the index of the cell containing the coordinate clamped to the grid
+			*/
+			static int inline cell(double const value, double const cellSize, int const cells)
+			{
+				if(!(cellSize > 0)) return 0;
+
+				int index = (int) std::floor(value / cellSize);
+
+				return std::min(std::max(index, 0), cells - 1);
+			}
+
+		public:
+
+			/**
+				explicit constructor
+
+				@param board a constant reference to the aux::Board object to be indexed
+
+				Precomputes the location values of all placements of all components and sorts them into the grid of their component
+			*/
+			explicit PlacementIndex(Board<double> const & board)
+			{
+				double const boardWidth = board.boardDimensions()[0];
+				double const boardHeight = board.boardDimensions()[1];
+
+				for(std::size_t c = 0; c < board.components().size(); c++)
+				{
+					Component<double> const & component = board.components()[c];
+					cv::Mat coordinatesMatrix = component.coordinates();
+					int const n = component.occurrences();
+
+					Grid grid;
+					grid.columns = grid.rows = std::max(1, std::min(64, (int) std::ceil(std::sqrt(n / 2.0))));
+					grid.cellWidth = boardWidth / grid.columns;
+					grid.cellHeight = boardHeight / grid.rows;
+					grid.maxCornerX = grid.maxCornerY = 0;
+
+					std::vector<int> cells(n);
+					std::vector<Placement> placements(n);
+
+					grid.cellStart.assign(grid.columns * grid.rows + 1, 0);
+
+					for(int i = 0; i < n; i++)
+					{
+						Placement & p = placements[i];
+
+						p.coordX = board.rotated() ? std::abs(board.originXY()[0] - coordinatesMatrix.at<double>(i, 1)) : std::abs(board.originXY()[0] - coordinatesMatrix.at<double>(i, 0));
+						p.coordY = board.rotated() ? std::abs(board.originXY()[1] - coordinatesMatrix.at<double>(i, 0)) : std::abs(board.originXY()[1] - coordinatesMatrix.at<double>(i, 1));
+						p.mX = board.rotated() ? coordinatesMatrix.at<double>(i, 3) : coordinatesMatrix.at<double>(i, 2);
+						p.mY = board.rotated() ? coordinatesMatrix.at<double>(i, 2) : coordinatesMatrix.at<double>(i, 3);
+						p.cornerX = board.rotated() ? component.height() / 2 : component.width() / 2;
+						p.cornerY = board.rotated() ? component.width() / 2 : component.height() / 2;
+
+						grid.maxCornerX = std::max(grid.maxCornerX, std::abs(p.cornerX));
+						grid.maxCornerY = std::max(grid.maxCornerY, std::abs(p.cornerY));
+
+						cells[i] = PlacementIndex::cell(p.coordY + p.mY, grid.cellHeight, grid.rows) * grid.columns + PlacementIndex::cell(p.coordX + p.mX, grid.cellWidth, grid.columns);
+						grid.cellStart[cells[i] + 1]++;
+					}
+
+					for(std::size_t k = 1; k < grid.cellStart.size(); k++)
+						grid.cellStart[k] += grid.cellStart[k - 1];
+
+					std::vector<int> next(grid.cellStart.begin(), grid.cellStart.end() - 1);
+					grid.placements.resize(n);
+
+					for(int i = 0; i < n; i++)
+						grid.placements[next[cells[i]]++] = placements[i];
+
+					this->d_grids.push_back(grid);
+				}
+			}
+
+			/**
+				explicit constructor
+
+				@param grids a constant pointer to the first GridView of the constant grid tables
+				@param count an int containing the number of components
+
+				References the grid tables without copying them, the tables have to outlive the index
+			*/
+			explicit PlacementIndex(GridView const * grids, int const count) : d_tables(grids, grids + count) {}
+
+			/**
+				default constructor
+			*/
+			PlacementIndex() {}
+
+			/**
+				default destructor
+			*/
+			~PlacementIndex() {}
+
+			/**
+				\brief public member inline function
+
+				@param[out] result a reference to a std::vector to be filled with pointers to the found placements as function output
+				@param[in] compNum an int containing the number of the component
+				@param[in] region a constant reference to a cv::Rect_ of double containing the region of the board in board coordinates
+				@param[in] minimalExtent a double containing the size in board units below which a placement is skipped
+
+				Finds all placements of the component overlapping the region whose larger side is at least minimalExtent
+			*/
+			void inline query(std::vector<Placement const *> & result, int const compNum, cv::Rect_<double> const & region, double const minimalExtent) const
+			{
+				PlacementIndex::query(result, this->grid(compNum), region, minimalExtent);
+			}
+
+			/**
+				\brief public static inline function
+
+				@param[out] result a reference to a std::vector to be filled with pointers to the found placements as function output
+				@param[in] grid a constant reference to the GridView of the component
+				@param[in] region a constant reference to a cv::Rect_ of double containing the region of the board in board coordinates
+				@param[in] minimalExtent a double containing the size in board units below which a placement is skipped
+
+				Finds all placements of the grid overlapping the region whose larger side is at least minimalExtent
+			*/
+			static void inline query(std::vector<Placement const *> & result, GridView const & grid, cv::Rect_<double> const & region, double const minimalExtent)
+			{
+
+				double const left = region.x - grid.maxCornerX;
+				double const top = region.y - grid.maxCornerY;
+				double const right = region.x + region.width + grid.maxCornerX;
+				double const bottom = region.y + region.height + grid.maxCornerY;
+
+				int const firstColumn = PlacementIndex::cell(left, grid.cellWidth, grid.columns);
+				int const lastColumn = PlacementIndex::cell(right, grid.cellWidth, grid.columns);
+				int const firstRow = PlacementIndex::cell(top, grid.cellHeight, grid.rows);
+				int const lastRow = PlacementIndex::cell(bottom, grid.cellHeight, grid.rows);
+
+				for(int r = firstRow; r <= lastRow; r++)
+				{
+					for(int k = grid.cellStart[r * grid.columns + firstColumn]; k < grid.cellStart[r * grid.columns + lastColumn + 1]; k++)
+					{
+						Placement const & p = grid.placements[k];
+
+						double const cx = p.coordX + p.mX;
+						double const cy = p.coordY + p.mY;
+						double const hx = std::abs(p.cornerX);
+						double const hy = std::abs(p.cornerY);
+
+						if(2 * std::max(hx, hy) < minimalExtent) continue;
+
+						if(cx + hx < region.x || cx - hx > region.x + region.width || cy + hy < region.y || cy - hy > region.y + region.height) continue;
+
+						result.push_back(&p);
+					}
+				}
+			}
+
+			/**
+				\brief public member inline function
+
+				@param compNum an int containing the number of the component
+
+				@return the GridView of the component
+			*/
+			GridView inline grid(int const compNum) const
+			{
+				if(!this->d_tables.empty()) return this->d_tables[compNum];
+
+				Grid const & g = this->d_grids[compNum];
+				GridView view = { g.columns, g.rows, g.cellWidth, g.cellHeight, g.maxCornerX, g.maxCornerY, g.cellStart.data(), g.placements.data() };
+
+				return view;
+			}
+
+			/**
+				\brief public member inline function
+
+				@return an int containing the number of indexed components
+			*/
+			int inline size() const
+			{
+				return (int) (this->d_tables.empty() ? this->d_grids.size() : this->d_tables.size());
+			}
+
+			/**
+				\brief public member inline function
+
+				@return a std::size_t containing the number of bytes held by the grids
+			*/
+			std::size_t inline memorySize() const
+			{
+				std::size_t size = this->d_grids.size() * sizeof(Grid) + this->d_tables.size() * sizeof(GridView);
+
+				for(std::size_t i = 0; i < this->d_grids.size(); i++)
+					size += this->d_grids[i].cellStart.size() * sizeof(int) + this->d_grids[i].placements.size() * sizeof(Placement);
+
+				return size;
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_PLACEMENTINDEX_HPP_ */
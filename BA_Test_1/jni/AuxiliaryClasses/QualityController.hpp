@@ -0,0 +1,500 @@
+#ifndef AUXILIARYCLASSES_QUALITYCONTROLLER_HPP_
+#define AUXILIARYCLASSES_QUALITYCONTROLLER_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+#include <opencv2/core/core.hpp>
+#include "Constants.hpp"
+#ifdef __ANDROID__
+#include <android/log.h>
+#endif
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class QualityController
+		\brief QualityController class serving as the feedback loop holding the processing time of a camera stream within a budget per frame
+
+		Usage: This class serves as the quality setting of one aux::Session!
+		Every frame asks for a Plan before it is processed and reports the measured time of its detection, its overlay and in total afterwards.
+		The times are smoothed, if they exceed the budget for cnst::QUALITY_DEGRADE_FRAMES frames one setting is lowered, if they stay below
+		cnst::QUALITY_HEADROOM of the budget for cnst::QUALITY_UPGRADE_FRAMES frames the last lowered setting is raised again, until full quality is reached.
+		Settings are lowered in the order search window, detection cadence, pyramid level and overlay, a frame spending more time on the overlay than on
+		the detection lowers the overlay first. After every adjustment the next cnst::QUALITY_SETTLE_FRAMES frames are only measured. Every adjustment is logged.
+		The controller is disabled until a budget is configured, a disabled controller always plans full quality.
+
+		@see plan()
+		@see update()
+		@see configure()
+	*/
+	class QualityController
+	{
+		public:
+
+			/**
+				\enum Overlay
+				\brief the drawing quality of the overlay
+			*/
+			enum Overlay
+			{
+				OVERLAY_OUTLINE,
+				OVERLAY_BLENDED,
+				OVERLAY_FULL
+			};
+
+			/**
+				\struct Quality
+				\brief the adjustable settings of a frame
+			*/
+			struct Quality
+			{
+				/**
+					an int containing the number of times the frame is halved before the reference stickers are detected
+				*/
+				int pyramidLevel;
+
+				/**
+					an int containing every how many frames the reference stickers are detected, the frames in between reuse the last detected ones
+				*/
+				int cadence;
+
+				/**
+					a double containing the margin of the search window around the last detected reference stickers relative to their extent, 0 to search the whole frame
+				*/
+				double searchMargin;
+
+				/**
+					an Overlay containing the drawing quality of the overlay
+				*/
+				Overlay overlay;
+			};
+
+			/**
+				\struct Bounds
+				\brief the budget and the lowest quality the controller may choose
+			*/
+			struct Bounds
+			{
+				/**
+					a double containing the processing time per frame in milliseconds to be held, 0 or less disables the controller
+				*/
+				double budget;
+
+				/**
+					an int containing the highest pyramid level
+				*/
+				int maxPyramidLevel;
+
+				/**
+					an int containing the highest detection cadence
+				*/
+				int maxCadence;
+
+				/**
+					a double containing the smallest search window margin, 0 to always search the whole frame
+				*/
+				double minSearchMargin;
+
+				/**
+					an Overlay containing the lowest overlay quality
+				*/
+				Overlay minOverlay;
+			};
+
+			/**
+				\struct Plan
+				\brief the settings of one frame
+			*/
+			struct Plan
+			{
+				/**
+					a Quality containing the settings of the frame
+				*/
+				Quality quality;
+
+				/**
+					a bool containing whether the reference stickers are detected (true) or the last detected ones are reused (false)
+				*/
+				bool detect;
+
+				/**
+					a cv::Rect containing the part of the frame the reference stickers are searched in
+				*/
+				cv::Rect window;
+
+				/**
+					a std::vector containing the last detected reference points to be reused if they are not detected
+				*/
+				std::vector<cv::Point> references;
+			};
+
+		private:
+
+			/**
+				a std::mutex guarding all members, the bounds are configured by another thread than the one processing the frames
+			*/
+			mutable std::mutex d_mutex;
+
+			/**
+				the Bounds the controller adjusts the quality within
+			*/
+			Bounds d_bounds;
+
+			/**
+				the Quality of the following frames
+			*/
+			Quality d_quality;
+
+			/**
+				a std::vector containing the reference points of the last frame, empty if they were not found
+			*/
+			std::vector<cv::Point> d_references;
+
+			/**
+				an int containing the number of frames since the reference stickers were detected the last time
+			*/
+			int d_skipped;
+
+			/**
+				doubles containing the smoothed total, detection and overlay time per frame in milliseconds, 0 before the first frame
+			*/
+			double d_total, d_detection, d_overlay;
+
+			/**
+				ints containing the number of consecutive frames over the budget and within the headroom and the number of frames left to settle
+			*/
+			int d_over, d_under, d_settle;
+
+			/**
+				a std::uint64_t containing the number of adjustments since construction
+			*/
+			std::uint64_t d_adjustments;
+
+			/**
+				\brief private static inline function
+
+				@return the Quality of an unloaded device, which is the quality the controller starts with and returns to
+			*/
+			static Quality inline full()
+			{
+				Quality q;
+
+				q.pyramidLevel = cnst::DETECTION_PYRAMID_LEVEL;
+				q.cadence = 1;
+				q.searchMargin = 0.0;
+				q.overlay = OVERLAY_FULL;
+
+				return q;
+			}
+
+			/**
+				\brief private static inline function
+
+				@param value a double containing the current smoothed value, 0 before the first frame
+				@param sample a double containing the measured value of the frame
+
+				@return a double containing the exponentially smoothed value
+			*/
+			static double inline smooth(double const value, double const sample)
+			{
+				return value == 0.0 ? sample : value + cnst::QUALITY_SMOOTHING * (sample - value);
+			}
+
+			/**
+				\brief private member inline function
+
+				@param direction a constant char pointer containing either "lowered" or "raised"
+				@param setting a constant char pointer containing the name of the adjusted setting
+				@param from a double containing the value before the adjustment
+				@param to a double containing the value after the adjustment
+			*/
+			void inline log(char const * direction, char const * setting, double const from, double const to)
+			{
+				this->d_adjustments++;
+
+#ifdef __ANDROID__
+				__android_log_print(ANDROID_LOG_INFO, "quality", "%s %s from %g to %g at %.1f ms per frame (detection %.1f ms, overlay %.1f ms) for a budget of %.1f ms",
+					direction, setting, from, to, this->d_total, this->d_detection, this->d_overlay, this->d_bounds.budget);
+#else
+				std::fprintf(stderr, "quality: %s %s from %g to %g at %.1f ms per frame (detection %.1f ms, overlay %.1f ms) for a budget of %.1f ms\n",
+					direction, setting, from, to, this->d_total, this->d_detection, this->d_overlay, this->d_bounds.budget);
+#endif
+			}
+
+			/**
+				\brief private member inline function
+
+				Lowers one setting, the overlay first if it takes longer than the detection
+
+				@return true if a setting was lowered, false if the quality already is at its bounds
+			*/
+			bool inline lower()
+			{
+				Quality & q = this->d_quality;
+				Bounds const & b = this->d_bounds;
+
+				bool const overlayFirst = this->d_overlay > this->d_detection;
+
+				if(overlayFirst && q.overlay > b.minOverlay)
+				{
+					this->log("lowered", "overlay", q.overlay, q.overlay - 1);
+					q.overlay = (Overlay) (q.overlay - 1);
+				}
+				else if(b.minSearchMargin > 0.0 && (q.searchMargin == 0.0 || q.searchMargin / 2 >= b.minSearchMargin))
+				{
+					double const margin = q.searchMargin == 0.0 ? cnst::QUALITY_SEARCH_MARGIN : q.searchMargin / 2;
+
+					this->log("lowered", "search margin", q.searchMargin, margin);
+					q.searchMargin = margin;
+				}
+				else if(q.cadence < b.maxCadence)
+				{
+					this->log("lowered", "detection cadence", q.cadence, q.cadence + 1);
+					q.cadence++;
+				}
+				else if(q.pyramidLevel < b.maxPyramidLevel)
+				{
+					this->log("lowered", "pyramid level", q.pyramidLevel, q.pyramidLevel + 1);
+					q.pyramidLevel++;
+				}
+				else if(q.overlay > b.minOverlay)
+				{
+					this->log("lowered", "overlay", q.overlay, q.overlay - 1);
+					q.overlay = (Overlay) (q.overlay - 1);
+				}
+				else return false;
+
+				return true;
+			}
+
+			/**
+				\brief private member inline function
+
+				Raises one setting in the reverse order they are lowered in
+
+				@return true if a setting was raised, false if the quality already is full
+			*/
+			bool inline raise()
+			{
+				Quality & q = this->d_quality;
+				Quality const f = QualityController::full();
+
+				if(q.pyramidLevel > f.pyramidLevel)
+				{
+					this->log("raised", "pyramid level", q.pyramidLevel, q.pyramidLevel - 1);
+					q.pyramidLevel--;
+				}
+				else if(q.cadence > f.cadence)
+				{
+					this->log("raised", "detection cadence", q.cadence, q.cadence - 1);
+					q.cadence--;
+				}
+				else if(q.searchMargin != f.searchMargin)
+				{
+					double const margin = q.searchMargin * 2 > cnst::QUALITY_SEARCH_MARGIN ? f.searchMargin : q.searchMargin * 2;
+
+					this->log("raised", "search margin", q.searchMargin, margin);
+					q.searchMargin = margin;
+				}
+				else if(q.overlay < f.overlay)
+				{
+					this->log("raised", "overlay", q.overlay, q.overlay + 1);
+					q.overlay = (Overlay) (q.overlay + 1);
+				}
+				else return false;
+
+				return true;
+			}
+
+		public:
+
+			/**
+				default constructor
+
+				Starts disabled at full quality with the default bounds of cnst::QUALITY_MAX_PYRAMID_LEVEL, cnst::QUALITY_MAX_CADENCE and cnst::QUALITY_MIN_SEARCH_MARGIN
+			*/
+			QualityController()
+				:
+					d_skipped(0),
+					d_total(0.0),
+					d_detection(0.0),
+					d_overlay(0.0),
+					d_over(0),
+					d_under(0),
+					d_settle(0),
+					d_adjustments(0)
+			{
+				this->d_bounds.budget = 0.0;
+				this->d_bounds.maxPyramidLevel = cnst::QUALITY_MAX_PYRAMID_LEVEL;
+				this->d_bounds.maxCadence = cnst::QUALITY_MAX_CADENCE;
+				this->d_bounds.minSearchMargin = cnst::QUALITY_MIN_SEARCH_MARGIN;
+				this->d_bounds.minOverlay = OVERLAY_OUTLINE;
+				this->d_quality = QualityController::full();
+			}
+
+			/**
+				default destructor
+			*/
+			~QualityController() {}
+
+			/**
+				\brief public member inline function
+
+				@param bounds a constant reference to the Bounds to adjust the quality within, a budget of 0 or less disables the controller
+
+				Restarts the measurement at full quality
+			*/
+			void inline configure(Bounds const & bounds)
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				this->d_bounds = bounds;
+				this->d_bounds.maxPyramidLevel = std::max(bounds.maxPyramidLevel, (int) cnst::DETECTION_PYRAMID_LEVEL);
+				this->d_bounds.maxCadence = std::max(bounds.maxCadence, 1);
+				this->d_bounds.minSearchMargin = std::min(std::max(bounds.minSearchMargin, 0.0), cnst::QUALITY_SEARCH_MARGIN);
+				this->d_quality = QualityController::full();
+				this->d_references.clear();
+				this->d_skipped = 0;
+				this->d_total = this->d_detection = this->d_overlay = 0.0;
+				this->d_over = this->d_under = this->d_settle = 0;
+			}
+
+			/**
+				\brief public member inline function
+
+				@return the Bounds the controller adjusts the quality within
+			*/
+			Bounds inline bounds() const
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				return this->d_bounds;
+			}
+
+			/**
+				\brief public member inline function
+
+				@return the Quality of the following frames
+			*/
+			Quality inline quality() const
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				return this->d_quality;
+			}
+
+			/**
+				\brief public member inline function
+
+				@return a std::uint64_t containing the number of adjustments since construction
+			*/
+			std::uint64_t inline adjustments() const
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				return this->d_adjustments;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param size a constant reference to a cv::Size object containing the dimensions of the frame
+				@param objects a constant int containing the number of storages and boards whose reference stickers the frame needs
+
+				Plans the frame to be processed, the reference stickers are always detected in the whole frame while they are not found.
+				The last reference points are only reused if they belong to as many objects as the frame needs, so a switch between a single
+				and the combined action detects again. The search window is the bounding rectangle of the last reference points grown by the search margin
+				and aligned to the pyramid level. Has to be called by the thread processing the frames
+
+				@return the Plan of the frame
+			*/
+			Plan inline plan(cv::Size const & size, int const objects = 1)
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				bool const enabled = this->d_bounds.budget > 0.0;
+				bool const tracked = this->d_references.size() == (std::size_t) objects * cnst::NUMBER_CORNERS;
+
+				Plan p;
+
+				p.quality = enabled ? this->d_quality : QualityController::full();
+				p.detect = !enabled || !tracked || this->d_skipped + 1 >= p.quality.cadence;
+				p.window = cv::Rect(0, 0, size.width, size.height);
+
+				this->d_skipped = p.detect ? 0 : this->d_skipped + 1;
+
+				if(!p.detect) p.references = this->d_references;
+
+				if(enabled && tracked && p.quality.searchMargin > 0.0)
+				{
+					cv::Rect const extent = cv::boundingRect(this->d_references);
+
+					int const align = 1 << p.quality.pyramidLevel;
+					int const margin = (int) (p.quality.searchMargin * std::max(extent.width, extent.height));
+					int const left = std::max(0, extent.x - margin) / align * align;
+					int const top = std::max(0, extent.y - margin) / align * align;
+					int const right = std::min(size.width, extent.x + extent.width + margin);
+					int const bottom = std::min(size.height, extent.y + extent.height + margin);
+
+					if(right - left >= align && bottom - top >= align) p.window = cv::Rect(left, top, right - left, bottom - top);
+				}
+
+				return p;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param references a constant reference to a std::vector containing cv::Point objects depicting the reference points of all objects found in the frame, empty if none was found
+				@param detection a std::int64_t containing the nanoseconds the color correction and detection took
+				@param overlay a std::int64_t containing the nanoseconds the overlay took
+				@param total a std::int64_t containing the nanoseconds the whole frame took
+
+				Accounts the frame and adjusts the quality of the following frames. Has to be called by the thread processing the frames after plan()
+			*/
+			void inline update(std::vector<cv::Point> const & references, std::int64_t const detection, std::int64_t const overlay, std::int64_t const total)
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				if(this->d_bounds.budget <= 0.0) return;
+
+				if(!references.empty() && references.size() % cnst::NUMBER_CORNERS == 0)
+					this->d_references = references;
+				else
+					this->d_references.clear();
+
+				this->d_total = QualityController::smooth(this->d_total, total / 1e6);
+				this->d_detection = QualityController::smooth(this->d_detection, detection / 1e6);
+				this->d_overlay = QualityController::smooth(this->d_overlay, overlay / 1e6);
+
+				if(this->d_settle > 0)
+				{
+					this->d_settle--;
+
+					return;
+				}
+
+				this->d_over = this->d_total > this->d_bounds.budget ? this->d_over + 1 : 0;
+				this->d_under = this->d_total < cnst::QUALITY_HEADROOM * this->d_bounds.budget ? this->d_under + 1 : 0;
+
+				bool adjusted = false;
+
+				if(this->d_over >= cnst::QUALITY_DEGRADE_FRAMES) adjusted = this->lower();
+				else if(this->d_under >= cnst::QUALITY_UPGRADE_FRAMES) adjusted = this->raise();
+
+				if(adjusted)
+				{
+					this->d_over = this->d_under = 0;
+					this->d_settle = cnst::QUALITY_SETTLE_FRAMES;
+				}
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_QUALITYCONTROLLER_HPP_ */
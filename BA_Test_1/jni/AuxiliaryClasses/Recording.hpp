@@ -0,0 +1,757 @@
+#ifndef AUXILIARYCLASSES_RECORDING_HPP_
+#define AUXILIARYCLASSES_RECORDING_HPP_
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+#include "FrameResult.hpp"
+#include "Constants.hpp"
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class Recording
+		\brief Recording class serving as the description of the append only recording container of frames and pipeline results
+
+		Usage: This class serves as the file format shared by aux::RecordingWriter and aux::RecordingReader!
+		A recording starts with a FileHeader followed by one record per frame. A record starts with a FrameHeader followed by the raw frame,
+		the reference and outline points as pairs of int32 and the overlay polygons as their point counts followed by their points.
+		All sections are aligned to cnst::RECORDING_ALIGNMENT relative to the start of the file, so a frame is used in place after mapping.
+		There is no index, the reader follows the record sizes once when opening, so a recording cut off by a crash stays readable up to its last complete record.
+
+		@see FileHeader
+		@see FrameHeader
+	*/
+	class Recording
+	{
+		public:
+
+			/**
+				\enum Action
+				\brief the pipeline a frame was processed by
+			*/
+			enum Action
+			{
+				WITHDRAWAL,
+				IMPLEMENTATION
+			};
+
+			/**
+				\enum Format
+				\brief the pixel format of a recorded frame
+			*/
+			enum Format
+			{
+				RGBA,
+				NV21
+			};
+
+			/**
+				\struct FileHeader
+				\brief the header at the start of the recording
+			*/
+			struct FileHeader
+			{
+				char magic[8];
+				std::uint32_t version;
+				std::uint32_t headerSize;
+				std::uint32_t frameHeaderSize;
+				std::uint32_t alignment;
+				std::uint8_t reserved[40];
+			};
+
+			/**
+				\struct FrameHeader
+				\brief the header of a record, all offsets are relative to the start of the record
+			*/
+			struct FrameHeader
+			{
+				std::uint64_t recordSize;
+				std::int64_t timestamp;
+				std::int32_t action;
+				std::int32_t componentNumber;
+				std::int32_t processed;
+				std::int32_t format;
+				std::int32_t width;
+				std::int32_t height;
+				double blueFactor;
+				double redFactor;
+				std::uint64_t imageOffset;
+				std::uint64_t imageSize;
+				std::uint64_t pointsOffset;
+				std::uint32_t referencePointCount;
+				std::uint32_t outlinePointCount;
+				std::uint64_t overlayOffset;
+				std::uint32_t polygonCount;
+				std::uint32_t polygonPointCount;
+				std::uint8_t reserved[24];
+			};
+
+			static_assert(std::is_standard_layout<FileHeader>::value && sizeof(FileHeader) % cnst::RECORDING_ALIGNMENT == 0, "Recording::FileHeader layout");
+			static_assert(std::is_standard_layout<FrameHeader>::value && sizeof(FrameHeader) % cnst::RECORDING_ALIGNMENT == 0, "Recording::FrameHeader layout");
+
+			/**
+				\brief public static inline function
+
+				@param size a std::size_t containing a size or offset in bytes
+
+				@return a std::size_t containing the size rounded up to cnst::RECORDING_ALIGNMENT
+			*/
+			static std::size_t inline align(std::size_t const size)
+			{
+				return (size + cnst::RECORDING_ALIGNMENT - 1) / cnst::RECORDING_ALIGNMENT * cnst::RECORDING_ALIGNMENT;
+			}
+
+			/**
+				\brief public static inline function
+
+				@return a std::int64_t containing the time of the steady clock in nanoseconds
+			*/
+			static std::int64_t inline now()
+			{
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+			}
+	};
+
+	/**
+		\class RecordingWriter
+		\brief RecordingWriter class serving as the low overhead writer of a recording on a background thread
+
+		Usage: This class serves as the recorder of a camera stream, attach it to the aux::Session of the stream!
+		capture() copies the raw frame into a recycled buffer before the pipeline modifies it, commit() appends the results and hands the record
+		to the writer thread. The processing thread never waits for the storage: if cnst::RECORDING_QUEUE_CAPACITY records are pending,
+		the record is dropped and counted. NV21 frames are converted from RGBA and take 1.5 instead of 4 bytes per pixel,
+		they are not replayed exactly because the conversion is lossy.
+
+		@see aux::Recording
+		@see capture()
+		@see commit()
+	*/
+	class RecordingWriter
+	{
+		public:
+
+			/**
+				\struct Frame
+				\brief a record being built, owns the buffer until it is committed
+			*/
+			struct Frame
+			{
+				std::vector<unsigned char> buffer;
+				int format;
+				int width;
+				int height;
+			};
+
+		private:
+
+			/**
+				an int containing the file descriptor of the recording, -1 if it could not be created
+			*/
+			int d_fd;
+
+			/**
+				a bool containing whether frames are converted to NV21 (true) or kept as RGBA (false)
+			*/
+			bool d_nv21;
+
+			/**
+				a std::deque containing the committed records which are not written yet, guarded by d_mutex
+			*/
+			std::deque<std::vector<unsigned char>> d_pending;
+
+			/**
+				a std::vector containing written buffers to be reused by capture(), guarded by d_mutex
+			*/
+			std::vector<std::vector<unsigned char>> d_free;
+
+			/**
+				a std::mutex guarding the pending and free buffers
+			*/
+			std::mutex d_mutex;
+
+			/**
+				a std::condition_variable waking the writer thread
+			*/
+			std::condition_variable d_condition;
+
+			/**
+				a bool containing whether the writer thread has to finish after writing all pending records, guarded by d_mutex
+			*/
+			bool d_done;
+
+			/**
+				a std::atomic containing the number of written records
+			*/
+			std::atomic<std::uint64_t> d_written;
+
+			/**
+				a std::atomic containing the number of records dropped because the queue was full or writing failed
+			*/
+			std::atomic<std::uint64_t> d_dropped;
+
+			/**
+				a std::thread writing the pending records
+			*/
+			std::thread d_writer;
+
+			/**
+				\brief private static inline function
+
+				@param fd an int containing the file descriptor
+				@param data a constant pointer to the bytes to be written
+				@param size a std::size_t containing the number of bytes
+
+				@return true if all bytes were written, false otherwise
+			*/
+			static bool inline writeAll(int const fd, void const * data, std::size_t size)
+			{
+				unsigned char const * bytes = (unsigned char const *) data;
+
+				while(size > 0)
+				{
+					ssize_t n = write(fd, bytes, size);
+
+					if(n < 0 && errno == EINTR) continue;
+					if(n <= 0) return false;
+
+					bytes += n;
+					size -= (std::size_t) n;
+				}
+
+				return true;
+			}
+
+			/**
+				\brief private member inline function
+
+				Writes the pending records in commit order until the writer is destroyed
+			*/
+			void inline writerLoop()
+			{
+				std::unique_lock<std::mutex> lock(this->d_mutex);
+
+				for(;;)
+				{
+					this->d_condition.wait(lock, [this] { return this->d_done || !this->d_pending.empty(); });
+
+					if(this->d_pending.empty()) return;
+
+					std::vector<unsigned char> record = std::move(this->d_pending.front());
+					this->d_pending.pop_front();
+
+					lock.unlock();
+
+					bool const written = RecordingWriter::writeAll(this->d_fd, record.data(), record.size());
+
+					(written ? this->d_written : this->d_dropped)++;
+
+					lock.lock();
+
+					this->d_free.push_back(std::move(record));
+				}
+			}
+
+			/**
+				\brief private static inline function
+
+				@param[out] record a reference to the buffer of the record to be extended as function output
+				@param[in] points a constant reference to a std::vector containing the cv::Point objects to be appended as pairs of int32
+			*/
+			static void inline appendPoints(std::vector<unsigned char> & record, std::vector<cv::Point> const & points)
+			{
+				std::size_t offset = record.size();
+
+				record.resize(offset + points.size() * 2 * sizeof(std::int32_t));
+
+				std::int32_t * out = (std::int32_t *) &record[offset];
+
+				for(std::size_t i = 0; i < points.size(); i++)
+				{
+					out[2 * i] = points[i].x;
+					out[2 * i + 1] = points[i].y;
+				}
+			}
+
+		public:
+
+			/**
+				explicit constructor
+
+				@param filepath a constant reference to a std::string containing the path of the recording to be created
+				@param nv21 a bool containing whether frames are stored as NV21 (true) or RGBA (false)
+
+				Creates or truncates the file, writes the FileHeader and starts the writer thread
+
+				@see valid()
+			*/
+			explicit RecordingWriter(std::string const & filepath, bool const nv21)
+				:
+					d_fd(open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)),
+					d_nv21(nv21),
+					d_done(false),
+					d_written(0),
+					d_dropped(0)
+			{
+				if(this->d_fd < 0) return;
+
+				Recording::FileHeader h;
+				std::memset(&h, 0, sizeof(h));
+
+				std::memcpy(h.magic, cnst::RECORDING_MAGIC, sizeof(h.magic));
+				h.version = cnst::RECORDING_VERSION;
+				h.headerSize = sizeof(Recording::FileHeader);
+				h.frameHeaderSize = sizeof(Recording::FrameHeader);
+				h.alignment = cnst::RECORDING_ALIGNMENT;
+
+				if(!RecordingWriter::writeAll(this->d_fd, &h, sizeof(h)))
+				{
+					close(this->d_fd);
+					this->d_fd = -1;
+					return;
+				}
+
+				this->d_writer = std::thread(&RecordingWriter::writerLoop, this);
+			}
+
+			/**
+				default destructor
+
+				Writes all pending records, joins the writer thread and closes the file
+			*/
+			~RecordingWriter()
+			{
+				if(this->d_fd < 0) return;
+
+				{
+					std::lock_guard<std::mutex> lock(this->d_mutex);
+					this->d_done = true;
+				}
+
+				this->d_condition.notify_one();
+				this->d_writer.join();
+
+				close(this->d_fd);
+			}
+
+			RecordingWriter(RecordingWriter const &) = delete;
+			RecordingWriter & operator=(RecordingWriter const &) = delete;
+
+			/**
+				\brief public member inline function
+
+				@return true if the recording was created, false otherwise
+			*/
+			bool inline valid() const
+			{
+				return this->d_fd >= 0;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_written
+				@return a std::uint64_t containing the number of records written so far
+			*/
+			std::uint64_t inline written() const
+			{
+				return this->d_written.load(std::memory_order_relaxed);
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_dropped
+				@return a std::uint64_t containing the number of records dropped so far
+			*/
+			std::uint64_t inline dropped() const
+			{
+				return this->d_dropped.load(std::memory_order_relaxed);
+			}
+
+			/**
+				\brief public member inline function
+
+				@param[out] frame a reference to the Frame to be started as function output
+				@param[in] rgba a constant reference to a cv::Mat of type CV_8UC4 containing the frame before it is processed
+
+				Takes a recycled buffer and copies the pixels behind the space reserved for the FrameHeader, converted to NV21 if configured.
+				NV21 needs an even width and height like every camera preview size
+			*/
+			void inline capture(Frame & frame, cv::Mat const & rgba)
+			{
+				{
+					std::lock_guard<std::mutex> lock(this->d_mutex);
+
+					if(!this->d_free.empty())
+					{
+						frame.buffer = std::move(this->d_free.back());
+						this->d_free.pop_back();
+					}
+				}
+
+				frame.width = rgba.cols;
+				frame.height = rgba.rows;
+				frame.format = this->d_nv21 ? Recording::NV21 : Recording::RGBA;
+
+				std::size_t const rowBytes = this->d_nv21 ? (std::size_t) rgba.cols : (std::size_t) rgba.cols * 4;
+				std::size_t const rows = this->d_nv21 ? (std::size_t) rgba.rows * 3 / 2 : (std::size_t) rgba.rows;
+
+				frame.buffer.resize(sizeof(Recording::FrameHeader) + rows * rowBytes);
+
+				cv::Mat image((int) rows, rgba.cols, this->d_nv21 ? CV_8UC1 : CV_8UC4, &frame.buffer[sizeof(Recording::FrameHeader)]);
+
+				if(!this->d_nv21)
+				{
+					rgba.copyTo(image);
+					return;
+				}
+
+				cv::Mat i420;
+				cv::cvtColor(rgba, i420, cv::COLOR_RGBA2YUV_I420);
+
+				std::size_t const luma = (std::size_t) rgba.cols * rgba.rows;
+				std::size_t const chroma = luma / 4;
+				unsigned char const * planes = i420.data;
+				unsigned char * out = image.data;
+
+				std::memcpy(out, planes, luma);
+
+				for(std::size_t i = 0; i < chroma; i++)
+				{
+					out[luma + 2 * i] = planes[luma + chroma + i];
+					out[luma + 2 * i + 1] = planes[luma + i];
+				}
+			}
+
+			/**
+				\brief public member inline function
+
+				@param frame a reference to the Frame started by capture(), its buffer is handed over
+				@param action an int containing the Recording::Action the frame was processed by
+				@param componentNumber an int containing the component number passed to the pipeline
+				@param timestamp a std::int64_t containing the time of the frame in nanoseconds
+				@param blueFactor a double containing the blue color correction factor the frame was processed with
+				@param redFactor a double containing the red color correction factor the frame was processed with
+				@param result a constant reference to the aux::FrameResult of the frame
+
+				Appends the results, fills the FrameHeader and queues the record for the writer thread
+
+				@return true if the record was queued, false if it was dropped because too many records are pending
+			*/
+			bool inline commit(Frame & frame, int const action, int const componentNumber, std::int64_t const timestamp, double const blueFactor, double const redFactor, FrameResult const & result)
+			{
+				std::vector<unsigned char> & record = frame.buffer;
+
+				Recording::FrameHeader h;
+				std::memset(&h, 0, sizeof(h));
+
+				h.timestamp = timestamp;
+				h.action = action;
+				h.componentNumber = componentNumber;
+				h.processed = result.processed ? 1 : 0;
+				h.format = frame.format;
+				h.width = frame.width;
+				h.height = frame.height;
+				h.blueFactor = blueFactor;
+				h.redFactor = redFactor;
+				h.imageOffset = sizeof(Recording::FrameHeader);
+				h.imageSize = record.size() - sizeof(Recording::FrameHeader);
+
+				record.resize(Recording::align(record.size()), 0);
+
+				h.pointsOffset = record.size();
+				h.referencePointCount = (std::uint32_t) result.referencePoints.size();
+				h.outlinePointCount = (std::uint32_t) result.outline.size();
+
+				RecordingWriter::appendPoints(record, result.referencePoints);
+				RecordingWriter::appendPoints(record, result.outline);
+
+				record.resize(Recording::align(record.size()), 0);
+
+				h.overlayOffset = record.size();
+				h.polygonCount = (std::uint32_t) result.overlay.size();
+
+				std::size_t offset = record.size();
+				record.resize(offset + result.overlay.size() * sizeof(std::uint32_t));
+
+				for(std::size_t i = 0; i < result.overlay.size(); i++)
+				{
+					std::uint32_t const count = (std::uint32_t) result.overlay[i].size();
+
+					std::memcpy(&record[offset + i * sizeof(std::uint32_t)], &count, sizeof(count));
+					h.polygonPointCount += count;
+				}
+
+				for(std::size_t i = 0; i < result.overlay.size(); i++)
+					RecordingWriter::appendPoints(record, result.overlay[i]);
+
+				record.resize(Recording::align(record.size()), 0);
+
+				h.recordSize = record.size();
+				std::memcpy(&record[0], &h, sizeof(h));
+
+				{
+					std::lock_guard<std::mutex> lock(this->d_mutex);
+
+					if(this->d_pending.size() >= (std::size_t) cnst::RECORDING_QUEUE_CAPACITY)
+					{
+						this->d_free.push_back(std::move(record));
+						this->d_dropped++;
+						return false;
+					}
+
+					this->d_pending.push_back(std::move(record));
+				}
+
+				this->d_condition.notify_one();
+
+				return true;
+			}
+	};
+
+	/**
+		\class RecordingReader
+		\brief RecordingReader class serving as a read only, memory mapped view of a recording with random access by frame index
+
+		Usage: This class serves as the source of replayed frames!
+		The recording is mapped once and the offsets of all complete records are collected, frames and points are then used in place.
+		Records which are cut off or inconsistent end the recording.
+
+		@see aux::Recording
+		@see frame()
+		@see result()
+	*/
+	class RecordingReader
+	{
+		private:
+
+			/**
+				a constant unsigned char pointer to the start of the mapped recording, nullptr if mapping or validation failed
+			*/
+			unsigned char const * d_data;
+
+			/**
+				a std::size_t containing the size of the mapping in bytes
+			*/
+			std::size_t d_size;
+
+			/**
+				a std::vector containing the offset of each complete record
+			*/
+			std::vector<std::size_t> d_records;
+
+			/**
+				\brief private member inline function
+
+				@param offset a std::size_t containing the offset of a record
+
+				@return true if the record is complete and all its sections lie within it, false otherwise
+			*/
+			bool inline complete(std::size_t const offset) const
+			{
+				if(this->d_size - offset < sizeof(Recording::FrameHeader)) return false;
+
+				Recording::FrameHeader const & h = *(Recording::FrameHeader const *) (this->d_data + offset);
+				std::uint64_t const size = h.recordSize;
+				std::uint64_t const pixels = (std::uint64_t) h.width * h.height;
+
+				if(h.width <= 0 || h.height <= 0 || size % cnst::RECORDING_ALIGNMENT != 0 || size > this->d_size - offset) return false;
+				if(h.imageSize != (h.format == Recording::NV21 ? pixels * 3 / 2 : pixels * 4) || h.imageOffset + h.imageSize > size) return false;
+				if(h.pointsOffset + ((std::uint64_t) h.referencePointCount + h.outlinePointCount) * 2 * sizeof(std::int32_t) > size) return false;
+
+				if(h.overlayOffset + h.polygonCount * sizeof(std::uint32_t) + (std::uint64_t) h.polygonPointCount * 2 * sizeof(std::int32_t) > size) return false;
+
+				std::uint32_t const * counts = (std::uint32_t const *) (this->d_data + offset + h.overlayOffset);
+				std::uint64_t points = 0;
+
+				for(std::uint32_t i = 0; i < h.polygonCount; i++) points += counts[i];
+
+				return points == h.polygonPointCount;
+			}
+
+		public:
+
+			/**
+				explicit constructor
+
+				@param filepath a constant reference to a std::string containing the path of the recording
+
+				Maps the file read only, validates the FileHeader and collects the complete records
+
+				@see valid()
+			*/
+			explicit RecordingReader(std::string const & filepath)
+				:
+					d_data(nullptr),
+					d_size(0)
+			{
+				int fd = open(filepath.c_str(), O_RDONLY);
+
+				if(fd < 0) return;
+
+				struct stat st;
+
+				if(fstat(fd, &st) == 0 && (std::size_t) st.st_size >= sizeof(Recording::FileHeader))
+				{
+					void * mapping = mmap(nullptr, (std::size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+					if(mapping != MAP_FAILED)
+					{
+						this->d_data = (unsigned char const *) mapping;
+						this->d_size = (std::size_t) st.st_size;
+					}
+				}
+
+				close(fd);
+
+				if(this->d_data == nullptr) return;
+
+				Recording::FileHeader const & h = *(Recording::FileHeader const *) this->d_data;
+
+				if(std::memcmp(h.magic, cnst::RECORDING_MAGIC, sizeof(h.magic)) != 0 || h.version != cnst::RECORDING_VERSION
+					|| h.headerSize != sizeof(Recording::FileHeader) || h.frameHeaderSize != sizeof(Recording::FrameHeader) || h.alignment != cnst::RECORDING_ALIGNMENT)
+				{
+					munmap((void *) this->d_data, this->d_size);
+
+					this->d_data = nullptr;
+					this->d_size = 0;
+					return;
+				}
+
+				std::size_t offset = sizeof(Recording::FileHeader);
+
+				while(offset < this->d_size && this->complete(offset))
+				{
+					this->d_records.push_back(offset);
+					offset += ((Recording::FrameHeader const *) (this->d_data + offset))->recordSize;
+				}
+			}
+
+			/**
+				default destructor
+
+				Releases the mapping
+			*/
+			~RecordingReader()
+			{
+				if(this->d_data != nullptr) munmap((void *) this->d_data, this->d_size);
+			}
+
+			RecordingReader(RecordingReader const &) = delete;
+			RecordingReader & operator=(RecordingReader const &) = delete;
+
+			/**
+				\brief public member inline function
+
+				@return true if the file is mapped and is a recording, false otherwise
+			*/
+			bool inline valid() const
+			{
+				return this->d_data != nullptr;
+			}
+
+			/**
+				\brief public member inline function
+
+				@return a std::size_t containing the number of complete records
+			*/
+			std::size_t inline size() const
+			{
+				return this->d_records.size();
+			}
+
+			/**
+				\brief public member inline function
+
+				@param index a std::size_t containing the index of the frame
+
+				@return the Recording::FrameHeader of the frame as constant reference
+			*/
+			Recording::FrameHeader inline const & header(std::size_t const index) const
+			{
+				return *(Recording::FrameHeader const *) (this->d_data + this->d_records[index]);
+			}
+
+			/**
+				\brief public member inline function
+
+				@param index a std::size_t containing the index of the frame
+
+				@return a cv::Mat referencing the mapped pixels without copying them, CV_8UC4 for RGBA and CV_8UC1 with 1.5 times the rows for NV21.
+				The data is read only and must not be written
+			*/
+			cv::Mat inline frame(std::size_t const index) const
+			{
+				Recording::FrameHeader const & h = this->header(index);
+				void * data = (void *) (this->d_data + this->d_records[index] + h.imageOffset);
+
+				if(h.format == Recording::NV21) return cv::Mat(h.height * 3 / 2, h.width, CV_8UC1, data);
+
+				return cv::Mat(h.height, h.width, CV_8UC4, data);
+			}
+
+			/**
+				\brief public member inline function
+
+				@param[out] rgba a reference to a cv::Mat to be filled with a writable RGBA copy of the frame as function output
+				@param[in] index a std::size_t containing the index of the frame
+			*/
+			void inline decode(cv::Mat & rgba, std::size_t const index) const
+			{
+				if(this->header(index).format == Recording::NV21) cv::cvtColor(this->frame(index), rgba, cv::COLOR_YUV2RGBA_NV21);
+				else this->frame(index).copyTo(rgba);
+			}
+
+			/**
+				\brief public member inline function
+
+				@param[out] result a reference to the aux::FrameResult to be filled with the recorded results as function output
+				@param[in] index a std::size_t containing the index of the frame
+			*/
+			void inline result(FrameResult & result, std::size_t const index) const
+			{
+				Recording::FrameHeader const & h = this->header(index);
+				unsigned char const * record = this->d_data + this->d_records[index];
+				std::int32_t const * points = (std::int32_t const *) (record + h.pointsOffset);
+				std::uint32_t const * counts = (std::uint32_t const *) (record + h.overlayOffset);
+				std::int32_t const * polygons = (std::int32_t const *) (record + h.overlayOffset + h.polygonCount * sizeof(std::uint32_t));
+
+				result.clear();
+				result.processed = h.processed != 0;
+
+				for(std::uint32_t i = 0; i < h.referencePointCount; i++, points += 2)
+					result.referencePoints.push_back(cv::Point(points[0], points[1]));
+
+				for(std::uint32_t i = 0; i < h.outlinePointCount; i++, points += 2)
+					result.outline.push_back(cv::Point(points[0], points[1]));
+
+				result.overlay.resize(h.polygonCount);
+
+				for(std::uint32_t i = 0; i < h.polygonCount; i++)
+					for(std::uint32_t k = 0; k < counts[i]; k++, polygons += 2)
+						result.overlay[i].push_back(cv::Point(polygons[0], polygons[1]));
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_RECORDING_HPP_ */
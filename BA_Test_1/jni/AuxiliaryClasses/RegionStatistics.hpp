@@ -0,0 +1,168 @@
+#ifndef AUXILIARYCLASSES_REGIONSTATISTICS_HPP_
+#define AUXILIARYCLASSES_REGIONSTATISTICS_HPP_
+
+#include <algorithm>
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class RegionStatistics
+		\brief RegionStatistics class serving as the summed-area table of one image answering mean and variance queries of rectangles in constant time
+
+		Usage: This class serves as the color measurement of any number of regions of a frame!
+		The table holds the per-channel sums and sums of squares of an image which was halved d_level times from the window of the frame starting at d_offset.
+		Queries are given in the coordinates of the frame and cover the image pixels whose area lies in the rectangle, so a query costs four lookups per channel
+		regardless of its size. Once built the table is immutable and shared between threads.
+
+		@see d_sum
+		@see d_squareSum
+		@see d_level
+		@see d_offset
+	*/
+	class RegionStatistics
+	{
+		private:
+
+			/**
+				a cv::Mat object containing the per-channel sums of all pixels above and left of each position as doubles, one row and column larger than the image
+			*/
+			cv::Mat d_sum;
+
+			/**
+				a cv::Mat object containing the per-channel sums of the squared pixels above and left of each position as doubles, one row and column larger than the image
+			*/
+			cv::Mat d_squareSum;
+
+			/**
+				an int containing the number of times the frame was halved for the image
+			*/
+			int d_level;
+
+			/**
+				a cv::Point object containing the position of the image origin in the frame
+			*/
+			cv::Point d_offset;
+
+		public:
+
+			/**
+				default constructor
+
+				Starts without a table, every query is empty until build() is called
+			*/
+			RegionStatistics() : d_level(0), d_offset(0, 0) {}
+
+			/**
+				default destructor
+			*/
+			~RegionStatistics() {}
+
+			/**
+				\brief public member inline function
+
+				@param image a constant reference to a cv::Mat object containing an 8 bit image with up to four channels
+				@param level a constant int containing the number of times the frame was halved for the image
+				@param offset a constant reference to a cv::Point object containing the position of the image origin in the frame
+
+				Builds the table in one pass over the image
+			*/
+			void inline build(cv::Mat const & image, int const level, cv::Point const & offset)
+			{
+				cv::integral(image, this->d_sum, this->d_squareSum, CV_64F);
+
+				this->d_level = level;
+				this->d_offset = offset;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param rect a constant reference to a cv::Rect object in the coordinates of the frame
+				@param[out] mean a reference to a cv::Scalar object to be filled with the per-channel mean of the region
+				@param[out] variance a reference to a cv::Scalar object to be filled with the per-channel variance of the region
+
+				The rectangle is clipped to the image, channels the image does not have are 0
+
+				@return true if the clipped region contains at least one pixel of the image, false if the outputs are left untouched
+			*/
+			bool inline statistics(cv::Rect const & rect, cv::Scalar & mean, cv::Scalar & variance) const
+			{
+				if(this->d_sum.empty()) return false;
+
+				int const round = (1 << this->d_level) - 1;
+
+				int const x0 = std::max((rect.x - this->d_offset.x + round) >> this->d_level, 0);
+				int const y0 = std::max((rect.y - this->d_offset.y + round) >> this->d_level, 0);
+				int const x1 = std::min((rect.x + rect.width - this->d_offset.x) >> this->d_level, this->d_sum.cols - 1);
+				int const y1 = std::min((rect.y + rect.height - this->d_offset.y) >> this->d_level, this->d_sum.rows - 1);
+
+				if(x1 <= x0 || y1 <= y0) return false;
+
+				int const channels = this->d_sum.channels();
+				double const count = (double) (x1 - x0) * (y1 - y0);
+
+				double const * sumTop = this->d_sum.ptr<double>(y0);
+				double const * sumBottom = this->d_sum.ptr<double>(y1);
+				double const * squareTop = this->d_squareSum.ptr<double>(y0);
+				double const * squareBottom = this->d_squareSum.ptr<double>(y1);
+
+				mean = variance = cv::Scalar::all(0.0);
+
+				for(int c = 0; c < channels; c++)
+				{
+					double const sum = sumBottom[x1 * channels + c] - sumBottom[x0 * channels + c] - sumTop[x1 * channels + c] + sumTop[x0 * channels + c];
+					double const square = squareBottom[x1 * channels + c] - squareBottom[x0 * channels + c] - squareTop[x1 * channels + c] + squareTop[x0 * channels + c];
+
+					mean.val[c] = sum / count;
+					variance.val[c] = std::max(square / count - mean.val[c] * mean.val[c], 0.0);
+				}
+
+				return true;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param rect a constant reference to a cv::Rect object in the coordinates of the frame
+
+				@see statistics()
+				@return a cv::Scalar object containing the per-channel mean of the region, all 0 if it contains no pixel of the image
+			*/
+			cv::Scalar inline mean(cv::Rect const & rect) const
+			{
+				cv::Scalar mean, variance;
+
+				this->statistics(rect, mean, variance);
+
+				return mean;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_level
+				@return an int containing the number of times the frame was halved for the image
+			*/
+			int inline level() const
+			{
+				return this->d_level;
+			}
+
+			/**
+				\brief public member inline function
+
+				@return a cv::Size object containing the size of the image, empty if the table is not built
+			*/
+			cv::Size inline size() const
+			{
+				return this->d_sum.empty() ? cv::Size() : cv::Size(this->d_sum.cols - 1, this->d_sum.rows - 1);
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_REGIONSTATISTICS_HPP_ */
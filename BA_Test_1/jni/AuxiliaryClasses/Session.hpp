@@ -0,0 +1,512 @@
+#ifndef AUXILIARYCLASSES_SESSION_HPP_
+#define AUXILIARYCLASSES_SESSION_HPP_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "Constants.hpp"
+#include "AtomicSnapshot.hpp"
+#include "Model.hpp"
+#include "CameraModel.hpp"
+#include "Recording.hpp"
+#include "LatencyMonitor.hpp"
+#include "QualityController.hpp"
+#include "WhiteBalance.hpp"
+#include "RegionStatistics.hpp"
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class Session
+		\brief Session class serving as the owner of all calibration results and models of one camera stream
+
+		Usage: This class serves as the state of one processing session!
+		Each camera stream owns its own Session which is passed to every proc function depending on calibration data.
+		Sessions share no mutable state, so several of them can be processed concurrently on different threads.
+		Board and storage are held as an immutable aux::Model which is swapped atomically by publish(). A frame pins the current
+		model with beginFrame() and keeps using it until endFrame(), so recalibration never waits for or disturbs a running frame.
+
+		@see d_blueFactor
+		@see d_redFactor
+		@see d_whiteBalance
+		@see d_models
+		@see d_model
+		@see d_recorder
+		@see d_camera
+		@see d_latency
+		@see d_quality
+		@see d_statistics
+		@see d_code
+	*/
+	class Session
+	{
+		private:
+
+			/**
+				a std::atomic double containing the blue color channel correction factor
+
+				This factor is used to correct the blue channel of a pixel by multiplying the initial value with this one
+			*/
+			std::atomic<double> d_blueFactor;
+
+			/**
+				a std::atomic double containing the red color channel correction factor
+
+				This factor is used to correct the red channel of a pixel by multiplying the initial value with this one
+			*/
+			std::atomic<double> d_redFactor;
+
+			/**
+				the aux::WhiteBalance following the lighting after the calibration, guarded by d_colorMutex
+			*/
+			WhiteBalance d_whiteBalance;
+
+			/**
+				a std::mutex serializing the calibration and the continuous adjustment of the color correction factors
+			*/
+			std::mutex d_colorMutex;
+
+			/**
+				an aux::AtomicSnapshot containing the published aux::Model
+			*/
+			AtomicSnapshot<Model> d_models;
+
+			/**
+				a constant pointer to the aux::Model pinned by the running frame
+			*/
+			Model const * d_model;
+
+			/**
+				a std::shared_ptr to the aux::RecordingWriter the frames of the session are recorded with, empty if they are not recorded, guarded by d_recorderMutex
+			*/
+			std::shared_ptr<RecordingWriter> d_recorder;
+
+			/**
+				a std::mutex guarding the recorder, which is attached and detached by another thread than the one processing the frames
+			*/
+			mutable std::mutex d_recorderMutex;
+
+			/**
+				a std::shared_ptr to the aux::CameraModel of the lens, empty for a pinhole camera, guarded by d_cameraMutex
+
+				It belongs to the camera instead of the aux::Model, so it is kept when another board is activated
+			*/
+			std::shared_ptr<CameraModel const> d_camera;
+
+			/**
+				a std::mutex guarding the camera model, which is set by the calibration and rebuilt by the frame whose size it does not match
+			*/
+			std::mutex d_cameraMutex;
+
+			/**
+				the aux::LatencyMonitor accounting the results of the session
+			*/
+			LatencyMonitor d_latency;
+
+			/**
+				the aux::QualityController holding the processing time of the session within its budget
+			*/
+			QualityController d_quality;
+
+			/**
+				an aux::AtomicSnapshot containing the aux::RegionStatistics of the last processed frame
+			*/
+			AtomicSnapshot<RegionStatistics> d_statistics;
+
+			/**
+				a std::atomic bool containing whether the frames build aux::RegionStatistics (true) or not (false)
+			*/
+			std::atomic<bool> d_collectStatistics;
+
+			/**
+				a std::mutex serializing the switching of d_collectStatistics with the publication of d_statistics
+			*/
+			std::mutex d_statisticsMutex;
+
+			/**
+				a std::atomic bool containing whether the frames are searched for QR codes (true) or not (false)
+			*/
+			std::atomic<bool> d_scanCodes;
+
+			/**
+				a std::atomic unsigned int counting the frames offered for a QR code search, only every cnst::CODE_SCAN_CADENCE-th one is searched
+			*/
+			std::atomic<unsigned int> d_codeFrames;
+
+			/**
+				a std::string containing the last decoded QR code which was not taken yet, empty if there is none, guarded by d_codeMutex
+			*/
+			std::string d_code;
+
+			/**
+				a std::mutex guarding d_code
+			*/
+			std::mutex d_codeMutex;
+
+		public:
+
+			/**
+				default constructor
+
+				Starts without color correction and without a model until the Session is calibrated
+			*/
+			Session() : d_blueFactor(1.0), d_redFactor(1.0), d_model(nullptr), d_collectStatistics(false), d_scanCodes(false), d_codeFrames(0) {}
+
+			/**
+				default destructor
+			*/
+			~Session() {}
+
+			/**
+				\brief public member inline function
+
+				@see d_blueFactor
+				@return a double containing the blue color channel correction factor
+			*/
+			double inline blueFactor() const
+			{
+				return this->d_blueFactor.load(std::memory_order_relaxed);
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_redFactor
+				@return a double containing the red color channel correction factor
+			*/
+			double inline redFactor() const
+			{
+				return this->d_redFactor.load(std::memory_order_relaxed);
+			}
+
+			/**
+				\brief public member inline function
+
+				@param blue a double containing the blue color channel correction factor
+				@param red a double containing the red color channel correction factor
+
+				Sets the color correction factors as calibration, a running frame picks them up with its next pixel row at the latest.
+				The continuous white balance restarts from them
+
+				@see d_blueFactor
+				@see d_redFactor
+				@see d_whiteBalance
+			*/
+			void inline setColorFactors(double const blue, double const red)
+			{
+				std::lock_guard<std::mutex> lock(this->d_colorMutex);
+
+				this->d_blueFactor.store(blue, std::memory_order_relaxed);
+				this->d_redFactor.store(red, std::memory_order_relaxed);
+				this->d_whiteBalance.reset(blue, red);
+			}
+
+			/**
+				\brief public member inline function
+
+				@param neutral a constant reference to a cv::Scalar containing the mean of the neutral pixels of the color corrected detection image
+				@param timestamp a constant std::int64_t containing the steady clock nanoseconds the mean was measured at
+
+				Adjusts the color correction factors of the following frames slowly towards the ones turning the neutral pixels gray, nothing happens before the calibration
+
+				@see d_whiteBalance
+				@see aux::WhiteBalance::update()
+			*/
+			void inline balanceColors(cv::Scalar const & neutral, std::int64_t const timestamp)
+			{
+				std::lock_guard<std::mutex> lock(this->d_colorMutex);
+
+				double blue = this->d_blueFactor.load(std::memory_order_relaxed);
+				double red = this->d_redFactor.load(std::memory_order_relaxed);
+
+				if(this->d_whiteBalance.update(neutral, timestamp, blue, red))
+				{
+					this->d_blueFactor.store(blue, std::memory_order_relaxed);
+					this->d_redFactor.store(red, std::memory_order_relaxed);
+				}
+			}
+
+			/**
+				\brief public member inline function
+
+				@param model a std::shared_ptr to the immutable aux::Model to be used from the next frame on
+
+				@see d_models
+			*/
+			void inline publish(std::shared_ptr<Model const> const & model)
+			{
+				this->d_models.publish(model);
+			}
+
+			/**
+				\brief public member inline function
+
+				@return a std::shared_ptr to the currently published aux::Model, empty if the Session is not calibrated
+
+				@see d_models
+			*/
+			std::shared_ptr<Model const> inline currentModel()
+			{
+				return this->d_models.current();
+			}
+
+			/**
+				\brief public member inline function
+
+				Pins the currently published aux::Model for the frame to be processed. Has to be called by the thread processing the frames
+
+				@see d_model
+				@return true if a model is available, false if the Session is not calibrated yet
+			*/
+			bool inline beginFrame()
+			{
+				this->d_model = this->d_models.acquire();
+
+				return this->d_model != nullptr;
+			}
+
+			/**
+				\brief public member inline function
+
+				Unpins the aux::Model of the processed frame
+
+				@see d_model
+			*/
+			void inline endFrame()
+			{
+				this->d_model = nullptr;
+				this->d_models.release();
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_model
+				@return the aux::Model pinned by the running frame as constant reference, only valid between beginFrame() and endFrame()
+			*/
+			Model inline const & model() const
+			{
+				return *this->d_model;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param recorder a constant reference to a std::shared_ptr to the aux::RecordingWriter the following frames are recorded with, empty to stop recording
+
+				A frame which is running keeps the recorder it started with, so the recording is closed once its last frame is committed
+
+				@see d_recorder
+			*/
+			void inline record(std::shared_ptr<RecordingWriter> const & recorder)
+			{
+				std::lock_guard<std::mutex> lock(this->d_recorderMutex);
+
+				this->d_recorder = recorder;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_recorder
+				@return a std::shared_ptr to the aux::RecordingWriter of the session, empty if the frames are not recorded
+			*/
+			std::shared_ptr<RecordingWriter> inline recorder() const
+			{
+				std::lock_guard<std::mutex> lock(this->d_recorderMutex);
+
+				return this->d_recorder;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param camera a constant reference to a std::shared_ptr to the aux::CameraModel of the lens, empty for a pinhole camera
+
+				@see d_camera
+			*/
+			void inline setCamera(std::shared_ptr<CameraModel const> const & camera)
+			{
+				std::lock_guard<std::mutex> lock(this->d_cameraMutex);
+
+				this->d_camera = camera;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param frameSize a constant reference to a cv::Size object containing the dimensions of the frame to be processed
+
+				A camera model built for other dimensions is rebuilt for the frame and kept for the following ones, which only happens when the resolution changes
+
+				@see d_camera
+				@return a std::shared_ptr to the aux::CameraModel of the lens built for the frame, empty for a pinhole camera
+			*/
+			std::shared_ptr<CameraModel const> inline camera(cv::Size const & frameSize)
+			{
+				std::lock_guard<std::mutex> lock(this->d_cameraMutex);
+
+				if(this->d_camera && this->d_camera->frameSize() != frameSize) this->d_camera = std::make_shared<CameraModel const>(*this->d_camera, frameSize);
+
+				return this->d_camera;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_latency
+				@return the aux::LatencyMonitor of the session as reference
+			*/
+			LatencyMonitor inline & latency()
+			{
+				return this->d_latency;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_quality
+				@return the aux::QualityController of the session as reference
+			*/
+			QualityController inline & quality()
+			{
+				return this->d_quality;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param enabled a bool containing whether the following frames build aux::RegionStatistics (true) or not (false)
+
+				Disabling drops the statistics of the last frame, a frame still running cannot publish its statistics afterwards
+
+				@see d_collectStatistics
+				@see d_statistics
+				@see publishStatistics()
+			*/
+			void inline collectStatistics(bool const enabled)
+			{
+				std::lock_guard<std::mutex> lock(this->d_statisticsMutex);
+
+				this->d_collectStatistics.store(enabled, std::memory_order_relaxed);
+
+				if(!enabled) this->d_statistics.clear();
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_collectStatistics
+				@return true if the frames build aux::RegionStatistics, false otherwise
+			*/
+			bool inline collectsStatistics() const
+			{
+				return this->d_collectStatistics.load(std::memory_order_relaxed);
+			}
+
+			/**
+				\brief public member inline function
+
+				@param statistics a constant reference to a std::shared_ptr to the aux::RegionStatistics of the processed frame
+
+				Publishes the statistics only if they are still collected, the check and the publication are atomic with respect to collectStatistics()
+
+				@see d_statistics
+				@see d_statisticsMutex
+				@return true if the statistics were published, false if the collection was disabled meanwhile
+			*/
+			bool inline publishStatistics(std::shared_ptr<RegionStatistics const> const & statistics)
+			{
+				std::lock_guard<std::mutex> lock(this->d_statisticsMutex);
+
+				if(!this->collectsStatistics()) return false;
+
+				this->d_statistics.publish(statistics);
+
+				return true;
+			}
+
+			/**
+				\brief public member inline function
+
+				May be called from any thread, the returned statistics stay valid while they are referenced
+
+				@see d_statistics
+				@return a std::shared_ptr to the aux::RegionStatistics of the last processed frame, empty if none were built
+			*/
+			std::shared_ptr<RegionStatistics const> inline statistics()
+			{
+				return this->d_statistics.current();
+			}
+
+			/**
+				\brief public member inline function
+
+				@param enabled a bool containing whether the following frames are searched for QR codes (true) or not (false)
+
+				Disabling drops a decoded code which was not taken yet
+
+				@see d_scanCodes
+				@see d_code
+			*/
+			void inline scanCodes(bool const enabled)
+			{
+				this->d_scanCodes.store(enabled, std::memory_order_relaxed);
+
+				if(!enabled) this->takeCode();
+			}
+
+			/**
+				\brief public member inline function
+
+				Counts the offered frame, so it is called exactly once per frame
+
+				@see d_scanCodes
+				@see d_codeFrames
+				@return true if QR codes are scanned and the frame is due to be searched, false otherwise
+			*/
+			bool inline codeScanDue()
+			{
+				return this->d_scanCodes.load(std::memory_order_relaxed) && this->d_codeFrames.fetch_add(1, std::memory_order_relaxed) % cnst::CODE_SCAN_CADENCE == 0;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param code a constant reference to a std::string containing the decoded QR code, replacing one which was not taken yet
+
+				@see d_code
+			*/
+			void inline publishCode(std::string const & code)
+			{
+				std::lock_guard<std::mutex> lock(this->d_codeMutex);
+
+				this->d_code = code;
+			}
+
+			/**
+				\brief public member inline function
+
+				May be called from any thread, each decoded code is returned once
+
+				@see d_code
+				@return a std::string containing the last decoded QR code, empty if none was decoded since the last call
+			*/
+			std::string inline takeCode()
+			{
+				std::lock_guard<std::mutex> lock(this->d_codeMutex);
+
+				std::string code;
+
+				code.swap(this->d_code);
+
+				return code;
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_SESSION_HPP_ */
@@ -116,7 +116,7 @@ namespace aux
 				@see d_storageMatrix
 				@return a std::vector containing the kind of storage matrix (m x n) as constant reference
 			*/
-			std::vector<int> inline const & storageMatrix()
+			std::vector<int> inline const & storageMatrix() const
 			{
 				return this->d_storageMatrix;
 			}
@@ -128,7 +128,7 @@ namespace aux
 				@see d_refMidDimensions
 				@return a std::vector containing data type T variables representing the refernce stickers dimension based on their center points
 			*/
-			std::vector<T> inline const & refMidDimensions()
+			std::vector<T> inline const & refMidDimensions() const
 			{
 				return this->d_refMidDimensions;
 			}
@@ -140,7 +140,7 @@ namespace aux
 				@see d_refCornerDimensions
 				@return a std::vector containing data type T variables representing the refernce stickers dimension based on their outer corner points
 			*/
-			std::vector<T> inline const & refCornerDimensions()
+			std::vector<T> inline const & refCornerDimensions() const
 			{
 				return this->d_refCornerDimensions;
 			}
@@ -152,7 +152,7 @@ namespace aux
 				@see d_boxOffsetXY
 				@return a std::vector containing data type T variables representing the x and y offsets of the boxes to each other
 			*/
-			std::vector<T> inline const & boxOffsetXY()
+			std::vector<T> inline const & boxOffsetXY() const
 			{
 				return this->d_boxOffsetXY;
 			}
@@ -164,7 +164,7 @@ namespace aux
 				@see d_boxDimensions
 				@return a std::vector containing data type T variables representing the dimensions of the Box
 			*/
-			std::vector<T> inline const & boxDimensions()
+			std::vector<T> inline const & boxDimensions() const
 			{
 				return this->d_boxDimensions;
 			}
@@ -176,7 +176,7 @@ namespace aux
 				@see d_distRefsToCorners
 				@return a cv::Mat object containing the x and y geometric vectors in order to reach the reference sticker corners
 			*/
-			cv::Mat inline const & distRefsToCorners()
+			cv::Mat inline const & distRefsToCorners() const
 			{
 				return this->d_distRefsToCorners;
 			}
@@ -0,0 +1,289 @@
+#ifndef AUXILIARYCLASSES_TASKGRAPH_HPP_
+#define AUXILIARYCLASSES_TASKGRAPH_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ThreadPool.hpp"
+#include "Trace.hpp"
+#include "AllocationTracker.hpp"
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class TaskGraph
+		\brief TaskGraph class serving as a dataflow executor for the work of a single frame
+
+		Usage: This class serves as the description of all steps of a frame and their dependencies!
+		Each step is added as a node with the nodes it depends on. Nodes without unfinished dependencies are
+		submitted to an aux::ThreadPool, so independent branches run concurrently and join at the first node depending on all of them.
+		The thread calling run() helps executing the ready nodes of its own graph and sleeps while all of them are taken by workers,
+		so it neither spins nor runs tasks of other graphs sharing the pool. It returns once every node has finished.
+		The first exception thrown by a node is rethrown by run(), nodes depending on a failed node are skipped.
+		While tracing or allocation accounting is enabled each node is recorded as a stage named like the node.
+
+		@see d_nodes
+		@see aux::ThreadPool
+		@see aux::Trace
+		@see aux::AllocationTracker
+	*/
+	class TaskGraph
+	{
+		private:
+
+			/**
+				\struct Node
+				\brief a step of the frame together with its successors and the number of unfinished predecessors
+			*/
+			struct Node
+			{
+				std::string name;
+				std::function<void()> work;
+				std::vector<int> successors;
+				int predecessors;
+				std::atomic<int> remaining;
+			};
+
+			/**
+				a std::vector containing all nodes in the order they were added
+			*/
+			std::vector<std::unique_ptr<Node>> d_nodes;
+
+			/**
+				\struct Ready
+				\brief the nodes of the current run whose dependencies are finished and the number of unfinished nodes, guarded by mutex
+
+				It is shared with the tasks submitted to the pool, so a task finding no node left never touches the graph, which may be gone already
+			*/
+			struct Ready
+			{
+				std::mutex mutex;
+				std::condition_variable condition;
+				std::deque<int> nodes;
+				int unfinished;
+			};
+
+			/**
+				a std::shared_ptr to the Ready state of the current run
+			*/
+			std::shared_ptr<Ready> d_ready;
+
+			/**
+				a std::atomic bool containing whether a node of the current run has failed (true) or not (false)
+			*/
+			std::atomic<bool> d_failed;
+
+			/**
+				a std::exception_ptr containing the first exception thrown in the current run guarded by d_errorMutex
+			*/
+			std::exception_ptr d_error;
+			std::mutex d_errorMutex;
+
+			/**
+				\brief private member inline function
+
+				@param pool a reference to the aux::ThreadPool executing the graph
+				@param id an int containing the index of the node to be executed
+
+				Executes the node unless a previous node has failed and schedules each successor whose dependencies are all finished.
+				Finishing the last node wakes the thread waiting in run()
+
+				@see aux::TraceScope
+				@see aux::AllocationScope
+			*/
+			void inline execute(ThreadPool & pool, int const id)
+			{
+				Node & node = *this->d_nodes[id];
+
+				if(!this->d_failed)
+				{
+					try
+					{
+#ifdef BA_TRACE
+						TraceScope scope(Trace::shared().enabled() ? Trace::shared().intern(node.name) : nullptr);
+#endif
+						ALLOCATION_SCOPE(node.name.c_str());
+						node.work();
+					}
+					catch(...)
+					{
+						std::lock_guard<std::mutex> lock(this->d_errorMutex);
+
+						if(!this->d_failed.exchange(true)) this->d_error = std::current_exception();
+					}
+				}
+
+				for(std::vector<int>::iterator it = node.successors.begin(); it != node.successors.end(); ++it)
+				{
+					if(--this->d_nodes[*it]->remaining == 0) this->schedule(pool, *it);
+				}
+
+				std::lock_guard<std::mutex> lock(this->d_ready->mutex);
+
+				if(--this->d_ready->unfinished == 0) this->d_ready->condition.notify_all();
+			}
+
+			/**
+				\brief private member inline function
+
+				@param pool a reference to the aux::ThreadPool executing the graph
+				@param id an int containing the index of the node whose dependencies are finished
+
+				Queues the node as ready and submits a task to the pool executing one ready node of the graph.
+				Every node is executed exactly once, either by that task or by the thread waiting in run(), whichever takes it first
+			*/
+			void inline schedule(ThreadPool & pool, int const id)
+			{
+				std::shared_ptr<Ready> const ready = this->d_ready;
+
+				{
+					std::lock_guard<std::mutex> lock(ready->mutex);
+
+					ready->nodes.push_back(id);
+				}
+
+				ready->condition.notify_all();
+
+				pool.submit([this, &pool, ready] {
+					int node = -1;
+
+					{
+						std::lock_guard<std::mutex> lock(ready->mutex);
+
+						if(ready->nodes.empty()) return;
+
+						node = ready->nodes.front();
+						ready->nodes.pop_front();
+					}
+
+					this->execute(pool, node);
+				});
+			}
+
+		public:
+
+			/**
+				default constructor
+			*/
+			TaskGraph() : d_ready(std::make_shared<Ready>()), d_failed(false)
+			{
+				this->d_ready->unfinished = 0;
+			}
+
+			/**
+				default destructor
+			*/
+			~TaskGraph() {}
+
+			TaskGraph(TaskGraph const &) = delete;
+			TaskGraph & operator=(TaskGraph const &) = delete;
+
+			/**
+				\brief public member inline function
+
+				@param name a std::string containing the name of the step
+				@param work a std::function containing the work of the step
+				@param dependencies a std::vector containing the indices of the nodes which have to be finished before the step starts
+
+				Adds a step to the graph. Dependencies have to be added before the nodes depending on them, which keeps the graph acyclic
+
+				@return an int containing the index of the added node
+			*/
+			int inline add(std::string const & name, std::function<void()> work, std::vector<int> const & dependencies = std::vector<int>())
+			{
+				int const id = (int) this->d_nodes.size();
+
+				std::unique_ptr<Node> node(new Node());
+				node->name = name;
+				node->work = std::move(work);
+				node->predecessors = (int) dependencies.size();
+
+				for(std::vector<int>::const_iterator it = dependencies.begin(); it != dependencies.end(); ++it)
+					this->d_nodes[*it]->successors.push_back(id);
+
+				this->d_nodes.push_back(std::move(node));
+
+				return id;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param pool a reference to the aux::ThreadPool executing the graph
+
+				Schedules all nodes without dependencies and executes ready nodes of the graph until every node has finished,
+				waiting for the workers whenever no node is ready
+
+				@throws the first exception thrown by a node
+			*/
+			void inline run(ThreadPool & pool)
+			{
+				this->d_ready->unfinished = (int) this->d_nodes.size();
+				this->d_ready->nodes.clear();
+				this->d_failed = false;
+				this->d_error = std::exception_ptr();
+
+				for(std::vector<std::unique_ptr<Node>>::iterator it = this->d_nodes.begin(); it != this->d_nodes.end(); ++it)
+					(*it)->remaining = (*it)->predecessors;
+
+				for(int i = 0; i < (int) this->d_nodes.size(); i++)
+				{
+					if(this->d_nodes[i]->predecessors == 0) this->schedule(pool, i);
+				}
+
+				std::unique_lock<std::mutex> lock(this->d_ready->mutex);
+
+				while(this->d_ready->unfinished > 0)
+				{
+					if(this->d_ready->nodes.empty())
+					{
+						this->d_ready->condition.wait(lock);
+						continue;
+					}
+
+					int const id = this->d_ready->nodes.front();
+					this->d_ready->nodes.pop_front();
+
+					lock.unlock();
+					this->execute(pool, id);
+					lock.lock();
+				}
+
+				lock.unlock();
+
+				if(this->d_error) std::rethrow_exception(this->d_error);
+			}
+
+			/**
+				\brief public member inline function
+
+				@param id an int containing the index of a node
+				@return a std::string containing the name of the node as constant reference
+			*/
+			std::string inline const & name(int const id) const
+			{
+				return this->d_nodes[id]->name;
+			}
+
+			/**
+				\brief public member inline function
+
+				@return an int containing the number of nodes
+			*/
+			int inline size() const
+			{
+				return (int) this->d_nodes.size();
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_TASKGRAPH_HPP_ */
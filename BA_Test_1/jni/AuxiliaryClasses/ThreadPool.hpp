@@ -0,0 +1,271 @@
+#ifndef AUXILIARYCLASSES_THREADPOOL_HPP_
+#define AUXILIARYCLASSES_THREADPOOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class ThreadPool
+		\brief ThreadPool class serving as a work-stealing executor for the tasks of a frame
+
+		Usage: This class serves as the executor for all concurrently processed work!
+		Each worker owns a double ended queue. Tasks submitted by a worker are pushed to the back of its own queue,
+		tasks submitted by any other thread are distributed round robin. An idle worker takes the newest task of its own queue
+		and steals the oldest task of another queue if its own one is empty.
+		A thread waiting for submitted work may help executing it via runPendingTask().
+
+		@see d_queues
+		@see d_workers
+		@see shared()
+	*/
+	class ThreadPool
+	{
+		private:
+
+			/**
+				\struct WorkQueue
+				\brief a double ended queue of tasks guarded by its own mutex
+			*/
+			struct WorkQueue
+			{
+				std::mutex mutex;
+				std::deque<std::function<void()>> tasks;
+			};
+
+			/**
+				a std::vector containing one WorkQueue for each worker
+			*/
+			std::vector<std::unique_ptr<WorkQueue>> d_queues;
+
+			/**
+				a std::vector containing the worker threads
+			*/
+			std::vector<std::thread> d_workers;
+
+			/**
+				a std::atomic containing the number of submitted tasks which are not taken yet
+			*/
+			std::atomic<int> d_pending;
+
+			/**
+				a std::atomic containing the index of the queue receiving the next task submitted from outside the pool
+			*/
+			std::atomic<unsigned> d_nextQueue;
+
+			/**
+				a std::atomic bool containing whether the workers have to terminate (true) or not (false)
+			*/
+			std::atomic<bool> d_done;
+
+			/**
+				a std::mutex and a std::condition_variable used to park idle workers
+			*/
+			std::mutex d_idleMutex;
+			std::condition_variable d_idleCondition;
+
+			/**
+				\brief private static inline function
+
+				@return a reference to the index of the queue owned by the calling thread, -1 if the calling thread is no worker
+			*/
+			static int inline & workerIndex()
+			{
+				static thread_local int index = -1;
+
+				return index;
+			}
+
+			/**
+				\brief private member inline function
+
+				@param[out] task a reference to a std::function to be filled with the retrieved task as function output
+				@param[in] start an int containing the index of the queue to be searched first
+
+				Takes the newest task of the queue at start or steals the oldest task of any other queue
+
+				@return true if a task was retrieved, false if all queues are empty
+			*/
+			bool inline takeTask(std::function<void()> & task, int const start)
+			{
+				int const n = (int) this->d_queues.size();
+
+				for(int i = 0; i < n; i++)
+				{
+					WorkQueue & queue = *this->d_queues[(start + i) % n];
+					std::lock_guard<std::mutex> lock(queue.mutex);
+
+					if(queue.tasks.empty()) continue;
+
+					if(i == 0)
+					{
+						task = std::move(queue.tasks.back());
+						queue.tasks.pop_back();
+					}
+					else
+					{
+						task = std::move(queue.tasks.front());
+						queue.tasks.pop_front();
+					}
+
+					this->d_pending--;
+
+					return true;
+				}
+
+				return false;
+			}
+
+			/**
+				\brief private member inline function
+
+				@param index an int containing the index of the queue owned by the worker
+
+				Executes tasks until the pool is destroyed and parks the worker while there is no work
+			*/
+			void inline workerLoop(int const index)
+			{
+				ThreadPool::workerIndex() = index;
+
+				while(!this->d_done)
+				{
+					std::function<void()> task;
+
+					if(this->takeTask(task, index))
+					{
+						task();
+						continue;
+					}
+
+					std::unique_lock<std::mutex> lock(this->d_idleMutex);
+
+					this->d_idleCondition.wait(lock, [this] { return this->d_done || this->d_pending > 0; });
+				}
+			}
+
+		public:
+
+			/**
+				explicit constructor
+
+				@param threads an unsigned containing the number of worker threads, at least one worker is started
+
+				Creates one queue for each worker and starts the workers
+			*/
+			explicit ThreadPool(unsigned threads)
+				:
+					d_pending(0),
+					d_nextQueue(0),
+					d_done(false)
+			{
+				if(threads == 0) threads = 1;
+
+				for(unsigned i = 0; i < threads; i++)
+					this->d_queues.push_back(std::unique_ptr<WorkQueue>(new WorkQueue()));
+
+				for(unsigned i = 0; i < threads; i++)
+					this->d_workers.push_back(std::thread(&ThreadPool::workerLoop, this, (int) i));
+			}
+
+			/**
+				default destructor
+
+				Terminates and joins all workers, tasks which are not taken yet are discarded
+			*/
+			~ThreadPool()
+			{
+				{
+					std::lock_guard<std::mutex> lock(this->d_idleMutex);
+					this->d_done = true;
+				}
+
+				this->d_idleCondition.notify_all();
+
+				for(std::vector<std::thread>::iterator it = this->d_workers.begin(); it != this->d_workers.end(); ++it)
+					it->join();
+			}
+
+			ThreadPool(ThreadPool const &) = delete;
+			ThreadPool & operator=(ThreadPool const &) = delete;
+
+			/**
+				\brief public member inline function
+
+				@param task a std::function containing the work to be executed
+
+				Pushes the task to the queue of the calling worker or distributes it round robin if the caller is no worker of this pool
+			*/
+			void inline submit(std::function<void()> task)
+			{
+				int index = ThreadPool::workerIndex();
+
+				if(index < 0 || index >= (int) this->d_queues.size())
+					index = (int) (this->d_nextQueue++ % this->d_queues.size());
+
+				{
+					std::lock_guard<std::mutex> lock(this->d_queues[index]->mutex);
+					this->d_queues[index]->tasks.push_back(std::move(task));
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(this->d_idleMutex);
+					this->d_pending++;
+				}
+
+				this->d_idleCondition.notify_one();
+			}
+
+			/**
+				\brief public member inline function
+
+				Executes one pending task on the calling thread. Used by threads waiting for submitted work in order to help instead of blocking
+
+				@return true if a task was executed, false if there was no pending task
+			*/
+			bool inline runPendingTask()
+			{
+				std::function<void()> task;
+				int index = ThreadPool::workerIndex();
+
+				if(!this->takeTask(task, index < 0 ? 0 : index)) return false;
+
+				task();
+
+				return true;
+			}
+
+			/**
+				\brief public member inline function
+
+				@return an unsigned containing the number of worker threads
+			*/
+			unsigned inline size() const
+			{
+				return (unsigned) this->d_workers.size();
+			}
+
+			/**
+				\brief public static inline function
+
+				@return a reference to the process wide ThreadPool with one worker for each available core
+			*/
+			static ThreadPool inline & shared()
+			{
+				static ThreadPool pool(std::thread::hardware_concurrency());
+
+				return pool;
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_THREADPOOL_HPP_ */
@@ -0,0 +1,430 @@
+#ifndef AUXILIARYCLASSES_TRACE_HPP_
+#define AUXILIARYCLASSES_TRACE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Constants.hpp"
+
+/**
+	opens a aux::TraceScope named name until the end of the enclosing block if the software is built with BA_TRACE, expands to nothing otherwise
+*/
+#ifdef BA_TRACE
+#define TRACE_SCOPE_CONCAT_(a, b) a ## b
+#define TRACE_SCOPE_CONCAT(a, b) TRACE_SCOPE_CONCAT_(a, b)
+#define TRACE_SCOPE(name) aux::TraceScope TRACE_SCOPE_CONCAT(traceScope, __LINE__)(name)
+#else
+#define TRACE_SCOPE(name)
+#endif
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class Trace
+		\brief Trace class serving as the collector of the timed stages of all threads
+
+		Usage: This class serves as the store of all stage timings while tracing is enabled!
+		Each thread writes its events into its own ring buffer of cnst::TRACE_BUFFER_CAPACITY events without any lock,
+		the oldest events are overwritten once the buffer is full. The slots are relaxed atomics, a reader validates the copied events
+		against the write position afterwards and drops the ones which may have been overwritten meanwhile, so reading never blocks the writing threads.
+		Recording costs a single relaxed load while tracing is disabled at runtime, nothing is compiled in without BA_TRACE.
+
+		@see Event
+		@see d_buffers
+		@see aux::TraceScope
+		@see chromeTrace()
+		@see summary()
+	*/
+	class Trace
+	{
+		public:
+
+			/**
+				\struct Event
+				\brief a timed stage with its name, its begin and end in nanoseconds of the steady clock and the number of the thread
+			*/
+			struct Event
+			{
+				char const * name;
+				std::uint64_t begin;
+				std::uint64_t end;
+				int thread;
+			};
+
+		private:
+
+			/**
+				\struct Slot
+				\brief an event in the ring buffer, written by the owning thread only
+			*/
+			struct Slot
+			{
+				std::atomic<char const *> name;
+				std::atomic<std::uint64_t> begin;
+				std::atomic<std::uint64_t> end;
+			};
+
+			/**
+				\struct Buffer
+				\brief the ring buffer of a thread, head contains the number of events ever written
+			*/
+			struct Buffer
+			{
+				Slot slots[cnst::TRACE_BUFFER_CAPACITY];
+				std::atomic<std::uint64_t> head;
+				int thread;
+			};
+
+			/**
+				a std::vector containing the buffers of all threads which have recorded an event guarded by d_mutex, the buffers outlive their threads
+			*/
+			std::vector<std::shared_ptr<Buffer>> d_buffers;
+
+			/**
+				a std::set containing the interned names of stages which are not string literals guarded by d_mutex
+			*/
+			std::set<std::string> d_names;
+
+			/**
+				a std::mutex guarding the registration of buffers and names
+			*/
+			mutable std::mutex d_mutex;
+
+			/**
+				a std::atomic bool containing whether events are recorded (true) or not (false)
+			*/
+			std::atomic<bool> d_enabled;
+
+			/**
+				a std::atomic containing the time in nanoseconds before which events are ignored, moved forward by clear()
+			*/
+			std::atomic<std::uint64_t> d_epoch;
+
+			/**
+				default constructor
+			*/
+			Trace() : d_enabled(false), d_epoch(0) {}
+
+			/**
+				\brief private member inline function
+
+				@return a reference to the ring buffer of the calling thread, registered on first use
+			*/
+			Buffer inline & buffer()
+			{
+				static thread_local std::shared_ptr<Buffer> local;
+
+				if(!local)
+				{
+					local = std::make_shared<Buffer>();
+					local->head = 0;
+
+					std::lock_guard<std::mutex> lock(this->d_mutex);
+
+					local->thread = (int) this->d_buffers.size();
+					this->d_buffers.push_back(local);
+				}
+
+				return *local;
+			}
+
+			/**
+				\brief private static inline function
+
+				@param value a constant reference to a std::string
+
+				@return a std::string containing the value escaped as JSON string content
+			*/
+			static std::string inline escape(std::string const & value)
+			{
+				std::string out;
+
+				for(std::string::const_iterator it = value.begin(); it != value.end(); ++it)
+				{
+					if(*it == '"' || *it == '\\') out += '\\';
+					out += *it;
+				}
+
+				return out;
+			}
+
+		public:
+
+			Trace(Trace const &) = delete;
+			Trace & operator=(Trace const &) = delete;
+
+			/**
+				\brief public static inline function
+
+				@return a reference to the process wide aux::Trace object
+			*/
+			static Trace inline & shared()
+			{
+				static Trace trace;
+
+				return trace;
+			}
+
+			/**
+				\brief public static inline function
+
+				@return a std::uint64_t containing the current time of the steady clock in nanoseconds
+			*/
+			static std::uint64_t inline now()
+			{
+				return (std::uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+			}
+
+			/**
+				\brief public member inline function
+
+				@param enabled a bool containing whether events are recorded from now on (true) or not (false)
+			*/
+			void inline enable(bool const enabled)
+			{
+				this->d_enabled.store(enabled, std::memory_order_relaxed);
+			}
+
+			/**
+				\brief public member inline function
+
+				@see d_enabled
+				@return true if events are recorded, false otherwise
+			*/
+			bool inline enabled() const
+			{
+				return this->d_enabled.load(std::memory_order_relaxed);
+			}
+
+			/**
+				\brief public member inline function
+
+				Ignores all events recorded so far without touching the buffers of the writing threads
+			*/
+			void inline clear()
+			{
+				this->d_epoch = Trace::now();
+			}
+
+			/**
+				\brief public member inline function
+
+				@param name a constant reference to a std::string containing the name of a stage
+
+				@return a constant char pointer to a copy of the name which stays valid as long as the process
+			*/
+			char const inline * intern(std::string const & name)
+			{
+				std::lock_guard<std::mutex> lock(this->d_mutex);
+
+				return this->d_names.insert(name).first->c_str();
+			}
+
+			/**
+				\brief public member inline function
+
+				@param name a constant char pointer to the name of the stage which has to stay valid as long as the process, e.g. a string literal
+				@param begin a std::uint64_t containing the begin of the stage in nanoseconds
+				@param end a std::uint64_t containing the end of the stage in nanoseconds
+
+				Appends the event to the ring buffer of the calling thread
+			*/
+			void inline record(char const * name, std::uint64_t const begin, std::uint64_t const end)
+			{
+				Buffer & b = this->buffer();
+
+				std::uint64_t const head = b.head.load(std::memory_order_relaxed);
+
+				std::atomic_thread_fence(std::memory_order_release);
+
+				Slot & slot = b.slots[head & (cnst::TRACE_BUFFER_CAPACITY - 1)];
+
+				slot.name.store(name, std::memory_order_relaxed);
+				slot.begin.store(begin, std::memory_order_relaxed);
+				slot.end.store(end, std::memory_order_relaxed);
+
+				b.head.store(head + 1, std::memory_order_release);
+			}
+
+			/**
+				\brief public member inline function
+
+				Copies the events of all threads which are still present in their buffers and not older than the last clear(),
+				events overwritten during the copy are dropped
+
+				@return a std::vector containing the events ordered by begin
+			*/
+			std::vector<Event> inline events() const
+			{
+				std::vector<std::shared_ptr<Buffer>> buffers;
+
+				{
+					std::lock_guard<std::mutex> lock(this->d_mutex);
+					buffers = this->d_buffers;
+				}
+
+				std::vector<Event> result;
+				std::uint64_t const epoch = this->d_epoch;
+
+				for(std::size_t i = 0; i < buffers.size(); i++)
+				{
+					Buffer const & b = *buffers[i];
+
+					std::uint64_t const head = b.head.load(std::memory_order_acquire);
+					std::uint64_t const first = head > (std::uint64_t) cnst::TRACE_BUFFER_CAPACITY ? head - cnst::TRACE_BUFFER_CAPACITY : 0;
+					std::vector<std::pair<std::uint64_t, Event>> copied;
+
+					for(std::uint64_t k = first; k < head; k++)
+					{
+						Slot const & slot = b.slots[k & (cnst::TRACE_BUFFER_CAPACITY - 1)];
+						Event e = { slot.name.load(std::memory_order_relaxed), slot.begin.load(std::memory_order_relaxed), slot.end.load(std::memory_order_relaxed), b.thread };
+
+						copied.push_back(std::make_pair(k, e));
+					}
+
+					std::atomic_thread_fence(std::memory_order_acquire);
+
+					std::uint64_t const after = b.head.load(std::memory_order_relaxed);
+					std::uint64_t const valid = after >= (std::uint64_t) cnst::TRACE_BUFFER_CAPACITY ? after - cnst::TRACE_BUFFER_CAPACITY + 1 : 0;
+
+					for(std::size_t k = 0; k < copied.size(); k++)
+					{
+						if(copied[k].first >= valid && copied[k].second.begin >= epoch)
+							result.push_back(copied[k].second);
+					}
+				}
+
+				std::sort(result.begin(), result.end(), [](Event const & a, Event const & b) { return a.begin < b.begin; });
+
+				return result;
+			}
+
+			/**
+				\brief public member inline function
+
+				@see events()
+				@return a std::string containing all events as Chrome trace event JSON with complete events in microseconds
+			*/
+			std::string inline chromeTrace() const
+			{
+				std::vector<Event> events = this->events();
+				std::ostringstream out;
+
+				out.precision(3);
+				out << std::fixed << "{\"traceEvents\":[";
+
+				for(std::size_t i = 0; i < events.size(); i++)
+				{
+					out << (i ? ",\n" : "\n") << "{\"name\":\"" << Trace::escape(events[i].name) << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << events[i].thread
+						<< ",\"ts\":" << events[i].begin / 1000.0 << ",\"dur\":" << (events[i].end - events[i].begin) / 1000.0 << "}";
+				}
+
+				out << "\n],\"displayTimeUnit\":\"ms\"}";
+
+				return out.str();
+			}
+
+			/**
+				\brief public member inline function
+
+				@see events()
+				@return a std::string containing a JSON object with the number of events, the mean, the 50th, 90th and 99th percentile and the maximum duration in milliseconds for each stage
+			*/
+			std::string inline summary() const
+			{
+				std::vector<Event> events = this->events();
+				std::map<std::string, std::vector<double>> durations;
+
+				for(std::size_t i = 0; i < events.size(); i++)
+					durations[events[i].name].push_back((events[i].end - events[i].begin) / 1e6);
+
+				std::ostringstream out;
+				out.precision(3);
+				out << std::fixed << "{";
+
+				for(std::map<std::string, std::vector<double>>::iterator it = durations.begin(); it != durations.end(); ++it)
+				{
+					std::vector<double> & d = it->second;
+					std::sort(d.begin(), d.end());
+
+					double sum = 0.0;
+					for(std::size_t k = 0; k < d.size(); k++) sum += d[k];
+
+					out << (it == durations.begin() ? "\n" : ",\n") << "\"" << Trace::escape(it->first) << "\":{\"count\":" << d.size()
+						<< ",\"mean\":" << sum / d.size()
+						<< ",\"p50\":" << d[(d.size() - 1) * 50 / 100]
+						<< ",\"p90\":" << d[(d.size() - 1) * 90 / 100]
+						<< ",\"p99\":" << d[(d.size() - 1) * 99 / 100]
+						<< ",\"max\":" << d.back() << "}";
+				}
+
+				out << "\n}";
+
+				return out.str();
+			}
+	};
+
+	/**
+		\class TraceScope
+		\brief TraceScope class serving as a scoped timer of a stage
+
+		Usage: This class serves as the measurement of a block, use it through TRACE_SCOPE(name)!
+		The stage is recorded into aux::Trace when the object is destroyed, nothing is measured if tracing is disabled when the block is entered
+		or the name is nullptr.
+
+		@see aux::Trace::record()
+	*/
+	class TraceScope
+	{
+		private:
+
+			/**
+				a constant char pointer to the name of the stage, nullptr if nothing is measured
+			*/
+			char const * d_name;
+
+			/**
+				a std::uint64_t containing the begin of the stage in nanoseconds
+			*/
+			std::uint64_t d_begin;
+
+		public:
+
+			/**
+				explicit constructor
+
+				@param name a constant char pointer to the name of the stage which has to stay valid as long as the process, e.g. a string literal
+			*/
+			explicit TraceScope(char const * name)
+				:
+					d_name(name != nullptr && Trace::shared().enabled() ? name : nullptr),
+					d_begin(d_name != nullptr ? Trace::now() : 0)
+			{}
+
+			/**
+				default destructor
+
+				Records the stage if it is measured
+			*/
+			~TraceScope()
+			{
+				if(this->d_name != nullptr) Trace::shared().record(this->d_name, this->d_begin, Trace::now());
+			}
+
+			TraceScope(TraceScope const &) = delete;
+			TraceScope & operator=(TraceScope const &) = delete;
+	};
+}
+
+#endif /* AUXILIARYCLASSES_TRACE_HPP_ */
@@ -0,0 +1,126 @@
+#ifndef AUXILIARYCLASSES_WHITEBALANCE_HPP_
+#define AUXILIARYCLASSES_WHITEBALANCE_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <opencv2/core/core.hpp>
+#include "Constants.hpp"
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class WhiteBalance
+		\brief WhiteBalance class serving as the online estimator keeping the color correction of a camera stream at its calibration while the lighting drifts
+
+		Usage: This class serves as the continuous white balance of one aux::Session!
+		The scene of the app is a green board or a storage, so a plain gray world would pull every frame to gray. Instead the illuminant is estimated by the gray world
+		of the neutral pixels only, e.g. the white of the storage, the labels or the table, whose color is the one of the light. A change of the scene, like switching
+		from the storage to the board, therefore does not move the estimate, and no reference of a scene is kept.
+		The correction factors move towards the ones turning the neutral mean gray with the time constant cnst::WHITE_BALANCE_TIME_CONSTANT, counted in seconds between
+		the updates and at most cnst::WHITE_BALANCE_MAX_STEP per update, so slow drifts of the lighting are followed while a hand or a component passing the camera, or a pause,
+		hardly changes the correction. The factors never leave cnst::WHITE_BALANCE_MAX_DRIFT of the calibrated ones.
+		The mean is measured on the color corrected image, so only the residual of the current factors is corrected.
+		The estimator is not synchronized, the owning aux::Session guards it.
+
+		@see reset()
+		@see update()
+	*/
+	class WhiteBalance
+	{
+		private:
+
+			/**
+				a bool containing whether the factors were calibrated (true) or the estimator waits for a calibration (false)
+			*/
+			bool d_calibrated;
+
+			/**
+				a double array containing the calibrated blue and red correction factors
+			*/
+			double d_factors[2];
+
+			/**
+				a std::int64_t containing the timestamp of the previous update, 0 before the first one after the calibration
+			*/
+			std::int64_t d_lastTimestamp;
+
+		public:
+
+			/**
+				default constructor
+
+				Waits for a calibration, an uncalibrated stream is never corrected
+			*/
+			WhiteBalance() : d_calibrated(false), d_lastTimestamp(0)
+			{
+				this->d_factors[0] = this->d_factors[1] = 1.0;
+			}
+
+			/**
+				default destructor
+			*/
+			~WhiteBalance() {}
+
+			/**
+				\brief public member inline function
+
+				@param blue a double containing the calibrated blue color channel correction factor
+				@param red a double containing the calibrated red color channel correction factor
+
+				Restarts the estimator at the calibration, the next frame only starts the clock
+			*/
+			void inline reset(double const blue, double const red)
+			{
+				this->d_calibrated = true;
+				this->d_lastTimestamp = 0;
+				this->d_factors[0] = blue;
+				this->d_factors[1] = red;
+			}
+
+			/**
+				\brief public member inline function
+
+				@param neutral a constant reference to a cv::Scalar containing the mean of the neutral pixels of the color corrected frame
+				@param timestamp a constant std::int64_t containing the steady clock nanoseconds the mean was measured at
+				@param[in,out] blue a reference to a double containing the current blue color channel correction factor, which is applied to channel cnst::NUMBER_BLUE_CHANNEL
+				@param[in,out] red a reference to a double containing the current red color channel correction factor, which is applied to channel cnst::NUMBER_RED_CHANNEL
+
+				@return true if the factors were adjusted, false if the estimator is not calibrated, starts its clock or the mean has no green
+			*/
+			bool inline update(cv::Scalar const & neutral, std::int64_t const timestamp, double & blue, double & red)
+			{
+				if(!this->d_calibrated || !(neutral.val[1] > 0.0)) return false;
+
+				if(this->d_lastTimestamp == 0 || timestamp <= this->d_lastTimestamp)
+				{
+					this->d_lastTimestamp = timestamp;
+
+					return false;
+				}
+
+				double const seconds = std::min((timestamp - this->d_lastTimestamp) * 1e-9, cnst::WHITE_BALANCE_MAX_STEP);
+				double const weight = -std::expm1(-seconds / cnst::WHITE_BALANCE_TIME_CONSTANT);
+				double const ratios[2] = { neutral.val[cnst::NUMBER_BLUE_CHANNEL] / neutral.val[1], neutral.val[cnst::NUMBER_RED_CHANNEL] / neutral.val[1] };
+				double * factors[2] = { &blue, &red };
+
+				this->d_lastTimestamp = timestamp;
+
+				for(int c = 0; c < 2; c++)
+				{
+					if(!(ratios[c] > 0.0)) continue;
+
+					double const target = *factors[c] * std::pow(1.0 / ratios[c], weight);
+
+					*factors[c] = std::min(std::max(target, this->d_factors[c] / cnst::WHITE_BALANCE_MAX_DRIFT), this->d_factors[c] * cnst::WHITE_BALANCE_MAX_DRIFT);
+				}
+
+				return true;
+			}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_WHITEBALANCE_HPP_ */
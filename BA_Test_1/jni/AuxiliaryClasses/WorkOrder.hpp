@@ -0,0 +1,119 @@
+#ifndef AUXILIARYCLASSES_WORKORDER_HPP_
+#define AUXILIARYCLASSES_WORKORDER_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\struct WorkOrder
+		\brief WorkOrder struct serving as the list of components highlighted on the board in one frame
+
+		Usage: This struct serves as the input of proc::asmb::processWorkOrder()!
+		Every item names a component and whether it is already implemented, the one to be implemented now or one of the following ones.
+		The items are drawn in the order done, upcoming, current, so the current component stays on top where locations overlap.
+
+		@see Item
+		@see drawingOrder()
+	*/
+	struct WorkOrder
+	{
+		/**
+			\enum State
+			\brief the progress of a component of the work order, used as index of cnst::WORK_ORDER_COLORS
+		*/
+		enum State
+		{
+			DONE,
+			CURRENT,
+			UPCOMING,
+			STATES
+		};
+
+		/**
+			\struct Item
+			\brief a component of the work order
+		*/
+		struct Item
+		{
+			int component;
+			State state;
+		};
+
+		/**
+			a std::vector containing the items in the order they are passed by the caller
+		*/
+		std::vector<Item> items;
+
+		/**
+			\brief public member inline function
+
+			Empties the work order so the object can be reused for the next frame without giving up its capacity
+		*/
+		void inline clear()
+		{
+			this->items.clear();
+		}
+
+		/**
+			\brief public member inline function
+
+			@param component an int containing the number of the component
+			@param state an int containing the State of the component
+
+			Appends the component, an item of an unknown state is dropped
+
+			@return true if the item was appended, false otherwise
+		*/
+		bool inline add(int const component, int const state)
+		{
+			if(state < DONE || state >= STATES) return false;
+
+			Item item;
+
+			item.component = component;
+			item.state = (State) state;
+
+			this->items.push_back(item);
+
+			return true;
+		}
+
+		/**
+			\brief public member inline function
+
+			@return an int containing the index of the first current item, -1 if there is none
+		*/
+		int inline current() const
+		{
+			for(std::size_t i = 0; i < this->items.size(); i++)
+				if(this->items[i].state == CURRENT) return (int) i;
+
+			return -1;
+		}
+
+		/**
+			\brief public member inline function
+
+			@param[out] order a reference to a std::vector to be filled with the indices of the items in drawing order as function output
+
+			Orders the items done, upcoming, current, the items of the same state keep the order of the caller
+		*/
+		void inline drawingOrder(std::vector<int> & order) const
+		{
+			State const states[STATES] = { DONE, UPCOMING, CURRENT };
+
+			order.clear();
+
+			for(int s = 0; s < STATES; s++)
+				for(std::size_t i = 0; i < this->items.size(); i++)
+					if(this->items[i].state == states[s]) order.push_back((int) i);
+		}
+	};
+}
+
+#endif /* AUXILIARYCLASSES_WORKORDER_HPP_ */
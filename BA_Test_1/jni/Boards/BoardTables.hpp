@@ -0,0 +1,27 @@
+#ifndef BOARDS_BOARDTABLES_HPP_
+#define BOARDS_BOARDTABLES_HPP_
+
+#include "AuxiliaryClasses/BoardTable.hpp"
+
+/*
+	headers of the compiled in production boards generated by Tools/BoardTableGenerator.cpp, e.g.
+	#include "Boards/Board_0815.hpp"
+*/
+
+/** \namespace
+	the namespace boards contains the constant tables of the compiled in production boards
+*/
+namespace boards
+{
+	/**
+		a constant array of pointers to the aux::BoardTable of each compiled in production board terminated by nullptr, e.g. &boards::Board_0815::table
+		The tables are registered pinned in every aux::ModelCache and take precedence over configuration files of the same board id
+
+		@see aux::ModelCache::add()
+	*/
+	static aux::BoardTable const * const BOARD_TABLES[] = {
+		nullptr
+	};
+}
+
+#endif /* BOARDS_BOARDTABLES_HPP_ */
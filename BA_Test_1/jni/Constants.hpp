@@ -21,7 +21,8 @@ namespace cnst
 	static cv::Scalar const HIGHLIGHTING_COLOR(0, 204, 255);
 	static cv::Scalar const COLOR_GREEN(0, 255, 0);
 	static cv::Scalar const COLOR_RED(255, 0, 0);
-	static cv::Scalar const CONTOUR_MULTIPLIER(4, 4);
+	static cv::Scalar const COLOR_UPCOMING(255, 204, 0);
+	static cv::Scalar const WORK_ORDER_COLORS[] = { COLOR_GREEN, HIGHLIGHTING_COLOR, COLOR_UPCOMING };
 
 	static int const MINIMUM_NUMBER_BOXES_IN_ROW = 1;
 	static int const MINIMUM_NUMBER_BOXES_IN_COLUMN = 1;
@@ -40,6 +41,63 @@ namespace cnst
 	static int const SUFFICIENT_NUMBER_DETECTED_RECTANGLES = 4;
 	static int const MAXIMUM_VALUE_CORRECT_ANGLE = 20;
 	static int const NUMBER_CORNERS = 4;
+	static int const MODEL_IMAGE_VERSION = 4;
+	static int const MODEL_IMAGE_ALIGNMENT = 8;
+	static int const TRACE_BUFFER_CAPACITY = 4096;
+	static int const CACHE_LINE_SIZE = 64;
+	static int const RECORDING_VERSION = 1;
+	static int const RECORDING_ALIGNMENT = 64;
+	static int const RECORDING_QUEUE_CAPACITY = 8;
+	static int const SCENE_SUBPIXEL_SHIFT = 4;
+	static int const LATENCY_BUCKETS = 80;
+	static int const LATENCY_BUCKETS_PER_OCTAVE = 4;
+	static int const LATENCY_WINDOW_SECONDS = 10;
+	static int const DETECTION_PYRAMID_LEVEL = 2;
+	static int const QUALITY_MAX_PYRAMID_LEVEL = 3;
+	static int const QUALITY_MAX_CADENCE = 3;
+	static int const QUALITY_DEGRADE_FRAMES = 5;
+	static int const QUALITY_UPGRADE_FRAMES = 30;
+	static int const QUALITY_SETTLE_FRAMES = 10;
+	static int const WHITE_BALANCE_DARK = 20;
+	static int const WHITE_BALANCE_SATURATION = 250;
+	static int const CCT_SAMPLE_STEP = 8;
+	static int const PAIRING_MAX_CANDIDATES = 8;
+	static int const MARKER_BITS = 4;
+	static int const MARKER_CELL_PIXELS = 4;
+	static int const MARKER_THRESHOLD_BLOCK = 7;
+	static int const MARKER_THRESHOLD_OFFSET = 7;
+	static int const MARKER_MIN_PERIMETER = 40;
+	static int const MARKER_MAX_CORRECTION = 1;
+	static int const MARKER_CODES[4] = { 0x72b9, 0x251b, 0x13e7, 0x2b2c };
+	static int const CODE_PYRAMID_LEVEL = 1;
+	static int const CODE_SCAN_CADENCE = 3;
+	static int const CODE_THRESHOLD_DIVISOR = 8;
+	static int const CODE_THRESHOLD_OFFSET = 10;
+	static int const CODE_MIN_FINDER_AREA = 64;
+	static int const CODE_MAX_FINDERS = 12;
+	static int const CODE_MAX_VERSION = 6;
+	static int const CODE_MODULE_PIXELS = 4;
+	static int const CODE_QUIET_ZONE = 2;
+	static int const CODE_ALIGNMENT_SEARCH = 4;
+	static int const CODE_FORMAT_MAX_CORRECTION = 3;
+	static int const KERNEL_GAIN_SHIFT = 8;
+	static int const KERNEL_GAIN_ONE = 1 << KERNEL_GAIN_SHIFT;
+	static int const KERNEL_GAIN_MAX = 0xffff;
+	static int const KERNEL_LUMA_SHIFT = 14;
+	static int const KERNEL_LUMA_RED = 4899;
+	static int const KERNEL_LUMA_GREEN = 9617;
+	static int const KERNEL_LUMA_BLUE = 1868;
+	static int const CAMERA_DISTORTION_COEFFICIENTS = 5;
+	static int const CAMERA_GRID_STEP = 16;
+	static int const CAMERA_UNDISTORT_ITERATIONS = 10;
+	static int const CODE_EC_BLOCKS[6][4][5] = {
+		{ { 10, 1, 16, 0, 0 }, { 7, 1, 19, 0, 0 }, { 17, 1, 9, 0, 0 }, { 13, 1, 13, 0, 0 } },
+		{ { 16, 1, 28, 0, 0 }, { 10, 1, 34, 0, 0 }, { 28, 1, 16, 0, 0 }, { 22, 1, 22, 0, 0 } },
+		{ { 26, 1, 44, 0, 0 }, { 15, 1, 55, 0, 0 }, { 22, 2, 13, 0, 0 }, { 18, 2, 17, 0, 0 } },
+		{ { 18, 2, 32, 0, 0 }, { 20, 1, 80, 0, 0 }, { 16, 4, 9, 0, 0 }, { 26, 2, 24, 0, 0 } },
+		{ { 24, 2, 43, 0, 0 }, { 26, 1, 108, 0, 0 }, { 22, 2, 11, 2, 12 }, { 18, 2, 15, 2, 16 } },
+		{ { 16, 4, 27, 0, 0 }, { 18, 2, 68, 0, 0 }, { 28, 4, 15, 0, 0 }, { 24, 4, 19, 0, 0 } }
+	};
 
 	static double const RIGHT_ANGLE = 90.0;
 	static double const ANGLE_DEGREE_MULTIPLIER = 180.0;
@@ -53,8 +111,31 @@ namespace cnst
 	static double const IMPLEMENTATION_BETA_1 = 0.4;
 	static double const IMPLEMENTATION_BETA_2 = 0.5;
 	static double const GAMMA = 0.0;
+	static double const VISIBLE_REGION_MARGIN = 0.05;
+	static double const SCENE_NEUTRAL_KELVIN = 6500.0;
+	static double const LATENCY_BUCKET_BASE_MS = 0.1;
+	static double const QUALITY_SEARCH_MARGIN = 2.0;
+	static double const QUALITY_MIN_SEARCH_MARGIN = 0.5;
+	static double const QUALITY_HEADROOM = 0.6;
+	static double const QUALITY_SMOOTHING = 0.2;
+	static double const WHITE_BALANCE_TIME_CONSTANT = 60.0;
+	static double const WHITE_BALANCE_MAX_STEP = 0.5;
+	static double const WHITE_BALANCE_MAX_DRIFT = 1.25;
+	static double const WHITE_BALANCE_NEUTRAL_SPREAD = 0.15;
+	static double const WHITE_BALANCE_MIN_COVERAGE = 0.05;
+	static double const PAIRING_MAX_SCORE = 1.0;
+	static double const PAIRING_SIZE_WEIGHT = 0.25;
+	static double const MARKER_APPROXIMATION = 0.05;
+	static double const CODE_FINDER_TOLERANCE = 0.4;
+	static double const CODE_MAX_FINDER_SCORE = 0.4;
+	static double const CODE_ALIGNMENT_MIN_SCORE = 0.5;
+	static double const RGB_TO_XYZ[3][3] = { { 0.412453, 0.357580, 0.180423 }, { 0.212671, 0.715160, 0.072169 }, { 0.019334, 0.119193, 0.950227 } };
 
 	static const char * JAVA_STRING_CLASS_IDENTIFIER = "java/lang/String";
+	static char const MODEL_IMAGE_MAGIC[8] = "BAMODEL";
+	static char const RECORDING_MAGIC[8] = "BARECRD";
+	static char const RECORDING_EXTENSION[] = ".barec";
+	static char const CODE_ALPHANUMERIC[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
 }
 
 #endif /* CONSTANTS_HPP_ */
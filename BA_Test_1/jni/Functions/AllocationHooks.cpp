@@ -0,0 +1,71 @@
+#ifdef BA_ALLOC
+
+#include <cstdlib>
+#include <new>
+#include <malloc.h>
+#include "AuxiliaryClasses/AllocationTracker.hpp"
+
+/**
+	The global allocation functions of the native library reporting each block to aux::AllocationTracker.
+	Blocks are allocated with malloc like the default implementation and accounted with their usable size,
+	so blocks allocated here may be freed by the default implementation and vice versa. Only compiled in with BA_ALLOC.
+
+	@see aux::AllocationTracker::allocated()
+	@see aux::AllocationTracker::freed()
+*/
+
+void * operator new(std::size_t size)
+{
+	void * p = std::malloc(size ? size : 1);
+
+	if(p == nullptr) throw std::bad_alloc();
+
+	aux::AllocationTracker::allocated(malloc_usable_size(p));
+
+	return p;
+}
+
+void * operator new[](std::size_t size)
+{
+	return ::operator new(size);
+}
+
+void * operator new(std::size_t size, std::nothrow_t const &) noexcept
+{
+	void * p = std::malloc(size ? size : 1);
+
+	if(p != nullptr) aux::AllocationTracker::allocated(malloc_usable_size(p));
+
+	return p;
+}
+
+void * operator new[](std::size_t size, std::nothrow_t const & tag) noexcept
+{
+	return ::operator new(size, tag);
+}
+
+void operator delete(void * p) noexcept
+{
+	if(p == nullptr) return;
+
+	aux::AllocationTracker::freed(malloc_usable_size(p));
+
+	std::free(p);
+}
+
+void operator delete[](void * p) noexcept
+{
+	::operator delete(p);
+}
+
+void operator delete(void * p, std::nothrow_t const &) noexcept
+{
+	::operator delete(p);
+}
+
+void operator delete[](void * p, std::nothrow_t const &) noexcept
+{
+	::operator delete(p);
+}
+
+#endif /* BA_ALLOC */
@@ -0,0 +1,681 @@
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include "Functions/CodeFunctions.hpp"
+#include "Functions/KernelFunctions.hpp"
+#include "AuxiliaryClasses/Trace.hpp"
+#include "AuxiliaryClasses/PerfCounters.hpp"
+#include "AuxiliaryClasses/AllocationTracker.hpp"
+
+using namespace std;
+
+/**
+	\brief member function
+
+	@param[out] centers a reference to a std::vector containing cv::Point2f objects to be filled with the center of each finder pattern as first function output
+	@param[out] moduleSizes a reference to a std::vector containing floats to be filled with the module size of each finder pattern in pixels as second function output
+	@param[in] gray a constant reference to a cv::Mat object containing the luma image
+
+	Thresholds the luma against the mean of a neighbourhood of a quarter of the image side, so the dark center of a large finder pattern is not hollowed out,
+	and searches the contour tree for a dark square holding a light square which holds exactly one dark square. The sides of the three squares have to be in the ratio 7:5:3 of a finder pattern within cnst::CODE_FINDER_TOLERANCE.
+	A contour runs through the centers of its border pixels, so one pixel is added to the sides of the dark squares and taken from the side of the light one
+
+	@see cnst::CODE_THRESHOLD_DIVISOR
+	@see cnst::CODE_THRESHOLD_OFFSET
+	@see cnst::CODE_MIN_FINDER_AREA
+*/
+void qr::finderPatterns(std::vector<cv::Point2f> & centers, std::vector<float> & moduleSizes, cv::Mat const & gray)
+{
+	TRACE_SCOPE("qr::finderPatterns");
+	ALLOCATION_SCOPE("qr::finderPatterns");
+	PERF_SCOPE("qr::finderPatterns", gray.total());
+
+	cv::Mat binary;
+	vector<vector<cv::Point>> contours;
+	vector<cv::Vec4i> hierarchy;
+
+	int const block = std::max(gray.cols, gray.rows) / cnst::CODE_THRESHOLD_DIVISOR * 2 + 1;
+
+	ALLOCATION_TRACK(binary);
+
+	cv::adaptiveThreshold(gray, binary, cnst::MAXIMUM_COLOR_CHANNEL_VALUE, cv::ADAPTIVE_THRESH_MEAN_C, cv::THRESH_BINARY_INV, block, cnst::CODE_THRESHOLD_OFFSET);
+	cv::findContours(binary, contours, hierarchy, cv::RETR_TREE, cv::CHAIN_APPROX_SIMPLE);
+
+	for(int i = 0; i < (int) contours.size(); i++)
+	{
+		int const hole = hierarchy[i][2];
+
+		if(hole < 0) continue;
+
+		int const inner = hierarchy[hole][2];
+
+		if(inner < 0 || hierarchy[inner][0] >= 0) continue;
+
+		double const area = cv::contourArea(contours[i]);
+
+		if(area < cnst::CODE_MIN_FINDER_AREA) continue;
+
+		double const outerSide = std::sqrt(area) + 1.0;
+		double const holeSide = std::sqrt(cv::contourArea(contours[hole])) - 1.0;
+		double const innerSide = std::sqrt(cv::contourArea(contours[inner])) + 1.0;
+
+		if(holeSide <= 0.0) continue;
+		if(std::fabs(outerSide / holeSide * 5.0 / 7.0 - 1.0) > cnst::CODE_FINDER_TOLERANCE) continue;
+		if(std::fabs(holeSide / innerSide * 3.0 / 5.0 - 1.0) > cnst::CODE_FINDER_TOLERANCE) continue;
+
+		cv::Moments const m = cv::moments(contours[inner]);
+
+		if(m.m00 <= 0.0) continue;
+
+		centers.push_back(cv::Point2f((float) (m.m10 / m.m00), (float) (m.m01 / m.m00)));
+		moduleSizes.push_back((float) (outerSide / 7.0));
+	}
+
+	binary.release();
+}
+
+/**
+	\brief member function
+
+	@param[out] finders a reference to a std::vector containing cv::Point2f objects to be filled with the top left, top right and bottom left finder pattern center as first function output
+	@param[out] moduleSize a reference to a float to be filled with the mean module size of the three finder patterns in pixels as second function output
+	@param[in] gray a constant reference to a cv::Mat object containing the luma image
+
+	Picks the three of the cnst::CODE_MAX_FINDERS largest finder patterns which form the most isosceles right angle and agree the most in their module size.
+	The corner of the right angle is the top left finder pattern, the other two are ordered clockwise, so the code is never read mirrored
+
+	@see qr::finderPatterns()
+	@see cnst::CODE_MAX_FINDER_SCORE
+
+	@return true if a code was located, false if the outputs are left untouched
+*/
+bool qr::locate(std::vector<cv::Point2f> & finders, float & moduleSize, cv::Mat const & gray)
+{
+	vector<cv::Point2f> centers;
+	vector<float> sizes;
+
+	qr::finderPatterns(centers, sizes, gray);
+
+	int const count = (int) centers.size();
+
+	if(count < 3) return false;
+
+	vector<int> order(count);
+
+	for(int i = 0; i < count; i++) order[i] = i;
+
+	std::sort(order.begin(), order.end(), [&sizes](int const a, int const b) { return sizes[a] > sizes[b]; });
+
+	if(count > cnst::CODE_MAX_FINDERS) order.resize(cnst::CODE_MAX_FINDERS);
+
+	double best = cnst::CODE_MAX_FINDER_SCORE;
+	int corner = -1, right = -1, down = -1;
+
+	for(int a = 0; a < (int) order.size(); a++)
+	{
+		for(int b = 0; b < (int) order.size(); b++)
+		{
+			for(int c = b + 1; c < (int) order.size(); c++)
+			{
+				if(a == b || a == c) continue;
+
+				int const i = order[a], j = order[b], k = order[c];
+
+				cv::Point2f const u = centers[j] - centers[i], v = centers[k] - centers[i];
+				double const lu = cv::norm(u), lv = cv::norm(v);
+				double const smallest = std::min(sizes[i], std::min(sizes[j], sizes[k]));
+				double const largest = std::max(sizes[i], std::max(sizes[j], sizes[k]));
+
+				if(lu == 0.0 || lv == 0.0) continue;
+
+				double const span = (lu + lv) / (sizes[i] + sizes[j] + sizes[k]) * 1.5;
+
+				if(span < 14 - cnst::CODE_QUIET_ZONE || span > 4 * cnst::CODE_MAX_VERSION + 10 + cnst::CODE_QUIET_ZONE) continue;
+
+				double const score = std::fabs(lu - lv) / std::max(lu, lv) + std::fabs(u.dot(v)) / (lu * lv) + (largest - smallest) / largest;
+
+				if(score < best)
+				{
+					best = score;
+					corner = i;
+					right = j;
+					down = k;
+				}
+			}
+		}
+	}
+
+	if(corner < 0) return false;
+
+	cv::Point2f const u = centers[right] - centers[corner], v = centers[down] - centers[corner];
+
+	if(u.x * v.y - u.y * v.x < 0.0f) std::swap(right, down);
+
+	finders.clear();
+	finders.push_back(centers[corner]);
+	finders.push_back(centers[right]);
+	finders.push_back(centers[down]);
+
+	moduleSize = (sizes[corner] + sizes[right] + sizes[down]) / 3.0f;
+
+	return true;
+}
+
+/**
+	\brief member function
+
+	@param[out] modules a reference to a std::vector containing unsigned chars to be filled row by row with 1 for each dark and 0 for each light module as function output
+	@param[in] frame a constant reference to a cv::Mat object containing RGBA frame data
+	@param[in] finders a constant reference to a std::vector containing the top left, top right and bottom left finder pattern center in the coordinates of the frame
+	@param[in] dimension a constant int containing the number of modules per side of the code
+
+	Converts only the region of the code and its quiet zone to luma and rectifies it into cnst::CODE_MODULE_PIXELS per module from the three finder patterns.
+	A code from version 2 on is rectified a second time from four points once its alignment pattern is found, which removes the perspective the three finder patterns
+	can not describe. The rectified code is binarized with Otsu's threshold and each module is read from its center
+
+	@see cnst::CODE_QUIET_ZONE
+	@see cnst::CODE_ALIGNMENT_SEARCH
+	@see cnst::CODE_ALIGNMENT_MIN_SCORE
+
+	@return true if the code lies in the frame, false if modules is left untouched
+*/
+bool qr::sample(std::vector<unsigned char> & modules, cv::Mat const & frame, std::vector<cv::Point2f> const & finders, int const dimension)
+{
+	TRACE_SCOPE("qr::sample");
+	ALLOCATION_SCOPE("qr::sample");
+
+	int const cell = cnst::CODE_MODULE_PIXELS;
+	int const side = dimension * cell;
+	float const inner = 3.5f * cell - 0.5f, outer = (dimension - 3.5f) * cell - 0.5f;
+
+	cv::Point2f const grid[3] = { cv::Point2f(inner, inner), cv::Point2f(outer, inner), cv::Point2f(inner, outer) };
+	cv::Mat const affine = cv::getAffineTransform(grid, &finders[0]);
+
+	float const quiet = (float) (cnst::CODE_QUIET_ZONE * cell);
+
+	vector<cv::Point2f> corners;
+
+	corners.push_back(cv::Point2f(-quiet, -quiet));
+	corners.push_back(cv::Point2f(side + quiet, -quiet));
+	corners.push_back(cv::Point2f(side + quiet, side + quiet));
+	corners.push_back(cv::Point2f(-quiet, side + quiet));
+
+	cv::transform(corners, corners, affine);
+
+	cv::Rect const region = cv::boundingRect(corners) & cv::Rect(0, 0, frame.cols, frame.rows);
+
+	if(region.area() == 0) return false;
+
+	cv::Mat gray, rectified;
+
+	ALLOCATION_TRACK(gray);
+
+	krnl::luma(gray, frame(region), krnl::RGBA8888);
+
+	cv::Mat transform = cv::Mat::eye(3, 3, CV_64F);
+
+	affine.copyTo(transform.rowRange(0, 2));
+	transform.at<double>(0, 2) -= region.x;
+	transform.at<double>(1, 2) -= region.y;
+
+	cv::warpPerspective(gray, rectified, transform, cv::Size(side, side), cv::INTER_LINEAR | cv::WARP_INVERSE_MAP, cv::BORDER_REPLICATE);
+
+	if(dimension > 21)
+	{
+		int const search = cnst::CODE_ALIGNMENT_SEARCH * cell;
+		float const center = (dimension - 6.5f) * cell - 0.5f;
+
+		cv::Mat pattern(5 * cell, 5 * cell, CV_8UC1, cv::Scalar(cnst::MINIMUM_COLOR_CHANNEL_VALUE));
+		cv::Mat score;
+
+		cv::rectangle(pattern, cv::Rect(cell, cell, 3 * cell, 3 * cell), cv::Scalar(cnst::MAXIMUM_COLOR_CHANNEL_VALUE), -1);
+		cv::rectangle(pattern, cv::Rect(2 * cell, 2 * cell, cell, cell), cv::Scalar(cnst::MINIMUM_COLOR_CHANNEL_VALUE), -1);
+
+		cv::Rect const window = cv::Rect((dimension - 9) * cell - search, (dimension - 9) * cell - search, 5 * cell + 2 * search, 5 * cell + 2 * search) & cv::Rect(0, 0, side, side);
+
+		cv::matchTemplate(rectified(window), pattern, score, cv::TM_CCOEFF_NORMED);
+
+		double maximum;
+		cv::Point location;
+
+		cv::minMaxLoc(score, 0, &maximum, 0, &location);
+
+		if(maximum >= cnst::CODE_ALIGNMENT_MIN_SCORE)
+		{
+			vector<cv::Point2f> found(1, cv::Point2f(window.x + location.x + 2.5f * cell - 0.5f, window.y + location.y + 2.5f * cell - 0.5f));
+
+			cv::perspectiveTransform(found, found, transform);
+
+			cv::Point2f const source[cnst::NUMBER_CORNERS] = { grid[0], grid[1], grid[2], cv::Point2f(center, center) };
+			cv::Point2f const target[cnst::NUMBER_CORNERS] = { finders[0] - cv::Point2f((float) region.x, (float) region.y), finders[1] - cv::Point2f((float) region.x, (float) region.y),
+				finders[2] - cv::Point2f((float) region.x, (float) region.y), found[0] };
+
+			cv::warpPerspective(gray, rectified, cv::getPerspectiveTransform(source, target), cv::Size(side, side), cv::INTER_LINEAR | cv::WARP_INVERSE_MAP, cv::BORDER_REPLICATE);
+		}
+	}
+
+	cv::threshold(rectified, rectified, 0, cnst::MAXIMUM_COLOR_CHANNEL_VALUE, cv::THRESH_BINARY | cv::THRESH_OTSU);
+
+	int const margin = cell / 4;
+
+	modules.assign(dimension * dimension, 0);
+
+	for(int r = 0; r < dimension; r++)
+	{
+		for(int k = 0; k < dimension; k++)
+		{
+			cv::Mat const module = rectified(cv::Rect(k * cell + margin, r * cell + margin, cell - 2 * margin, cell - 2 * margin));
+
+			modules[r * dimension + k] = 2 * cv::countNonZero(module) > (int) module.total() ? 0 : 1;
+		}
+	}
+
+	gray.release();
+
+	return true;
+}
+
+/**
+	\brief member function
+
+	@param[out] block a reference to a std::vector containing the data codewords followed by the error correction codewords of one block to be corrected as function output
+	@param[in] ecCodewords a constant int containing the number of error correction codewords of the block
+
+	Reed-Solomon decoding over GF(256) with the field polynomial 0x11d of QR codes. The error locator is found by Berlekamp-Massey, its roots by a Chien search
+	and the error values by Forney's algorithm, which corrects up to half as many codewords as there are error correction codewords
+
+	@return true if the block is free of errors after the correction, false if it has too many errors
+*/
+bool qr::correct(std::vector<unsigned char> & block, int const ecCodewords)
+{
+	struct Field
+	{
+		int exp[512];
+		int log[256];
+
+		Field()
+		{
+			int x = 1;
+
+			for(int i = 0; i < 255; i++)
+			{
+				this->exp[i] = this->exp[i + 255] = x;
+				this->log[x] = i;
+				x <<= 1;
+
+				if(x & 0x100) x ^= 0x11d;
+			}
+
+			this->exp[510] = this->exp[511] = this->exp[0];
+			this->log[0] = 0;
+		}
+
+		int multiply(int const a, int const b) const
+		{
+			return a == 0 || b == 0 ? 0 : this->exp[this->log[a] + this->log[b]];
+		}
+
+		int inverse(int const a) const
+		{
+			return this->exp[255 - this->log[a]];
+		}
+	};
+
+	static Field const gf;
+
+	int const n = (int) block.size();
+
+	vector<int> syndromes(ecCodewords, 0);
+	bool clean = true;
+
+	for(int j = 0; j < ecCodewords; j++)
+	{
+		int s = 0;
+
+		for(int i = 0; i < n; i++) s = gf.multiply(s, gf.exp[j]) ^ block[i];
+
+		syndromes[j] = s;
+		clean = clean && s == 0;
+	}
+
+	if(clean) return true;
+
+	vector<int> locator(ecCodewords + 1, 0), previous(ecCodewords + 1, 0);
+	int errors = 0, shift = 1, discrepancy = 1;
+
+	locator[0] = previous[0] = 1;
+
+	for(int k = 0; k < ecCodewords; k++)
+	{
+		int d = syndromes[k];
+
+		for(int i = 1; i <= errors; i++) d ^= gf.multiply(locator[i], syndromes[k - i]);
+
+		if(d == 0)
+		{
+			shift++;
+			continue;
+		}
+
+		int const coefficient = gf.multiply(d, gf.inverse(discrepancy));
+		vector<int> const last = locator;
+
+		for(int i = 0; i + shift <= ecCodewords; i++) locator[i + shift] ^= gf.multiply(coefficient, previous[i]);
+
+		if(2 * errors <= k)
+		{
+			errors = k + 1 - errors;
+			previous = last;
+			discrepancy = d;
+			shift = 1;
+		}
+		else shift++;
+	}
+
+	if(2 * errors > ecCodewords) return false;
+
+	vector<int> evaluator(ecCodewords, 0);
+
+	for(int i = 0; i < ecCodewords; i++)
+		for(int j = 0; j <= std::min(i, errors); j++) evaluator[i] ^= gf.multiply(locator[j], syndromes[i - j]);
+
+	int found = 0;
+
+	for(int p = 0; p < n; p++)
+	{
+		int const x = gf.exp[(255 - p % 255) % 255];
+		int value = 0, numerator = 0, denominator = 0, power = 1;
+
+		for(int i = 0; i <= errors; i++)
+		{
+			value ^= gf.multiply(locator[i], power);
+
+			if(i % 2 == 1) denominator ^= gf.multiply(locator[i], gf.multiply(power, gf.inverse(x)));
+
+			power = gf.multiply(power, x);
+		}
+
+		if(value != 0) continue;
+
+		power = 1;
+
+		for(int i = 0; i < ecCodewords; i++)
+		{
+			numerator ^= gf.multiply(evaluator[i], power);
+			power = gf.multiply(power, x);
+		}
+
+		if(denominator == 0) return false;
+
+		block[n - 1 - p] ^= gf.multiply(gf.exp[p % 255], gf.multiply(numerator, gf.inverse(denominator)));
+		found++;
+	}
+
+	return found == errors;
+}
+
+/**
+	\brief member function
+
+	@param[out] text a reference to a std::string to be filled with the content of the code as function output
+	@param[in] modules a constant reference to a std::vector containing unsigned chars with 1 for each dark and 0 for each light module row by row
+	@param[in] dimension a constant int containing the number of modules per side of the code
+
+	Reads the format of the code from whichever of its two copies is closer to a valid one, unmasks the codewords and reads them in the zigzag order of the standard.
+	The blocks are deinterleaved with cnst::CODE_EC_BLOCKS and corrected, then the segments of the data codewords are appended until the terminator.
+	An ECI designator is skipped, Kanji and structured append segments are not supported
+
+	@see qr::correct()
+	@see cnst::CODE_FORMAT_MAX_CORRECTION
+	@see cnst::CODE_ALPHANUMERIC
+
+	@return true if the code was read, false otherwise
+*/
+bool qr::decodeModules(std::string & text, std::vector<unsigned char> const & modules, int const dimension)
+{
+	int const version = (dimension - 17) / 4;
+
+	if((dimension - 17) % 4 != 0 || version < 1 || version > cnst::CODE_MAX_VERSION) return false;
+
+	auto dark = [&modules, dimension](int const r, int const k) -> int { return modules[r * dimension + k] != 0 ? 1 : 0; };
+
+	int first = 0, second = 0;
+
+	for(int k = 0; k < 6; k++) first = (first << 1) | dark(8, k);
+
+	first = (first << 1) | dark(8, 7);
+	first = (first << 1) | dark(8, 8);
+	first = (first << 1) | dark(7, 8);
+
+	for(int r = 5; r >= 0; r--) first = (first << 1) | dark(r, 8);
+	for(int r = dimension - 1; r >= dimension - 7; r--) second = (second << 1) | dark(r, 8);
+	for(int k = dimension - 8; k < dimension; k++) second = (second << 1) | dark(8, k);
+
+	int format = -1, distance = cnst::CODE_FORMAT_MAX_CORRECTION + 1;
+
+	for(int data = 0; data < 32; data++)
+	{
+		int remainder = data << 10;
+
+		for(int bit = 14; bit >= 10; bit--) if((remainder >> bit) & 1) remainder ^= 0x537 << (bit - 10);
+
+		int const code = ((data << 10) | remainder) ^ 0x5412;
+		int const d = (int) std::min(std::bitset<15>(code ^ first).count(), std::bitset<15>(code ^ second).count());
+
+		if(d < distance)
+		{
+			distance = d;
+			format = data;
+		}
+	}
+
+	if(format < 0) return false;
+
+	int const mask = format & 7;
+
+	auto masked = [mask](int const r, int const k) -> bool {
+		switch(mask)
+		{
+			case 0: return (r + k) % 2 == 0;
+			case 1: return r % 2 == 0;
+			case 2: return k % 3 == 0;
+			case 3: return (r + k) % 3 == 0;
+			case 4: return (r / 2 + k / 3) % 2 == 0;
+			case 5: return (r * k) % 2 + (r * k) % 3 == 0;
+			case 6: return ((r * k) % 2 + (r * k) % 3) % 2 == 0;
+			default: return ((r + k) % 2 + (r * k) % 3) % 2 == 0;
+		}
+	};
+
+	vector<unsigned char> function(dimension * dimension, 0);
+
+	auto reserve = [&function, dimension](int const top, int const left, int const height, int const width) {
+		for(int r = top; r < top + height; r++)
+			for(int k = left; k < left + width; k++) function[r * dimension + k] = 1;
+	};
+
+	reserve(0, 0, 9, 9);
+	reserve(0, dimension - 8, 9, 8);
+	reserve(dimension - 8, 0, 8, 9);
+	reserve(6, 9, 1, dimension - 17);
+	reserve(9, 6, dimension - 17, 1);
+
+	if(version > 1) reserve(dimension - 9, dimension - 9, 5, 5);
+
+	int const * const blocks = cnst::CODE_EC_BLOCKS[version - 1][format >> 3];
+	int const ec = blocks[0], count = blocks[1] + blocks[3];
+	int const total = blocks[1] * (blocks[2] + ec) + blocks[3] * (blocks[4] + ec);
+
+	vector<unsigned char> raw;
+	int bits = 0, byte = 0;
+	bool up = true;
+
+	raw.reserve(total);
+
+	for(int k = dimension - 1; k > 0; k -= 2)
+	{
+		if(k == 6) k--;
+
+		for(int i = 0; i < dimension; i++)
+		{
+			int const r = up ? dimension - 1 - i : i;
+
+			for(int j = 0; j < 2; j++)
+			{
+				if(function[r * dimension + k - j]) continue;
+
+				byte = (byte << 1) | (dark(r, k - j) ^ (masked(r, k - j) ? 1 : 0));
+
+				if(++bits == 8)
+				{
+					raw.push_back((unsigned char) byte);
+					bits = byte = 0;
+				}
+			}
+		}
+
+		up = !up;
+	}
+
+	if((int) raw.size() < total) return false;
+
+	vector<vector<unsigned char>> block(count);
+	vector<unsigned char> data;
+	int offset = 0;
+
+	for(int b = 0; b < count; b++) block[b].resize((b < blocks[1] ? blocks[2] : blocks[4]) + ec);
+
+	for(int i = 0; i < std::max(blocks[2], blocks[4]); i++)
+		for(int b = 0; b < count; b++) if(i < (int) block[b].size() - ec) block[b][i] = raw[offset++];
+
+	for(int i = 0; i < ec; i++)
+		for(int b = 0; b < count; b++) block[b][block[b].size() - ec + i] = raw[offset++];
+
+	for(int b = 0; b < count; b++)
+	{
+		if(!qr::correct(block[b], ec)) return false;
+
+		data.insert(data.end(), block[b].begin(), block[b].end() - ec);
+	}
+
+	std::size_t position = 0;
+
+	auto read = [&data, &position](int const length) -> int {
+		if(position + length > data.size() * 8) return -1;
+
+		int value = 0;
+
+		for(int i = 0; i < length; i++, position++) value = (value << 1) | ((data[position >> 3] >> (7 - (position & 7))) & 1);
+
+		return value;
+	};
+
+	text.clear();
+
+	for(int mode = read(4); mode > 0; mode = read(4))
+	{
+		if(mode == 7)
+		{
+			int const designator = read(8);
+
+			if(designator < 0) return false;
+			if((designator & 0xc0) == 0x80) read(8);
+			if((designator & 0xe0) == 0xc0) read(16);
+
+			continue;
+		}
+
+		if(mode != 1 && mode != 2 && mode != 4) return false;
+
+		int length = read(mode == 1 ? 10 : mode == 2 ? 9 : 8);
+
+		if(length < 0) return false;
+
+		for(; length > 0; length -= mode == 1 ? 3 : mode == 2 ? 2 : 1)
+		{
+			if(mode == 1)
+			{
+				int const digits = std::min(length, 3);
+				int const value = read(digits == 3 ? 10 : digits == 2 ? 7 : 4);
+
+				if(value < 0 || value >= (digits == 3 ? 1000 : digits == 2 ? 100 : 10)) return false;
+
+				for(int divisor = digits == 3 ? 100 : digits == 2 ? 10 : 1; divisor > 0; divisor /= 10) text += (char) ('0' + (value / divisor) % 10);
+			}
+			else if(mode == 2)
+			{
+				int const value = read(length >= 2 ? 11 : 6);
+
+				if(value < 0 || value >= (length >= 2 ? 45 * 45 : 45)) return false;
+
+				if(length >= 2) text += cnst::CODE_ALPHANUMERIC[value / 45];
+
+				text += cnst::CODE_ALPHANUMERIC[value % 45];
+			}
+			else
+			{
+				int const value = read(8);
+
+				if(value < 0) return false;
+
+				text += (char) value;
+			}
+		}
+	}
+
+	return !text.empty();
+}
+
+/**
+	\brief member function
+
+	@param[out] text a reference to a std::string to be filled with the content of the code as function output
+	@param[in] gray a constant reference to a cv::Mat object containing the luma image the finder patterns are searched in
+	@param[in] pyramidLevel a constant int containing the number of times the frame was halved for the luma image
+	@param[in] offset a constant reference to a cv::Point object containing the position of the luma image origin in the frame
+	@param[in] frame a constant reference to a cv::Mat object containing RGBA frame data the code is sampled from
+
+	Locates a code in the luma image and estimates its version from the distance of the finder patterns in modules. The code is sampled from the frame at full resolution
+	for the estimated version and, if it can not be read, for the next larger and smaller one
+
+	@see qr::locate()
+	@see qr::sample()
+	@see qr::decodeModules()
+
+	@return true if a code was read, false otherwise
+*/
+bool qr::scan(std::string & text, cv::Mat const & gray, int const pyramidLevel, cv::Point const & offset, cv::Mat const & frame)
+{
+	TRACE_SCOPE("qr::scan");
+	ALLOCATION_SCOPE("qr::scan");
+	PERF_SCOPE("qr::scan", gray.total());
+
+	vector<cv::Point2f> finders;
+	float moduleSize;
+
+	if(!qr::locate(finders, moduleSize, gray)) return false;
+
+	float const scale = (float) (1 << pyramidLevel);
+
+	for(vector<cv::Point2f>::iterator it = finders.begin(); it != finders.end(); ++it)
+		*it = cv::Point2f((it->x + 0.5f) * scale - 0.5f + offset.x, (it->y + 0.5f) * scale - 0.5f + offset.y);
+
+	moduleSize *= scale;
+
+	double const span = (cv::norm(finders[1] - finders[0]) + cv::norm(finders[2] - finders[0])) / (2.0 * moduleSize);
+	int const estimate = cvRound((span - 10.0) / 4.0);
+	int const attempts[3] = { 0, 1, -1 };
+
+	vector<unsigned char> modules;
+
+	for(int i = 0; i < 3; i++)
+	{
+		int const version = estimate + attempts[i];
+
+		if(version < 1 || version > cnst::CODE_MAX_VERSION) continue;
+
+		if(qr::sample(modules, frame, finders, 4 * version + 17) && qr::decodeModules(text, modules, 4 * version + 17)) return true;
+	}
+
+	return false;
+}
@@ -0,0 +1,28 @@
+#ifndef FUNCTIONS_CODEFUNCTIONS_HPP_
+#define FUNCTIONS_CODEFUNCTIONS_HPP_
+
+#include <string>
+#include <vector>
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+#include "Constants.hpp"
+
+/**
+	\namespace qr
+
+	the namespace qr contains the function collection finding and decoding the QR codes which select the calibration, the actions and the boards.
+	The finder patterns are searched in a luma image of the pipeline, only the region of the code is cropped from the frame, rectified and sampled into modules.
+	Codes up to version cnst::CODE_MAX_VERSION are decoded with all error correction levels and the numeric, alphanumeric and byte mode, which covers the short
+	texts the app uses. Bytes are handed on unchanged and read as ISO-8859-1
+*/
+namespace qr
+{
+	void finderPatterns(std::vector<cv::Point2f> &, std::vector<float> &, cv::Mat const &);
+	bool locate(std::vector<cv::Point2f> &, float &, cv::Mat const &);
+	bool sample(std::vector<unsigned char> &, cv::Mat const &, std::vector<cv::Point2f> const &, int const);
+	bool correct(std::vector<unsigned char> &, int const);
+	bool decodeModules(std::string &, std::vector<unsigned char> const &, int const);
+	bool scan(std::string &, cv::Mat const &, int const, cv::Point const &, cv::Mat const &);
+}
+
+#endif /* FUNCTIONS_CODEFUNCTIONS_HPP_ */
@@ -1,10 +1,19 @@
 #ifndef FILEREADINGFUNCTIONS_HPP_
 #define FILEREADINGFUNCTIONS_HPP_
 
+#include <cstring>
+#include <fstream>
+#include <memory>
 #include <opencv2/opencv.hpp>
+#include "Constants.hpp"
 #include "AuxiliaryClasses/Board.hpp"
 #include "AuxiliaryClasses/Storage.hpp"
+#include "AuxiliaryClasses/Model.hpp"
+#include "AuxiliaryClasses/ModelImage.hpp"
+#include "AuxiliaryClasses/CameraModel.hpp"
+#ifdef __ANDROID__
 #include <android/log.h>
+#endif
 
 /** \namespace
 	part of the namespace readf which allows the reading of files as a function collection
@@ -53,7 +62,8 @@ namespace readf {
 
 		@param[in] filepath a constant reference of a std::string containing the path of the xml file used for data retrieval
 
-		Fetches all the data of the xml file and distributes it to the aux::Board and aux::Storage data structures
+		Fetches all the data of the xml file and distributes it to the aux::Board and aux::Storage data structures.
+		The optional physicalattributes entry referencemarkers set to 1 selects binary fiducial markers instead of colored stickers as reference
 
 		@see fetchComponentsAttributes()
 		@see proc::asmb::board
@@ -92,7 +102,9 @@ namespace readf {
 
 		fs["physicalattributes"]["distRefsToBoardCorners"] >> m;
 
-		board = aux::Board<T1>(name, components, originXY, refDimensions, boardDimensions, rotation, m);
+		bool markers = (bool) ((int) fs["physicalattributes"]["referencemarkers"]);
+
+		board = aux::Board<T1>(name, components, originXY, refDimensions, boardDimensions, rotation, m, markers);
 
 
 		std::vector<int> storageMatrix = {
@@ -126,6 +138,117 @@ namespace readf {
 
 		fs.release();
 	}
+
+	/**
+		\brief member inline function
+
+		@param filepath a constant reference of a std::string containing the path of the configuration file
+
+		@return true if the file starts with the magic of a compiled aux::ModelImage, false otherwise
+
+		@see cnst::MODEL_IMAGE_MAGIC
+	*/
+	inline bool isModelImage(std::string const & filepath)
+	{
+		char magic[sizeof(cnst::MODEL_IMAGE_MAGIC)];
+		std::ifstream file(filepath.c_str(), std::ios::binary);
+
+		return file.read(magic, sizeof(magic)) && std::memcmp(magic, cnst::MODEL_IMAGE_MAGIC, sizeof(magic)) == 0;
+	}
+
+	/**
+		\brief member inline function
+
+		@param filepath a constant reference of a std::string containing the path of either a compiled model image or an xml file
+
+		Maps a compiled model image and uses it in place, any other file is parsed as xml via readFile().
+		A model image failing validation is rejected instead of being parsed
+
+		@see isModelImage()
+		@see readFile<T1, T2>()
+		@see aux::ModelImage
+		@see aux::Model
+
+		@return a std::shared_ptr to the created aux::Model, empty if the model image is invalid
+	*/
+	inline std::shared_ptr<aux::Model const> readModel(std::string const & filepath)
+	{
+		if(isModelImage(filepath))
+		{
+			std::shared_ptr<aux::ModelImage const> image = std::make_shared<aux::ModelImage const>(filepath);
+
+			if(image->valid()) return std::make_shared<aux::Model const>(image);
+
+#ifdef __ANDROID__
+			__android_log_print(ANDROID_LOG_ERROR, "readf", "rejected invalid model image %s", filepath.c_str());
+#endif
+
+			return std::shared_ptr<aux::Model const>();
+		}
+
+		aux::Board<double> board;
+		aux::Storage<double> storage;
+
+		readFile<double, double>(board, storage, filepath);
+
+		return std::make_shared<aux::Model const>(board, storage);
+	}
+
+	/**
+		\brief member inline function
+
+		@param filepath a constant reference of a std::string containing the path of the configuration file
+
+		Reads the optional cameramodel entry of an xml file with the camera_matrix, the distortion_coefficients, image_width and image_height
+		in the layout cv::calibrateCamera() results are saved in. Missing distortion coefficients are zero, further ones are ignored.
+		A model image carries the camera model the model compiler read from its xml file.
+		The model is built for the calibrated image size, aux::Session::camera() rebuilds it for the frames
+
+		@see isModelImage()
+		@see aux::ModelImage::camera()
+		@see aux::CameraModel
+		@see cnst::CAMERA_DISTORTION_COEFFICIENTS
+
+		@return a std::shared_ptr to the created aux::CameraModel, empty if the file has no valid camera model
+	*/
+	inline std::shared_ptr<aux::CameraModel const> readCameraModel(std::string const & filepath)
+	{
+		if(isModelImage(filepath))
+		{
+			aux::ModelImage const image(filepath);
+
+			return image.valid() ? image.camera() : std::shared_ptr<aux::CameraModel const>();
+		}
+
+		cv::FileStorage fs(filepath, cv::FileStorage::READ);
+		cv::FileNode node = fs.isOpened() ? fs["cameramodel"] : cv::FileNode();
+
+		if(node.empty()) return std::shared_ptr<aux::CameraModel const>();
+
+		cv::Mat m, d;
+
+		node["camera_matrix"] >> m;
+		node["distortion_coefficients"] >> d;
+
+		cv::Size const size((int) node["image_width"], (int) node["image_height"]);
+
+		fs.release();
+
+		if(m.rows != 3 || m.cols != 3 || size.width <= 0 || size.height <= 0) return std::shared_ptr<aux::CameraModel const>();
+
+		cv::Matx33d cameraMatrix;
+		cv::Vec<double, cnst::CAMERA_DISTORTION_COEFFICIENTS> distortion;
+
+		m.convertTo(m, CV_64F);
+		d.convertTo(d, CV_64F);
+
+		for(int i = 0; i < 9; i++) cameraMatrix.val[i] = m.at<double>(i / 3, i % 3);
+		for(int i = 0; i < cnst::CAMERA_DISTORTION_COEFFICIENTS; i++) distortion[i] = i < (int) d.total() ? d.at<double>(i) : 0.0;
+
+		if(!(cameraMatrix(0, 0) > 0.0) || !(cameraMatrix(1, 1) > 0.0)) return std::shared_ptr<aux::CameraModel const>();
+
+		return std::make_shared<aux::CameraModel const>(cameraMatrix, distortion, size, size);
+	}
 }
 
 #endif /* FILEREADINGFUNCTIONS_HPP_ */
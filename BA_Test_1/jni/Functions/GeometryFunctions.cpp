@@ -1,3 +1,5 @@
+#include <cmath>
+#include <limits>
 #include "Functions/GeometryFunctions.hpp"
 #include "Constants.hpp"
 using namespace std;
@@ -163,3 +165,135 @@ bool const geo::areTargetAnglesSufficient(std::vector<cv::Point> const & points)
 
 	return (diffA + diffB + diffC + diffD) / points.size() < cnst::MAXIMUM_VALUE_CORRECT_ANGLE;
 }
+
+/**
+	\brief member function
+
+	@param boardPoints a constant reference to a std::vector containing the corner points of the board in the frame in the order top left, bottom left, bottom right, top right
+	@param boardWidth a constant double containing the width of the board
+	@param boardHeight a constant double containing the height of the board
+	@param frameSize a constant reference to a cv::Size object containing the dimensions of the frame
+
+	@see cnst::NUMBER_CORNERS
+	@see cnst::VISIBLE_REGION_MARGIN
+
+	Maps the frame corners into board coordinates via the inverse perspective given by the board corners.
+	The bounding box of the mapped corners is widened by a margin since the assembly locations are placed piecewise affine, not perspective
+
+	@return a constant cv::Rect_ of double containing the visible part of the board in board coordinates, the whole board if the frame corners cannot be mapped
+*/
+cv::Rect_<double> const geo::visibleBoardRegion(std::vector<cv::Point> const & boardPoints, double const boardWidth, double const boardHeight, cv::Size const & frameSize)
+{
+	cv::Rect_<double> board(0, 0, boardWidth, boardHeight);
+
+	if(boardPoints.size() != cnst::NUMBER_CORNERS) return board;
+
+	cv::Point2f imageCorners[cnst::NUMBER_CORNERS];
+
+	for(int i = 0; i < cnst::NUMBER_CORNERS; i++) imageCorners[i] = cv::Point2f((float) boardPoints[i].x, (float) boardPoints[i].y);
+
+	cv::Point2f boardCorners[] = { cv::Point2f(0, 0), cv::Point2f(0, boardHeight), cv::Point2f(boardWidth, boardHeight), cv::Point2f(boardWidth, 0) };
+	cv::Point2f frameCorners[] = { cv::Point2f(0, 0), cv::Point2f(0, frameSize.height), cv::Point2f(frameSize.width, frameSize.height), cv::Point2f(frameSize.width, 0) };
+
+	cv::Mat h = cv::getPerspectiveTransform(imageCorners, boardCorners);
+
+	double left = boardWidth, top = boardHeight, right = 0, bottom = 0;
+
+	for(int i = 0; i < cnst::NUMBER_CORNERS; i++)
+	{
+		double x = h.at<double>(0, 0) * frameCorners[i].x + h.at<double>(0, 1) * frameCorners[i].y + h.at<double>(0, 2);
+		double y = h.at<double>(1, 0) * frameCorners[i].x + h.at<double>(1, 1) * frameCorners[i].y + h.at<double>(1, 2);
+		double w = h.at<double>(2, 0) * frameCorners[i].x + h.at<double>(2, 1) * frameCorners[i].y + h.at<double>(2, 2);
+
+		if(!(w > 0)) return board;
+
+		left = std::min(left, x / w);
+		right = std::max(right, x / w);
+		top = std::min(top, y / w);
+		bottom = std::max(bottom, y / w);
+	}
+
+	double marginX = cnst::VISIBLE_REGION_MARGIN * boardWidth;
+	double marginY = cnst::VISIBLE_REGION_MARGIN * boardHeight;
+
+	left = std::max(left - marginX, 0.0);
+	top = std::max(top - marginY, 0.0);
+	right = std::min(right + marginX, boardWidth);
+	bottom = std::min(bottom + marginY, boardHeight);
+
+	if(right < left || bottom < top) return cv::Rect_<double>();
+
+	return cv::Rect_<double>(left, top, right - left, bottom - top);
+}
+
+/**
+	\brief member function
+
+	@param boardPoints a constant reference to a std::vector containing the corner points of the board in the frame in the order top left, bottom left, bottom right, top right
+	@param boardWidth a constant double containing the width of the board
+	@param boardHeight a constant double containing the height of the board
+
+	@see geo::norm<T>()
+
+	Calculates the largest scale of the board edges in the frame, so no location larger than a pixel is considered smaller
+
+	@return a constant double containing the number of pixels per board unit
+*/
+double const geo::pixelsPerBoardUnit(std::vector<cv::Point> const & boardPoints, double const boardWidth, double const boardHeight)
+{
+	double scale = 0;
+
+	for(int i = 0; i < cnst::NUMBER_CORNERS; i++)
+	{
+		double length = geo::norm<double>(boardPoints[(i + 1) % cnst::NUMBER_CORNERS] - boardPoints[i]);
+
+		scale = std::max(scale, length / (i % 2 == 0 ? boardHeight : boardWidth));
+	}
+
+	return scale;
+}
+
+/**
+	\brief member function
+
+	@param points a constant reference to a std::vector containing the reference sticker centers in the order top left, bottom left, bottom right, top right
+	@param aspect a constant double containing the configured width of the reference stickers divided by their height
+
+	@see geo::norm<T>()
+	@see geo::cross<T>()
+	@see geo::angleDeg<T>()
+
+	Rates how well the points form the reference stickers of one board or storage seen with little perspective. The score adds the difference of the opposite edges
+	relative to their length, the deviation of the corner angles from a right angle relative to one and the logarithmic deviation from the configured aspect ratio
+
+	@return a constant double containing 0 for a perfect rectangle of the configured aspect ratio, the larger the less consistent, infinity if the points do not form a convex quadrilateral
+*/
+double const geo::referenceQuadScore(std::vector<cv::Point> const & points, double const aspect)
+{
+	double const infinity = std::numeric_limits<double>::infinity();
+	double sign = 0.0;
+	double angles = 0.0;
+
+	for(int i = 0; i < cnst::NUMBER_CORNERS; i++)
+	{
+		cv::Point const a = points[(i + 1) % cnst::NUMBER_CORNERS] - points[i];
+		cv::Point const b = points[(i + 2) % cnst::NUMBER_CORNERS] - points[(i + 1) % cnst::NUMBER_CORNERS];
+
+		double const turn = geo::cross<double>(a, b);
+
+		if(turn == 0.0 || turn * sign < 0.0) return infinity;
+
+		sign = turn;
+		angles += std::abs(cnst::RIGHT_ANGLE - geo::angleDeg<double>(points[(i + 1) % cnst::NUMBER_CORNERS] - points[i], points[(i + 3) % cnst::NUMBER_CORNERS] - points[i]));
+	}
+
+	cv::Point const top = points[3] - points[0], bottom = points[2] - points[1];
+	cv::Point const left = points[1] - points[0], right = points[2] - points[3];
+
+	double const width = geo::norm<double>(top) + geo::norm<double>(bottom);
+	double const height = geo::norm<double>(left) + geo::norm<double>(right);
+
+	double const parallel = geo::norm<double>(top - bottom) / width + geo::norm<double>(left - right) / height;
+
+	return parallel + angles / (cnst::NUMBER_CORNERS * cnst::RIGHT_ANGLE) + std::abs(std::log(width / height / aspect));
+}
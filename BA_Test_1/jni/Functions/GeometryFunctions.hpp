@@ -3,6 +3,8 @@
 
 #include "AuxiliaryClasses/Board.hpp"
 #include "AuxiliaryClasses/Storage.hpp"
+#include "AuxiliaryClasses/PlacementIndex.hpp"
+#include "AuxiliaryClasses/BoardTable.hpp"
 #include <opencv2/core/core.hpp>
 #include "AuxiliaryClasses/TypeValidator.hpp"
 #include "Constants.hpp"
@@ -21,7 +23,8 @@ namespace geo
 		@tparam T a primitive data type of the type int, float, double, long, long long or long double
 
 		@param boardPoints a constant reference of a std::vector containing cv::Point objects
-		@param board a reference to a aux::Board object of T
+		@param boardWidth a constant T type variable containing the width of the board
+		@param boardHeight a constant T type variable containing the height of the board
 		@param coordX a constant T type variable containing the x coordinate of the assembly location
 		@param coordY a constant T type variable containing the y coordinate of the assembly location
 		@param mX a constant T type variable containing the x coordinate of the center of the assembly location
@@ -34,28 +37,52 @@ namespace geo
 		@return a constant std::vector containing the corner points of the assembly location in the order top left, bottom left, bottom right, top right
 	*/
 	template <typename T>
-	inline std::vector<cv::Point> const generateAssemblyLocation(std::vector<cv::Point> const & boardPoints, aux::Board<T> & board, T const coordX, T const coordY, T const mX, T const mY, T const cornerX, T const cornerY)
+	inline std::vector<cv::Point> const generateAssemblyLocation(std::vector<cv::Point> const & boardPoints, T const boardWidth, T const boardHeight, T const coordX, T const coordY, T const mX, T const mY, T const cornerX, T const cornerY)
 	{
 		cv::Point tlc, blc, brc, trc;
 
-		if(coordY >= board.boardDimensions()[1] / 2)
+		if(coordY >= boardHeight / 2)
 		{
-			tlc = cv::Point(boardPoints[1] +  (coordX + mX + cornerX) / board.boardDimensions()[0] * (boardPoints[2] - boardPoints[1]) + (1 - (coordY + mY + cornerY) / board.boardDimensions()[1]) * (boardPoints[3] - boardPoints[2]));
-			blc = cv::Point(boardPoints[1] +  (coordX + mX + cornerX) / board.boardDimensions()[0] * (boardPoints[2] - boardPoints[1]) + (1 - (coordY + mY - cornerY) / board.boardDimensions()[1]) * (boardPoints[3] - boardPoints[2]));
-			brc = cv::Point(boardPoints[1] +  (coordX + mX - cornerX) / board.boardDimensions()[0] * (boardPoints[2] - boardPoints[1]) + (1 - (coordY + mY - cornerY) / board.boardDimensions()[1]) * (boardPoints[3] - boardPoints[2]));
-			trc = cv::Point(boardPoints[1] +  (coordX + mX - cornerX) / board.boardDimensions()[0] * (boardPoints[2] - boardPoints[1]) + (1 - (coordY + mY + cornerY) / board.boardDimensions()[1]) * (boardPoints[3] - boardPoints[2]));
+			tlc = cv::Point(boardPoints[1] +  (coordX + mX + cornerX) / boardWidth * (boardPoints[2] - boardPoints[1]) + (1 - (coordY + mY + cornerY) / boardHeight) * (boardPoints[3] - boardPoints[2]));
+			blc = cv::Point(boardPoints[1] +  (coordX + mX + cornerX) / boardWidth * (boardPoints[2] - boardPoints[1]) + (1 - (coordY + mY - cornerY) / boardHeight) * (boardPoints[3] - boardPoints[2]));
+			brc = cv::Point(boardPoints[1] +  (coordX + mX - cornerX) / boardWidth * (boardPoints[2] - boardPoints[1]) + (1 - (coordY + mY - cornerY) / boardHeight) * (boardPoints[3] - boardPoints[2]));
+			trc = cv::Point(boardPoints[1] +  (coordX + mX - cornerX) / boardWidth * (boardPoints[2] - boardPoints[1]) + (1 - (coordY + mY + cornerY) / boardHeight) * (boardPoints[3] - boardPoints[2]));
 		}
 		else
 		{
-			tlc = cv::Point(boardPoints[0] +  (coordX + mX - cornerX) / board.boardDimensions()[0] * (boardPoints[3] - boardPoints[0]) + (coordY + mY - cornerY) / board.boardDimensions()[1] * (boardPoints[2] - boardPoints[3]));
-			blc = cv::Point(boardPoints[0] +  (coordX + mX - cornerX) / board.boardDimensions()[0] * (boardPoints[3] - boardPoints[0]) + (coordY + mY + cornerY) / board.boardDimensions()[1] * (boardPoints[2] - boardPoints[3]));
-			brc = cv::Point(boardPoints[0] +  (coordX + mX + cornerX) / board.boardDimensions()[0] * (boardPoints[3] - boardPoints[0]) + (coordY + mY + cornerY) / board.boardDimensions()[1] * (boardPoints[2] - boardPoints[3]));
-			trc = cv::Point(boardPoints[0] +  (coordX + mX + cornerX) / board.boardDimensions()[0] * (boardPoints[3] - boardPoints[0]) + (coordY + mY - cornerY) / board.boardDimensions()[1] * (boardPoints[2] - boardPoints[3]));
+			tlc = cv::Point(boardPoints[0] +  (coordX + mX - cornerX) / boardWidth * (boardPoints[3] - boardPoints[0]) + (coordY + mY - cornerY) / boardHeight * (boardPoints[2] - boardPoints[3]));
+			blc = cv::Point(boardPoints[0] +  (coordX + mX - cornerX) / boardWidth * (boardPoints[3] - boardPoints[0]) + (coordY + mY + cornerY) / boardHeight * (boardPoints[2] - boardPoints[3]));
+			brc = cv::Point(boardPoints[0] +  (coordX + mX + cornerX) / boardWidth * (boardPoints[3] - boardPoints[0]) + (coordY + mY + cornerY) / boardHeight * (boardPoints[2] - boardPoints[3]));
+			trc = cv::Point(boardPoints[0] +  (coordX + mX + cornerX) / boardWidth * (boardPoints[3] - boardPoints[0]) + (coordY + mY - cornerY) / boardHeight * (boardPoints[2] - boardPoints[3]));
 		}
 
 		return std::vector<cv::Point> { tlc, blc, brc, trc };
 	}
 
+	/**
+		\brief member inline function
+
+		@tparam T a primitive data type of the type int, float, double, long, long long or long double
+
+		@param boardPoints a constant reference of a std::vector containing cv::Point objects
+		@param board a constant reference to a aux::Board object of T
+		@param coordX a constant T type variable containing the x coordinate of the assembly location
+		@param coordY a constant T type variable containing the y coordinate of the assembly location
+		@param mX a constant T type variable containing the x coordinate of the center of the assembly location
+		@param mX a constant T type variable containing the y coordinate of the center of the assembly location
+		@param cornerX a constant T type variable containing the x coordinate of the outer corner of the assembly location
+		@param cornerY a constant T type variable containing the y coordinate of the outer corner of the assembly location
+
+		Calculates the geometric vectors to the corner points of the assembly location.
+
+		@return a constant std::vector containing the corner points of the assembly location in the order top left, bottom left, bottom right, top right
+	*/
+	template <typename T>
+	inline std::vector<cv::Point> const generateAssemblyLocation(std::vector<cv::Point> const & boardPoints, aux::Board<T> const & board, T const coordX, T const coordY, T const mX, T const mY, T const cornerX, T const cornerY)
+	{
+		return geo::generateAssemblyLocation<T>(boardPoints, board.boardDimensions()[0], board.boardDimensions()[1], coordX, coordY, mX, mY, cornerX, cornerY);
+	}
+
 	/**
 		\brief member inline function
 
@@ -63,7 +90,7 @@ namespace geo
 
 		@param[out] assemblyLocations a reference of a std::vector of std::vectors containing cv::Point objects to be filled with assembly locations as function output
 		@param[in] boardPoints a constant reference to a std::vector containing cv::Point objects
-		@param[in] board a reference to a aux::Board object
+		@param[in] board a constant reference to a aux::Board object
 		@param[in] compNum an constant int containing the number of the box the component is stored in
 
 		@see aux::TypeValidator::validateType()
@@ -72,7 +99,7 @@ namespace geo
 		Fills assemblyLocations data structure with all the geometric vectors to all assembly locations for all components.
 	*/
 	template <typename T>
-	inline void assemblyPointsVector(std::vector<std::vector<cv::Point>> & assemblyLocations, std::vector<cv::Point> const & boardPoints, aux::Board<T> & board, int const compNum)
+	inline void assemblyPointsVector(std::vector<std::vector<cv::Point>> & assemblyLocations, std::vector<cv::Point> const & boardPoints, aux::Board<T> const & board, int const compNum)
 	{
 		T validator;
 		aux::TypeValidator::validateType(validator);
@@ -92,12 +119,163 @@ namespace geo
 		}
 	}
 
+	cv::Rect_<double> const visibleBoardRegion(std::vector<cv::Point> const &, double const, double const, cv::Size const &);
+	double const pixelsPerBoardUnit(std::vector<cv::Point> const &, double const, double const);
+	double const referenceQuadScore(std::vector<cv::Point> const &, double const);
+
+	/**
+		\brief member inline function
+
+		@tparam T a primitive data type of the type int, float, double, long, long long or long double
+
+		@param[out] assemblyLocations a reference of a std::vector of std::vectors containing cv::Point objects to be filled with assembly locations as function output
+		@param[in] boardPoints a constant reference to a std::vector containing cv::Point objects
+		@param[in] board a constant reference to a aux::Board object
+		@param[in] index a constant reference to the aux::PlacementIndex of the board
+		@param[in] compNum an constant int containing the number of the component
+		@param[in] frameSize a constant reference to a cv::Size object containing the dimensions of the frame
+
+		@see aux::TypeValidator::validateType()
+		@see geo::visibleBoardRegion()
+		@see geo::pixelsPerBoardUnit()
+		@see aux::PlacementIndex::query()
+		@see geo::generateAssemblyLocation<T>()
+
+		Fills assemblyLocations data structure with the assembly locations of the component which are within the frame and larger than a pixel.
+		The cost depends on the number of visible locations instead of the number of occurrences on the board
+	*/
+	template <typename T>
+	inline void assemblyPointsVector(std::vector<std::vector<cv::Point>> & assemblyLocations, std::vector<cv::Point> const & boardPoints, aux::Board<T> const & board, aux::PlacementIndex const & index, int const compNum, cv::Size const & frameSize)
+	{
+		T validator;
+		aux::TypeValidator::validateType(validator);
+
+		std::vector<aux::PlacementIndex::Placement const *> visible;
+
+		cv::Rect_<double> region = geo::visibleBoardRegion(boardPoints, board.boardDimensions()[0], board.boardDimensions()[1], frameSize);
+		double scale = geo::pixelsPerBoardUnit(boardPoints, board.boardDimensions()[0], board.boardDimensions()[1]);
+
+		index.query(visible, compNum, region, scale > 0 ? 1.0 / scale : 0.0);
+
+		for(std::size_t i = 0; i < visible.size(); i++)
+		{
+			aux::PlacementIndex::Placement const & p = *visible[i];
+
+			assemblyLocations.push_back(geo::generateAssemblyLocation<T>(boardPoints, board, p.coordX, p.coordY, p.mX, p.mY, p.cornerX, p.cornerY));
+		}
+	}
+
+	/**
+		\brief member inline function
+
+		@param[out] assemblyLocations a reference of a std::vector of std::vectors containing cv::Point objects to be appended with the assembly locations of all placements in their order as function output
+		@param[in] boardPoints a constant reference to a std::vector containing cv::Point objects
+		@param[in] boardWidth a constant double containing the width of the board
+		@param[in] boardHeight a constant double containing the height of the board
+		@param[in] placements a constant reference to a std::vector containing pointers to the placements of any number of components
+
+		@see geo::generateAssemblyLocation<T>()
+
+		Maps the placements of many components into the frame in one batch. The edges of both board halves are taken once and every corner
+		is derived from them exactly like geo::generateAssemblyLocation<T>() does, so each location equals the one of a single component
+	*/
+	inline void assemblyPointsVector(std::vector<std::vector<cv::Point>> & assemblyLocations, std::vector<cv::Point> const & boardPoints, double const boardWidth, double const boardHeight, std::vector<aux::PlacementIndex::Placement const *> const & placements)
+	{
+		cv::Point const bottomX = boardPoints[2] - boardPoints[1], bottomY = boardPoints[3] - boardPoints[2];
+		cv::Point const topX = boardPoints[3] - boardPoints[0], topY = boardPoints[2] - boardPoints[3];
+
+		assemblyLocations.reserve(assemblyLocations.size() + placements.size());
+
+		for(std::size_t i = 0; i < placements.size(); i++)
+		{
+			aux::PlacementIndex::Placement const & p = *placements[i];
+
+			double const x = p.coordX + p.mX;
+			double const y = p.coordY + p.mY;
+
+			std::vector<cv::Point> corners(cnst::NUMBER_CORNERS);
+
+			if(p.coordY >= boardHeight / 2)
+			{
+				corners[0] = boardPoints[1] + (x + p.cornerX) / boardWidth * bottomX + (1 - (y + p.cornerY) / boardHeight) * bottomY;
+				corners[1] = boardPoints[1] + (x + p.cornerX) / boardWidth * bottomX + (1 - (y - p.cornerY) / boardHeight) * bottomY;
+				corners[2] = boardPoints[1] + (x - p.cornerX) / boardWidth * bottomX + (1 - (y - p.cornerY) / boardHeight) * bottomY;
+				corners[3] = boardPoints[1] + (x - p.cornerX) / boardWidth * bottomX + (1 - (y + p.cornerY) / boardHeight) * bottomY;
+			}
+			else
+			{
+				corners[0] = boardPoints[0] + (x - p.cornerX) / boardWidth * topX + (y - p.cornerY) / boardHeight * topY;
+				corners[1] = boardPoints[0] + (x - p.cornerX) / boardWidth * topX + (y + p.cornerY) / boardHeight * topY;
+				corners[2] = boardPoints[0] + (x + p.cornerX) / boardWidth * topX + (y + p.cornerY) / boardHeight * topY;
+				corners[3] = boardPoints[0] + (x + p.cornerX) / boardWidth * topX + (y - p.cornerY) / boardHeight * topY;
+			}
+
+			assemblyLocations.push_back(std::move(corners));
+		}
+	}
+
+	/**
+		\brief member inline function
+
+		@tparam N a std::size_t containing the number of placements known at compile time
+
+		@param[out] assemblyLocations a reference of a std::vector of std::vectors containing cv::Point objects to be filled with assembly locations as function output
+		@param[in] boardPoints a constant reference to a std::vector containing cv::Point objects
+		@param[in] placements a constant reference to an array of the constant placements of a component of a compiled in aux::BoardTable
+		@param[in] boardWidth a constant double containing the width of the board
+		@param[in] boardHeight a constant double containing the height of the board
+
+		@see geo::generateAssemblyLocation<T>()
+
+		Fills assemblyLocations data structure with the assembly locations of all placements, the loop bound is a constant expression.
+	*/
+	template <std::size_t N>
+	inline void assemblyPointsVector(std::vector<std::vector<cv::Point>> & assemblyLocations, std::vector<cv::Point> const & boardPoints, aux::PlacementIndex::Placement const (& placements)[N], double const boardWidth, double const boardHeight)
+	{
+		for(std::size_t i = 0; i < N; i++)
+			assemblyLocations.push_back(geo::generateAssemblyLocation<double>(boardPoints, boardWidth, boardHeight, placements[i].coordX, placements[i].coordY, placements[i].mX, placements[i].mY, placements[i].cornerX, placements[i].cornerY));
+	}
+
+	/**
+		\brief member inline function
+
+		@param[out] assemblyLocations a reference of a std::vector of std::vectors containing cv::Point objects to be filled with assembly locations as function output
+		@param[in] boardPoints a constant reference to a std::vector containing cv::Point objects
+		@param[in] table a constant reference to a compiled in aux::BoardTable
+		@param[in] compNum an constant int containing the number of the component
+		@param[in] frameSize a constant reference to a cv::Size object containing the dimensions of the frame
+
+		@see geo::visibleBoardRegion()
+		@see geo::pixelsPerBoardUnit()
+		@see aux::PlacementIndex::query()
+		@see geo::generateAssemblyLocation<T>()
+
+		Fills assemblyLocations data structure with the assembly locations of the component which are within the frame and larger than a pixel
+		directly from the constant grid tables of the board without an aux::Board or aux::Model.
+	*/
+	inline void assemblyPointsVector(std::vector<std::vector<cv::Point>> & assemblyLocations, std::vector<cv::Point> const & boardPoints, aux::BoardTable const & table, int const compNum, cv::Size const & frameSize)
+	{
+		std::vector<aux::PlacementIndex::Placement const *> visible;
+
+		cv::Rect_<double> region = geo::visibleBoardRegion(boardPoints, table.boardDimensions[0], table.boardDimensions[1], frameSize);
+		double scale = geo::pixelsPerBoardUnit(boardPoints, table.boardDimensions[0], table.boardDimensions[1]);
+
+		aux::PlacementIndex::query(visible, table.components[compNum].grid, region, scale > 0 ? 1.0 / scale : 0.0);
+
+		for(std::size_t i = 0; i < visible.size(); i++)
+		{
+			aux::PlacementIndex::Placement const & p = *visible[i];
+
+			assemblyLocations.push_back(geo::generateAssemblyLocation<double>(boardPoints, table.boardDimensions[0], table.boardDimensions[1], p.coordX, p.coordY, p.mX, p.mY, p.cornerX, p.cornerY));
+		}
+	}
+
 	/**
 		\brief member inline function
 
 		@tparam T a primitive data type of the type int, float, double, long, long long or long double
 
-		@param storage a reference to a aux::Storage object
+		@param storage a constant reference to a aux::Storage object
 		@param col a constant int containing the column number
 		@param row a constant int containing the row number
 
@@ -108,7 +286,7 @@ namespace geo
 		@return a constant std::vector of T data type containing the geometric vector factors
 	*/
 	template <typename T>
-	inline std::vector<T> const withdrawalGridPointsVectorsFactors(aux::Storage<T> & storage, int const col, int const row)
+	inline std::vector<T> const withdrawalGridPointsVectorsFactors(aux::Storage<T> const & storage, int const col, int const row)
 	{
 		T validator;
 		aux::TypeValidator::validateType(validator);
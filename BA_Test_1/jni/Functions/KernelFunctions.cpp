@@ -0,0 +1,289 @@
+#include <atomic>
+#include <cmath>
+#include "Functions/KernelFunctions.hpp"
+#include "AuxiliaryClasses/Trace.hpp"
+#include "AuxiliaryClasses/PerfCounters.hpp"
+#include "AuxiliaryClasses/AllocationTracker.hpp"
+
+#if defined(__arm__) && !defined(__aarch64__)
+#ifdef __ANDROID__
+#include <cpu-features.h>
+#else
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
+
+using namespace std;
+
+/**
+	\struct Dispatch
+	\brief the kernels of every instruction set, whether the processor supports them and the instruction set in use
+*/
+struct Dispatch
+{
+	krnl::Kernels tables[krnl::ISAS];
+	bool available[krnl::ISAS];
+	atomic<int> active;
+};
+
+/**
+	\brief static function
+
+	@param[in] isa a constant krnl::Isa
+
+	@return a bool containing whether the processor reports the features the instruction set needs, true for krnl::SCALAR
+*/
+static bool processorSupports(krnl::Isa const isa)
+{
+	switch(isa)
+	{
+		case krnl::SCALAR:
+			return true;
+#if defined(__aarch64__)
+		case krnl::NEON:
+			return true;
+#elif defined(__arm__) && defined(__ANDROID__)
+		case krnl::NEON:
+			return android_getCpuFamily() == ANDROID_CPU_FAMILY_ARM && (android_getCpuFeatures() & ANDROID_CPU_ARM_FEATURE_NEON) != 0;
+#elif defined(__arm__)
+		case krnl::NEON:
+			return (getauxval(AT_HWCAP) & HWCAP_NEON) != 0;
+#elif defined(__i386__) || defined(__x86_64__)
+		case krnl::SSE41:
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("sse4.1");
+		case krnl::AVX2:
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2");
+#endif
+		default:
+			return false;
+	}
+}
+
+/**
+	\brief static function
+
+	Fills the kernels of every instruction set the library is compiled with, a kernel without variant falls back to the scalar one.
+	The preferred instruction set the processor supports becomes active. The object is built by the first call, which is thread safe since C++11
+
+	@return a reference to the Dispatch of the process
+*/
+static Dispatch & dispatch()
+{
+	static Dispatch * const d = [] {
+		Dispatch * d = new Dispatch();
+		bool (* const fill[krnl::ISAS])(krnl::Kernels &) = { 0, krnl::neonKernels, krnl::sse41Kernels, krnl::avx2Kernels };
+
+		krnl::scalarKernels(d->tables[krnl::SCALAR]);
+		d->available[krnl::SCALAR] = true;
+		d->active = krnl::SCALAR;
+
+		for(int i = krnl::SCALAR + 1; i < krnl::ISAS; i++)
+		{
+			d->tables[i] = d->tables[krnl::SCALAR];
+			d->available[i] = fill[i](d->tables[i]) && processorSupports((krnl::Isa) i);
+
+			if(d->available[i]) d->active = i;
+		}
+
+		return d;
+	}();
+
+	return *d;
+}
+
+/**
+	\brief member function
+
+	@param[out] kernels a reference to the krnl::Kernels to be filled with the scalar references of every layout as function output
+
+	The scalar kernels are the reference every other variant is checked against. NV21 has no gain kernel, its chroma cannot be scaled per channel without a color conversion
+
+	@see krnl::gainScalar()
+	@see krnl::lumaScalar()
+*/
+void krnl::scalarKernels(krnl::Kernels & kernels)
+{
+	kernels.gain[RGBA8888] = gainScalar<RGBA8888>;
+	kernels.gain[RGB888] = gainScalar<RGB888>;
+	kernels.gain[BGR] = gainScalar<BGR>;
+	kernels.gain[NV21] = 0;
+
+	kernels.luma[RGBA8888] = lumaScalar<RGBA8888>;
+	kernels.luma[RGB888] = lumaScalar<RGB888>;
+	kernels.luma[BGR] = lumaScalar<BGR>;
+	kernels.luma[NV21] = lumaScalar<NV21>;
+}
+
+/**
+	\brief member function
+
+	@param[in] isa a constant krnl::Isa
+
+	@return a bool containing whether the library is compiled with the instruction set and the processor supports it
+*/
+bool krnl::supported(krnl::Isa const isa)
+{
+	return isa >= SCALAR && isa < ISAS && dispatch().available[isa];
+}
+
+/**
+	\brief member function
+
+	@param[in] isa a constant krnl::Isa, which has to be supported
+
+	@return a constant reference to the krnl::Kernels of the instruction set
+
+	@see krnl::supported()
+*/
+krnl::Kernels const & krnl::kernels(krnl::Isa const isa)
+{
+	return dispatch().tables[isa];
+}
+
+/**
+	\brief member function
+
+	@return a krnl::Isa containing the instruction set krnl::gain() and krnl::luma() run with
+*/
+krnl::Isa krnl::active()
+{
+	return (Isa) dispatch().active.load();
+}
+
+/**
+	\brief member function
+
+	@param[in] isa a constant krnl::Isa to be used by the following calls of krnl::gain() and krnl::luma()
+
+	Lets the Benchmark tool compare the variants in the same process, the library itself keeps the instruction set chosen at the first call
+
+	@return a bool containing true if the instruction set is supported and selected, false otherwise
+*/
+bool krnl::select(krnl::Isa const isa)
+{
+	if(!supported(isa)) return false;
+
+	dispatch().active = isa;
+
+	return true;
+}
+
+/**
+	\brief member function
+
+	@param[in] isa a constant krnl::Isa
+
+	@return a constant char pointer containing the name of the instruction set
+*/
+char const * krnl::name(krnl::Isa const isa)
+{
+	static char const * const names[ISAS] = { "scalar", "neon", "sse4.1", "avx2" };
+
+	return isa >= SCALAR && isa < ISAS ? names[isa] : "unknown";
+}
+
+/**
+	\brief member function
+
+	@param[in] factor a constant double containing a color correction factor
+
+	@return an unsigned short containing the factor with cnst::KERNEL_GAIN_SHIFT fractional bits, clamped to 0 and cnst::KERNEL_GAIN_MAX
+*/
+unsigned short krnl::fixedGain(double const factor)
+{
+	double const fixed = floor(factor * cnst::KERNEL_GAIN_ONE + 0.5);
+
+	return (unsigned short) (fixed < 0.0 ? 0.0 : fixed > cnst::KERNEL_GAIN_MAX ? cnst::KERNEL_GAIN_MAX : fixed);
+}
+
+/**
+	\brief member function
+
+	@param[out] layout a reference to a krnl::Layout to be set to the layout of the frame as function output
+	@param[in] frame a constant reference to a cv::Mat object containing frame data
+
+	Frames of the camera and of the recordings are RGBA, a frame of three channels is taken as RGB like the conversions of the pipeline do.
+	A frame of one channel has to be passed as krnl::NV21 explicitly, since it cannot be told apart from a luma image
+
+	@return a bool containing true if the frame has a layout with color channels, false otherwise
+*/
+bool krnl::layout(krnl::Layout & layout, cv::Mat const & frame)
+{
+	if(frame.depth() != CV_8U) return false;
+
+	switch(frame.channels())
+	{
+		case 4: layout = RGBA8888; return true;
+		case 3: layout = RGB888; return true;
+		default: return false;
+	}
+}
+
+/**
+	\brief member function
+
+	@param[in,out] frame a reference to a cv::Mat object containing frame data of an interleaved layout to be modified as function output
+	@param[in] layout a constant krnl::Layout of the frame
+	@param[in] factors a constant reference to a cv::Scalar containing the factor of every channel by its index in the pixel
+
+	Multiplies every channel with its factor by the active gain kernel, rows are passed as one if the frame is continuous. The factors are rounded to
+	cnst::KERNEL_GAIN_SHIFT fractional bits, the products are truncated and saturated at cnst::MAXIMUM_COLOR_CHANNEL_VALUE.
+	A layout without gain kernel leaves the frame unchanged
+
+	@see krnl::fixedGain()
+	@see krnl::gainScalar()
+*/
+void krnl::gain(cv::Mat & frame, krnl::Layout const layout, cv::Scalar const & factors)
+{
+	TRACE_SCOPE("krnl::gain");
+	ALLOCATION_SCOPE("krnl::gain");
+	PERF_SCOPE("krnl::gain", frame.total());
+
+	GainKernel const kernel = kernels(active()).gain[layout];
+
+	if(!kernel || frame.empty()) return;
+
+	unsigned short fixed[cnst::NUMBER_SCALAR_VALUES];
+
+	for(int c = 0; c < cnst::NUMBER_SCALAR_VALUES; c++) fixed[c] = fixedGain(factors[c]);
+
+	int const rows = frame.isContinuous() ? 1 : frame.rows;
+	size_t const pixels = frame.isContinuous() ? frame.total() : (size_t) frame.cols;
+
+	for(int i = 0; i < rows; i++) kernel(frame.ptr(i), pixels, fixed);
+}
+
+/**
+	\brief member function
+
+	@param[out] gray a reference to a cv::Mat object to be filled with the one channel luma image of the frame as function output
+	@param[in] frame a constant reference to a cv::Mat object containing frame data, an NV21 frame has one channel and one and a half times the rows of the image
+	@param[in] layout a constant krnl::Layout of the frame
+
+	Computes the luma by the active luma kernel, equal to cv::COLOR_RGBA2GRAY for RGBA, cv::COLOR_RGB2GRAY for RGB and cv::COLOR_BGR2GRAY for BGR.
+	The luma of NV21 is its first plane, which is copied
+
+	@see krnl::lumaScalar()
+*/
+void krnl::luma(cv::Mat & gray, cv::Mat const & frame, krnl::Layout const layout)
+{
+	TRACE_SCOPE("krnl::luma");
+	ALLOCATION_SCOPE("krnl::luma");
+	PERF_SCOPE("krnl::luma", frame.total());
+
+	LumaKernel const kernel = kernels(active()).luma[layout];
+	int const rows = layout == NV21 ? frame.rows * 2 / 3 : frame.rows;
+
+	gray.create(rows, frame.cols, CV_8UC1);
+
+	if(frame.isContinuous() && gray.isContinuous())
+	{
+		kernel(gray.data, frame.data, (size_t) rows * frame.cols);
+		return;
+	}
+
+	for(int i = 0; i < rows; i++) kernel(gray.ptr(i), frame.ptr(i), (size_t) frame.cols);
+}
@@ -0,0 +1,147 @@
+#ifndef FUNCTIONS_KERNELFUNCTIONS_HPP_
+#define FUNCTIONS_KERNELFUNCTIONS_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <opencv2/core/core.hpp>
+#include "Constants.hpp"
+
+/**
+	\namespace krnl
+
+	the namespace krnl contains the pixel kernels of the hot loops of the pipeline and the dispatch choosing their implementation for the processor the library runs on.
+	Every kernel exists as scalar reference and as NEON, SSE4.1 and AVX2 variant which compute the same bytes as the reference, Benchmark --verify checks this for every
+	variant the host supports. The variants of an architecture are compiled into every build for it and one of them is selected by the features the processor reports
+	at the first call, so the same library runs on devices without NEON and on x86 hosts without AVX2. The kernels are templates over the pixel layout, which is
+	specialized at compile time, so the offsets of the channels are constants in the inner loops
+*/
+namespace krnl
+{
+	/**
+		\enum Isa
+		\brief the instruction sets a kernel is implemented with, ordered by preference within an architecture
+	*/
+	enum Isa
+	{
+		SCALAR,
+		NEON,
+		SSE41,
+		AVX2,
+		ISAS
+	};
+
+	/**
+		\enum Layout
+		\brief the pixel layouts the kernels are specialized for
+	*/
+	enum Layout
+	{
+		RGBA8888,
+		RGB888,
+		BGR,
+		NV21,
+		LAYOUTS
+	};
+
+	/**
+		\struct LayoutTraits
+		\brief compile time description of a pixel layout
+
+		CHANNELS is the number of interleaved bytes of a pixel, RED, GREEN and BLUE are the offsets of the color channels within it.
+		NV21 only describes its luma plane, the interleaved VU plane of half the resolution follows it and carries no channel of a pixel
+	*/
+	template<Layout L> struct LayoutTraits;
+
+	template<> struct LayoutTraits<RGBA8888> { static int const CHANNELS = 4, RED = 0, GREEN = 1, BLUE = 2; };
+	template<> struct LayoutTraits<RGB888> { static int const CHANNELS = 3, RED = 0, GREEN = 1, BLUE = 2; };
+	template<> struct LayoutTraits<BGR> { static int const CHANNELS = 3, RED = 2, GREEN = 1, BLUE = 0; };
+	template<> struct LayoutTraits<NV21> { static int const CHANNELS = 1, RED = -1, GREEN = -1, BLUE = -1; };
+
+	/**
+		a function pointer type of a gain kernel, which multiplies the pixels of a row in place with the cnst::KERNEL_GAIN_SHIFT fixed point factors of their channels
+	*/
+	typedef void (* GainKernel)(unsigned char *, std::size_t const, unsigned short const *);
+
+	/**
+		a function pointer type of a luma kernel, which writes the luma of the pixels of a row
+	*/
+	typedef void (* LumaKernel)(unsigned char *, unsigned char const *, std::size_t const);
+
+	/**
+		\struct Kernels
+		\brief the kernels of one instruction set indexed by Layout, a layout a kernel does not exist for holds a null pointer
+	*/
+	struct Kernels
+	{
+		GainKernel gain[LAYOUTS];
+		LumaKernel luma[LAYOUTS];
+	};
+
+	/**
+		\brief inline template function, the scalar reference of the gain kernel
+
+		@param[in,out] data an unsigned char pointer pointing to the first pixel of the row to be modified as function output
+		@param[in] pixels a constant std::size_t containing the number of pixels of the row
+		@param[in] factors an unsigned short pointer pointing to the factor of every channel of the layout, cnst::KERNEL_GAIN_ONE keeps the channel
+
+		A channel becomes the product of its value and its factor shifted right by cnst::KERNEL_GAIN_SHIFT, saturated at cnst::MAXIMUM_COLOR_CHANNEL_VALUE
+	*/
+	template<Layout L> void inline gainScalar(unsigned char * data, std::size_t const pixels, unsigned short const * factors)
+	{
+		int const channels = LayoutTraits<L>::CHANNELS;
+
+		for(std::size_t i = 0; i < pixels * channels; i += channels)
+		{
+			for(int c = 0; c < channels; c++)
+			{
+				unsigned const value = (data[i + c] * (unsigned) factors[c]) >> cnst::KERNEL_GAIN_SHIFT;
+
+				data[i + c] = (unsigned char) (value < (unsigned) cnst::MAXIMUM_COLOR_CHANNEL_VALUE ? value : cnst::MAXIMUM_COLOR_CHANNEL_VALUE);
+			}
+		}
+	}
+
+	/**
+		\brief inline template function, the scalar reference of the luma kernel
+
+		@param[out] gray an unsigned char pointer pointing to the row of the luma image to be filled as function output
+		@param[in] data an unsigned char pointer pointing to the first pixel of the row
+		@param[in] pixels a constant std::size_t containing the number of pixels of the row
+
+		Weights the channels with cnst::KERNEL_LUMA_RED, cnst::KERNEL_LUMA_GREEN and cnst::KERNEL_LUMA_BLUE and rounds the sum shifted right by cnst::KERNEL_LUMA_SHIFT,
+		which are the coefficients and the rounding of cv::COLOR_RGBA2GRAY
+	*/
+	template<Layout L> void inline lumaScalar(unsigned char * gray, unsigned char const * data, std::size_t const pixels)
+	{
+		typedef LayoutTraits<L> T;
+
+		for(std::size_t i = 0; i < pixels; i++, data += T::CHANNELS)
+			gray[i] = (unsigned char) ((data[T::RED] * cnst::KERNEL_LUMA_RED + data[T::GREEN] * cnst::KERNEL_LUMA_GREEN + data[T::BLUE] * cnst::KERNEL_LUMA_BLUE + (1 << (cnst::KERNEL_LUMA_SHIFT - 1))) >> cnst::KERNEL_LUMA_SHIFT);
+	}
+
+	/**
+		\brief inline template function, the luma of NV21 is its first plane, which is copied
+	*/
+	template<> void inline lumaScalar<NV21>(unsigned char * gray, unsigned char const * data, std::size_t const pixels)
+	{
+		std::memcpy(gray, data, pixels);
+	}
+
+	void scalarKernels(Kernels &);
+	bool neonKernels(Kernels &);
+	bool sse41Kernels(Kernels &);
+	bool avx2Kernels(Kernels &);
+
+	bool supported(Isa const);
+	Kernels const & kernels(Isa const);
+	Isa active();
+	bool select(Isa const);
+	char const * name(Isa const);
+
+	unsigned short fixedGain(double const);
+	bool layout(Layout &, cv::Mat const &);
+	void gain(cv::Mat &, Layout const, cv::Scalar const &);
+	void luma(cv::Mat &, cv::Mat const &, Layout const);
+}
+
+#endif /* FUNCTIONS_KERNELFUNCTIONS_HPP_ */
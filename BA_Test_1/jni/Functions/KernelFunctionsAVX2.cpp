@@ -0,0 +1,166 @@
+#include "Functions/KernelFunctions.hpp"
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#include <immintrin.h>
+
+/**
+	the functions of this file are compiled for AVX2 by their attribute, so no flag of the build raises the instruction set of the rest of the library
+*/
+#define KERNEL_TARGET __attribute__((target("avx2")))
+
+/**
+	\brief static template function
+
+	@param[out] low a pointer to CHANNELS __m256i variables to be filled with the factors of the bytes _mm256_unpacklo_epi8 widens as function output
+	@param[out] high a pointer to CHANNELS __m256i variables to be filled with the factors of the bytes _mm256_unpackhi_epi8 widens as function output
+	@param[in] factors an unsigned short pointer pointing to the factor of every channel
+
+	The unpacking works within each 128 bit half, so the low factors belong to the bytes 0 to 7 and 16 to 23 of a vector and the high factors to the bytes 8 to 15 and 24 to 31
+*/
+template<krnl::Layout L> static KERNEL_TARGET void blockFactors(__m256i * low, __m256i * high, unsigned short const * factors)
+{
+	int const channels = krnl::LayoutTraits<L>::CHANNELS;
+
+	for(int v = 0; v < channels; v++)
+	{
+		unsigned short lanes[2][16];
+
+		for(int j = 0; j < 32; j++) lanes[(j >> 3) & 1][(j >> 4) * 8 + (j & 7)] = factors[(v * 32 + j) % channels];
+
+		low[v] = _mm256_loadu_si256((__m256i const *) lanes[0]);
+		high[v] = _mm256_loadu_si256((__m256i const *) lanes[1]);
+	}
+}
+
+/**
+	\brief static template function, the AVX2 variant of krnl::gainScalar()
+
+	Places every byte in the high half of a 16 bit lane, so the high half of its product with the factor is the product shifted right by cnst::KERNEL_GAIN_SHIFT
+*/
+template<krnl::Layout L> static KERNEL_TARGET void gainAVX2(unsigned char * data, std::size_t const pixels, unsigned short const * factors)
+{
+	int const channels = krnl::LayoutTraits<L>::CHANNELS;
+	std::size_t const bytes = pixels * channels;
+	std::size_t const block = 32 * channels;
+
+	__m256i low[4], high[4];
+	__m256i const zero = _mm256_setzero_si256();
+	__m256i const maximum = _mm256_set1_epi16(cnst::MAXIMUM_COLOR_CHANNEL_VALUE);
+
+	blockFactors<L>(low, high, factors);
+
+	std::size_t i = 0;
+
+	for(; i + block <= bytes; i += block)
+	{
+		for(int v = 0; v < channels; v++)
+		{
+			__m256i * p = (__m256i *) (data + i + 32 * v);
+			__m256i const x = _mm256_loadu_si256(p);
+			__m256i const l = _mm256_min_epu16(_mm256_mulhi_epu16(_mm256_unpacklo_epi8(zero, x), low[v]), maximum);
+			__m256i const h = _mm256_min_epu16(_mm256_mulhi_epu16(_mm256_unpackhi_epi8(zero, x), high[v]), maximum);
+
+			_mm256_storeu_si256(p, _mm256_packus_epi16(l, h));
+		}
+	}
+
+	krnl::gainScalar<L>(data + i, (bytes - i) / channels, factors);
+}
+
+/**
+	\brief static template function
+
+	@param[in] data an unsigned char pointer pointing to the first of 8 pixels, 4 bytes past them have to be readable for layouts of 3 channels
+
+	@return a __m256i containing the 8 pixels as 4 bytes each in the channel order of the layout, the fourth byte is 0 for layouts of 3 channels
+*/
+template<krnl::Layout L> static KERNEL_TARGET __m256i pixels8(unsigned char const * data)
+{
+	if(krnl::LayoutTraits<L>::CHANNELS == 4) return _mm256_loadu_si256((__m256i const *) data);
+
+	__m128i const spread = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+	__m128i const first = _mm_shuffle_epi8(_mm_loadu_si128((__m128i const *) data), spread);
+	__m128i const second = _mm_shuffle_epi8(_mm_loadu_si128((__m128i const *) (data + 12)), spread);
+
+	return _mm256_inserti128_si256(_mm256_castsi128_si256(first), second, 1);
+}
+
+/**
+	\brief static template function, the AVX2 variant of krnl::lumaScalar()
+
+	Works like the SSE4.1 variant on 8 pixels per vector. The packing works within each 128 bit half, so the 32 luma values of a step are stored
+	in the order 0 to 3, 8 to 11, 16 to 19, 24 to 27, 4 to 7 and so on and put in place by one permutation of 32 bit lanes. Like there, the vector loop of layouts of 3 channels stops 2 pixels earlier
+*/
+template<krnl::Layout L> static KERNEL_TARGET void lumaAVX2(unsigned char * gray, unsigned char const * data, std::size_t const pixels)
+{
+	typedef krnl::LayoutTraits<L> T;
+
+	short coefficients[4] = { 0, 0, 0, 0 };
+
+	coefficients[T::RED] = cnst::KERNEL_LUMA_RED;
+	coefficients[T::GREEN] = cnst::KERNEL_LUMA_GREEN;
+	coefficients[T::BLUE] = cnst::KERNEL_LUMA_BLUE;
+
+	__m256i const weights = _mm256_setr_epi16(coefficients[0], coefficients[1], coefficients[2], coefficients[3], coefficients[0], coefficients[1], coefficients[2], coefficients[3],
+		coefficients[0], coefficients[1], coefficients[2], coefficients[3], coefficients[0], coefficients[1], coefficients[2], coefficients[3]);
+	__m256i const rounding = _mm256_set1_epi32(1 << (cnst::KERNEL_LUMA_SHIFT - 1));
+	__m256i const order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+	__m256i const zero = _mm256_setzero_si256();
+
+	std::size_t i = 0;
+
+	for(; i + 32 + (T::CHANNELS == 3 ? 2 : 0) <= pixels; i += 32)
+	{
+		__m256i sums[4];
+
+		for(int q = 0; q < 4; q++)
+		{
+			__m256i const x = pixels8<L>(data + (i + 8 * q) * T::CHANNELS);
+			__m256i const a = _mm256_madd_epi16(_mm256_unpacklo_epi8(x, zero), weights);
+			__m256i const b = _mm256_madd_epi16(_mm256_unpackhi_epi8(x, zero), weights);
+
+			sums[q] = _mm256_srli_epi32(_mm256_add_epi32(_mm256_hadd_epi32(a, b), rounding), cnst::KERNEL_LUMA_SHIFT);
+		}
+
+		__m256i const bytes = _mm256_packus_epi16(_mm256_packs_epi32(sums[0], sums[1]), _mm256_packs_epi32(sums[2], sums[3]));
+
+		_mm256_storeu_si256((__m256i *) (gray + i), _mm256_permutevar8x32_epi32(bytes, order));
+	}
+
+	krnl::lumaScalar<L>(gray + i, data + i * T::CHANNELS, pixels - i);
+}
+
+/**
+	\brief member function
+
+	@param[out] kernels a reference to the krnl::Kernels to be filled with the AVX2 variants as function output, the luma plane of NV21 is copied by the scalar kernel
+
+	@return a bool containing true, since the library is compiled for x86
+*/
+bool krnl::avx2Kernels(krnl::Kernels & kernels)
+{
+	kernels.gain[RGBA8888] = gainAVX2<RGBA8888>;
+	kernels.gain[RGB888] = gainAVX2<RGB888>;
+	kernels.gain[BGR] = gainAVX2<BGR>;
+
+	kernels.luma[RGBA8888] = lumaAVX2<RGBA8888>;
+	kernels.luma[RGB888] = lumaAVX2<RGB888>;
+	kernels.luma[BGR] = lumaAVX2<BGR>;
+
+	return true;
+}
+
+#else
+
+/**
+	\brief member function
+
+	@return a bool containing false, since the library is not compiled for x86
+*/
+bool krnl::avx2Kernels(krnl::Kernels &)
+{
+	return false;
+}
+
+#endif
@@ -0,0 +1,155 @@
+#include "Functions/KernelFunctions.hpp"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+#include <arm_neon.h>
+
+/**
+	\struct Interleaved
+	\brief the NEON loads and stores splitting 16 pixels of CHANNELS interleaved bytes into one vector per channel and joining them again
+*/
+template<int CHANNELS> struct Interleaved;
+
+template<> struct Interleaved<3>
+{
+	typedef uint8x16x3_t Vectors;
+
+	static Vectors inline load(unsigned char const * data) { return vld3q_u8(data); }
+	static void inline store(unsigned char * data, Vectors const & v) { vst3q_u8(data, v); }
+};
+
+template<> struct Interleaved<4>
+{
+	typedef uint8x16x4_t Vectors;
+
+	static Vectors inline load(unsigned char const * data) { return vld4q_u8(data); }
+	static void inline store(unsigned char * data, Vectors const & v) { vst4q_u8(data, v); }
+};
+
+/**
+	\brief static inline function
+
+	@param[in] x a constant uint8x16_t containing the values of a channel of 16 pixels
+	@param[in] factor a constant unsigned short containing the factor of the channel
+
+	@return a uint8x16_t containing the products shifted right by cnst::KERNEL_GAIN_SHIFT, which the narrowing shifts saturate at cnst::MAXIMUM_COLOR_CHANNEL_VALUE
+*/
+static inline uint8x16_t scale(uint8x16_t const x, unsigned short const factor)
+{
+	uint16x8_t const low = vmovl_u8(vget_low_u8(x));
+	uint16x8_t const high = vmovl_u8(vget_high_u8(x));
+
+	uint16x8_t const l = vcombine_u16(vqshrn_n_u32(vmull_n_u16(vget_low_u16(low), factor), cnst::KERNEL_GAIN_SHIFT), vqshrn_n_u32(vmull_n_u16(vget_high_u16(low), factor), cnst::KERNEL_GAIN_SHIFT));
+	uint16x8_t const h = vcombine_u16(vqshrn_n_u32(vmull_n_u16(vget_low_u16(high), factor), cnst::KERNEL_GAIN_SHIFT), vqshrn_n_u32(vmull_n_u16(vget_high_u16(high), factor), cnst::KERNEL_GAIN_SHIFT));
+
+	return vcombine_u8(vqmovn_u16(l), vqmovn_u16(h));
+}
+
+/**
+	\brief static template function, the NEON variant of krnl::gainScalar()
+
+	Splits 16 pixels into one vector per channel, so every channel is multiplied with a single factor
+*/
+template<krnl::Layout L> static void gainNEON(unsigned char * data, std::size_t const pixels, unsigned short const * factors)
+{
+	typedef Interleaved<krnl::LayoutTraits<L>::CHANNELS> I;
+
+	int const channels = krnl::LayoutTraits<L>::CHANNELS;
+
+	std::size_t i = 0;
+
+	for(; i + 16 <= pixels; i += 16)
+	{
+		typename I::Vectors v = I::load(data + i * channels);
+
+		for(int c = 0; c < channels; c++) v.val[c] = scale(v.val[c], factors[c]);
+
+		I::store(data + i * channels, v);
+	}
+
+	krnl::gainScalar<L>(data + i * channels, pixels - i, factors);
+}
+
+/**
+	\brief static inline function
+
+	@param[in] r a constant uint16x4_t containing the red channel of 4 pixels
+	@param[in] g a constant uint16x4_t containing the green channel of 4 pixels
+	@param[in] b a constant uint16x4_t containing the blue channel of 4 pixels
+
+	@return a uint16x4_t containing the weighted sums rounded and shifted right by cnst::KERNEL_LUMA_SHIFT
+*/
+static inline uint16x4_t weigh(uint16x4_t const r, uint16x4_t const g, uint16x4_t const b)
+{
+	uint32x4_t sum = vmull_n_u16(r, cnst::KERNEL_LUMA_RED);
+
+	sum = vmlal_n_u16(sum, g, cnst::KERNEL_LUMA_GREEN);
+	sum = vmlal_n_u16(sum, b, cnst::KERNEL_LUMA_BLUE);
+
+	return vrshrn_n_u32(sum, cnst::KERNEL_LUMA_SHIFT);
+}
+
+/**
+	\brief static template function, the NEON variant of krnl::lumaScalar()
+
+	Splits 16 pixels into one vector per channel, the rounding narrowing shift adds the half of the divisor like the scalar reference
+*/
+template<krnl::Layout L> static void lumaNEON(unsigned char * gray, unsigned char const * data, std::size_t const pixels)
+{
+	typedef krnl::LayoutTraits<L> T;
+	typedef Interleaved<T::CHANNELS> I;
+
+	std::size_t i = 0;
+
+	for(; i + 16 <= pixels; i += 16)
+	{
+		typename I::Vectors const v = I::load(data + i * T::CHANNELS);
+
+		uint16x8_t const r[2] = { vmovl_u8(vget_low_u8(v.val[T::RED])), vmovl_u8(vget_high_u8(v.val[T::RED])) };
+		uint16x8_t const g[2] = { vmovl_u8(vget_low_u8(v.val[T::GREEN])), vmovl_u8(vget_high_u8(v.val[T::GREEN])) };
+		uint16x8_t const b[2] = { vmovl_u8(vget_low_u8(v.val[T::BLUE])), vmovl_u8(vget_high_u8(v.val[T::BLUE])) };
+
+		uint8x8_t y[2];
+
+		for(int h = 0; h < 2; h++)
+			y[h] = vmovn_u16(vcombine_u16(weigh(vget_low_u16(r[h]), vget_low_u16(g[h]), vget_low_u16(b[h])), weigh(vget_high_u16(r[h]), vget_high_u16(g[h]), vget_high_u16(b[h]))));
+
+		vst1q_u8(gray + i, vcombine_u8(y[0], y[1]));
+	}
+
+	krnl::lumaScalar<L>(gray + i, data + i * T::CHANNELS, pixels - i);
+}
+
+/**
+	\brief member function
+
+	@param[out] kernels a reference to the krnl::Kernels to be filled with the NEON variants as function output, the luma plane of NV21 is copied by the scalar kernel
+
+	@return a bool containing true, since the library is compiled with NEON
+*/
+bool krnl::neonKernels(krnl::Kernels & kernels)
+{
+	kernels.gain[RGBA8888] = gainNEON<RGBA8888>;
+	kernels.gain[RGB888] = gainNEON<RGB888>;
+	kernels.gain[BGR] = gainNEON<BGR>;
+
+	kernels.luma[RGBA8888] = lumaNEON<RGBA8888>;
+	kernels.luma[RGB888] = lumaNEON<RGB888>;
+	kernels.luma[BGR] = lumaNEON<BGR>;
+
+	return true;
+}
+
+#else
+
+/**
+	\brief member function
+
+	@return a bool containing false, since the library is not compiled with NEON, which ndk-build enables for this file by its .neon suffix in Android.mk
+*/
+bool krnl::neonKernels(krnl::Kernels &)
+{
+	return false;
+}
+
+#endif
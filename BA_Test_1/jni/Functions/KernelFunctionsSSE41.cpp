@@ -0,0 +1,163 @@
+#include "Functions/KernelFunctions.hpp"
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#include <immintrin.h>
+
+/**
+	the functions of this file are compiled for SSE4.1 by their attribute, so no flag of the build raises the instruction set of the rest of the library
+*/
+#define KERNEL_TARGET __attribute__((target("sse4.1")))
+
+/**
+	\brief static template function
+
+	@param[out] low a pointer to CHANNELS __m128i variables to be filled with the factors of the low bytes of the vectors of a block as function output
+	@param[out] high a pointer to CHANNELS __m128i variables to be filled with the factors of the high bytes of the vectors of a block as function output
+	@param[in] factors an unsigned short pointer pointing to the factor of every channel
+
+	A block of CHANNELS vectors starts with the first channel of a pixel again, so the factors repeat with every block
+*/
+template<krnl::Layout L> static KERNEL_TARGET void blockFactors(__m128i * low, __m128i * high, unsigned short const * factors)
+{
+	int const channels = krnl::LayoutTraits<L>::CHANNELS;
+
+	for(int v = 0; v < channels; v++)
+	{
+		unsigned short lane[16];
+
+		for(int j = 0; j < 16; j++) lane[j] = factors[(v * 16 + j) % channels];
+
+		low[v] = _mm_loadu_si128((__m128i const *) lane);
+		high[v] = _mm_loadu_si128((__m128i const *) (lane + 8));
+	}
+}
+
+/**
+	\brief static template function, the SSE4.1 variant of krnl::gainScalar()
+
+	Places every byte in the high half of a 16 bit lane, so the high half of its product with the factor is the product shifted right by cnst::KERNEL_GAIN_SHIFT
+*/
+template<krnl::Layout L> static KERNEL_TARGET void gainSSE41(unsigned char * data, std::size_t const pixels, unsigned short const * factors)
+{
+	int const channels = krnl::LayoutTraits<L>::CHANNELS;
+	std::size_t const bytes = pixels * channels;
+	std::size_t const block = 16 * channels;
+
+	__m128i low[4], high[4];
+	__m128i const zero = _mm_setzero_si128();
+	__m128i const maximum = _mm_set1_epi16(cnst::MAXIMUM_COLOR_CHANNEL_VALUE);
+
+	blockFactors<L>(low, high, factors);
+
+	std::size_t i = 0;
+
+	for(; i + block <= bytes; i += block)
+	{
+		for(int v = 0; v < channels; v++)
+		{
+			__m128i * p = (__m128i *) (data + i + 16 * v);
+			__m128i const x = _mm_loadu_si128(p);
+			__m128i const l = _mm_min_epu16(_mm_mulhi_epu16(_mm_unpacklo_epi8(zero, x), low[v]), maximum);
+			__m128i const h = _mm_min_epu16(_mm_mulhi_epu16(_mm_unpackhi_epi8(zero, x), high[v]), maximum);
+
+			_mm_storeu_si128(p, _mm_packus_epi16(l, h));
+		}
+	}
+
+	krnl::gainScalar<L>(data + i, (bytes - i) / channels, factors);
+}
+
+/**
+	\brief static template function
+
+	@param[in] data an unsigned char pointer pointing to the first of 4 pixels, 16 bytes have to be readable
+
+	@return a __m128i containing the 4 pixels as 4 bytes each in the channel order of the layout, the fourth byte is 0 for layouts of 3 channels
+*/
+template<krnl::Layout L> static KERNEL_TARGET __m128i pixels4(unsigned char const * data)
+{
+	__m128i const x = _mm_loadu_si128((__m128i const *) data);
+
+	if(krnl::LayoutTraits<L>::CHANNELS == 4) return x;
+
+	return _mm_shuffle_epi8(x, _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1));
+}
+
+/**
+	\brief static template function, the SSE4.1 variant of krnl::lumaScalar()
+
+	Multiplies the channels of 2 pixels with their coefficients and adds pairs of them with one _mm_madd_epi16, _mm_hadd_epi32 adds the pairs of a pixel.
+	A load of 4 pixels of 3 channels reads 4 bytes past them, so the vector loop of these layouts stops 2 pixels earlier
+*/
+template<krnl::Layout L> static KERNEL_TARGET void lumaSSE41(unsigned char * gray, unsigned char const * data, std::size_t const pixels)
+{
+	typedef krnl::LayoutTraits<L> T;
+
+	short coefficients[4] = { 0, 0, 0, 0 };
+
+	coefficients[T::RED] = cnst::KERNEL_LUMA_RED;
+	coefficients[T::GREEN] = cnst::KERNEL_LUMA_GREEN;
+	coefficients[T::BLUE] = cnst::KERNEL_LUMA_BLUE;
+
+	__m128i const weights = _mm_setr_epi16(coefficients[0], coefficients[1], coefficients[2], coefficients[3], coefficients[0], coefficients[1], coefficients[2], coefficients[3]);
+	__m128i const rounding = _mm_set1_epi32(1 << (cnst::KERNEL_LUMA_SHIFT - 1));
+	__m128i const zero = _mm_setzero_si128();
+
+	std::size_t i = 0;
+
+	for(; i + 16 + (T::CHANNELS == 3 ? 2 : 0) <= pixels; i += 16)
+	{
+		__m128i sums[4];
+
+		for(int q = 0; q < 4; q++)
+		{
+			__m128i const x = pixels4<L>(data + (i + 4 * q) * T::CHANNELS);
+			__m128i const a = _mm_madd_epi16(_mm_unpacklo_epi8(x, zero), weights);
+			__m128i const b = _mm_madd_epi16(_mm_unpackhi_epi8(x, zero), weights);
+
+			sums[q] = _mm_srli_epi32(_mm_add_epi32(_mm_hadd_epi32(a, b), rounding), cnst::KERNEL_LUMA_SHIFT);
+		}
+
+		__m128i const words = _mm_packs_epi32(sums[0], sums[1]);
+		__m128i const words2 = _mm_packs_epi32(sums[2], sums[3]);
+
+		_mm_storeu_si128((__m128i *) (gray + i), _mm_packus_epi16(words, words2));
+	}
+
+	krnl::lumaScalar<L>(gray + i, data + i * T::CHANNELS, pixels - i);
+}
+
+/**
+	\brief member function
+
+	@param[out] kernels a reference to the krnl::Kernels to be filled with the SSE4.1 variants as function output, the luma plane of NV21 is copied by the scalar kernel
+
+	@return a bool containing true, since the library is compiled for x86
+*/
+bool krnl::sse41Kernels(krnl::Kernels & kernels)
+{
+	kernels.gain[RGBA8888] = gainSSE41<RGBA8888>;
+	kernels.gain[RGB888] = gainSSE41<RGB888>;
+	kernels.gain[BGR] = gainSSE41<BGR>;
+
+	kernels.luma[RGBA8888] = lumaSSE41<RGBA8888>;
+	kernels.luma[RGB888] = lumaSSE41<RGB888>;
+	kernels.luma[BGR] = lumaSSE41<BGR>;
+
+	return true;
+}
+
+#else
+
+/**
+	\brief member function
+
+	@return a bool containing false, since the library is not compiled for x86
+*/
+bool krnl::sse41Kernels(krnl::Kernels &)
+{
+	return false;
+}
+
+#endif
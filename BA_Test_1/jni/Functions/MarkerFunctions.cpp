@@ -0,0 +1,234 @@
+#include <bitset>
+#include "Functions/MarkerFunctions.hpp"
+#include "Functions/KernelFunctions.hpp"
+#include "AuxiliaryClasses/Trace.hpp"
+#include "AuxiliaryClasses/PerfCounters.hpp"
+#include "AuxiliaryClasses/AllocationTracker.hpp"
+
+using namespace std;
+
+/**
+	\brief member function
+
+	@param[out] gray a reference to a cv::Mat object to be filled with the downsampled luma of the frame as function output
+	@param[in] frame a constant reference to a cv::Mat object containing RGBA frame data
+	@param[in] pyramidLevel a constant int containing the number of times the luma is halved, 0 to keep the resolution of the frame
+
+	Converts the frame to one channel before it is halved, so the pyramid costs a quarter of the one of the color image
+
+	@see krnl::luma()
+*/
+void mark::lumaImage(cv::Mat & gray, cv::Mat const & frame, int const pyramidLevel)
+{
+	TRACE_SCOPE("mark::lumaImage");
+	ALLOCATION_SCOPE("mark::lumaImage");
+	PERF_SCOPE("mark::lumaImage", frame.total());
+
+	krnl::luma(gray, frame, krnl::RGBA8888);
+
+	for(int i = 0; i < pyramidLevel; i++) cv::pyrDown(gray, gray);
+}
+
+/**
+	\brief member function
+
+	@param[out] quads a reference to a std::vector of std::vectors containing cv::Point2f objects to be filled with the corners of each candidate as function output
+	@param[in] gray a constant reference to a cv::Mat object containing the luma image
+
+	Thresholds the luma against the mean of its cnst::MARKER_THRESHOLD_BLOCK neighbourhood, so dark borders are found under uneven lighting, and keeps every
+	convex contour of at least cnst::MARKER_MIN_PERIMETER pixels which is approximated by four corners. The corners run clockwise in the image, so the sampling grid is never mirrored
+
+	@see cnst::MARKER_THRESHOLD_OFFSET
+	@see cnst::MARKER_APPROXIMATION
+*/
+void mark::candidates(std::vector<std::vector<cv::Point2f>> & quads, cv::Mat const & gray)
+{
+	TRACE_SCOPE("mark::candidates");
+	ALLOCATION_SCOPE("mark::candidates");
+	PERF_SCOPE("mark::candidates", gray.total());
+
+	cv::Mat binary;
+	vector<vector<cv::Point>> contours;
+
+	ALLOCATION_TRACK(binary);
+
+	cv::adaptiveThreshold(gray, binary, cnst::MAXIMUM_COLOR_CHANNEL_VALUE, cv::ADAPTIVE_THRESH_MEAN_C, cv::THRESH_BINARY_INV, cnst::MARKER_THRESHOLD_BLOCK, cnst::MARKER_THRESHOLD_OFFSET);
+	cv::findContours(binary, contours, cv::RETR_LIST, cv::CHAIN_APPROX_NONE);
+
+	for(vector<vector<cv::Point>>::iterator it = contours.begin(); it != contours.end(); ++it)
+	{
+		if((int) it->size() < cnst::MARKER_MIN_PERIMETER) continue;
+
+		vector<cv::Point> approx;
+
+		cv::approxPolyDP(*it, approx, cnst::MARKER_APPROXIMATION * it->size(), true);
+
+		if(approx.size() != cnst::NUMBER_CORNERS || !cv::isContourConvex(approx)) continue;
+
+		cv::Point const a = approx[1] - approx[0], b = approx[2] - approx[0];
+
+		if((double) a.x * b.y - (double) a.y * b.x < 0.0) std::swap(approx[1], approx[3]);
+
+		quads.push_back(vector<cv::Point2f>(approx.begin(), approx.end()));
+	}
+
+	binary.release();
+}
+
+/**
+	\brief member function
+
+	@param[out] id a reference to an int to be filled with the id of the decoded reference marker as function output
+	@param[in] gray a constant reference to a cv::Mat object containing the luma image
+	@param[in] quad a constant reference to a std::vector containing the corners of a candidate running clockwise
+
+	Samples the candidate into a square of cnst::MARKER_CELL_PIXELS per cell, binarizes it with Otsu's threshold and reads each cell from its center.
+	The border has to be black, the bits may differ from a code of cnst::MARKER_CODES in at most cnst::MARKER_MAX_CORRECTION cells in one of the four rotations
+
+	@return true if the candidate is a reference marker, false otherwise
+*/
+bool mark::decode(int & id, cv::Mat const & gray, std::vector<cv::Point2f> const & quad)
+{
+	int const cells = cnst::MARKER_BITS + 2;
+	float const side = (float) (cells * cnst::MARKER_CELL_PIXELS);
+
+	cv::Point2f const square[cnst::NUMBER_CORNERS] = { cv::Point2f(0, 0), cv::Point2f(side, 0), cv::Point2f(side, side), cv::Point2f(0, side) };
+	cv::Mat warped;
+
+	cv::warpPerspective(gray, warped, cv::getPerspectiveTransform(&quad[0], square), cv::Size((int) side, (int) side), cv::INTER_LINEAR);
+	cv::threshold(warped, warped, 0, cnst::MAXIMUM_COLOR_CHANNEL_VALUE, cv::THRESH_BINARY | cv::THRESH_OTSU);
+
+	int bits[cnst::MARKER_BITS][cnst::MARKER_BITS];
+	int const margin = cnst::MARKER_CELL_PIXELS / 4;
+
+	for(int r = 0; r < cells; r++)
+	{
+		for(int k = 0; k < cells; k++)
+		{
+			cv::Mat const cell = warped(cv::Rect(k * cnst::MARKER_CELL_PIXELS + margin, r * cnst::MARKER_CELL_PIXELS + margin, cnst::MARKER_CELL_PIXELS - 2 * margin, cnst::MARKER_CELL_PIXELS - 2 * margin));
+			bool const white = 2 * cv::countNonZero(cell) > (int) cell.total();
+
+			if(r == 0 || k == 0 || r == cells - 1 || k == cells - 1)
+			{
+				if(white) return false;
+			}
+			else bits[r - 1][k - 1] = white ? 1 : 0;
+		}
+	}
+
+	for(int rotation = 0; rotation < cnst::NUMBER_CORNERS; rotation++)
+	{
+		int code = 0;
+
+		for(int r = 0; r < cnst::MARKER_BITS; r++)
+			for(int k = 0; k < cnst::MARKER_BITS; k++) code = (code << 1) | bits[r][k];
+
+		for(int m = 0; m < cnst::NUMBER_CORNERS; m++)
+		{
+			if(std::bitset<cnst::MARKER_BITS * cnst::MARKER_BITS>(code ^ cnst::MARKER_CODES[m]).count() <= (size_t) cnst::MARKER_MAX_CORRECTION)
+			{
+				id = m;
+
+				return true;
+			}
+		}
+
+		int rotated[cnst::MARKER_BITS][cnst::MARKER_BITS];
+
+		for(int r = 0; r < cnst::MARKER_BITS; r++)
+			for(int k = 0; k < cnst::MARKER_BITS; k++) rotated[r][k] = bits[cnst::MARKER_BITS - 1 - k][r];
+
+		std::copy(&rotated[0][0], &rotated[0][0] + cnst::MARKER_BITS * cnst::MARKER_BITS, &bits[0][0]);
+	}
+
+	return false;
+}
+
+/**
+	\brief member function
+
+	@param[out] points a reference to a std::vector containing cv::Point objects to be filled with the reference marker centers as function output
+	@param[in] gray a constant reference to a cv::Mat object containing the luma image
+	@param[in] pyramidLevel a constant int containing the number of times the frame was halved for the luma image
+	@param[in] offset a constant reference to a cv::Point object containing the position of the luma image origin in the frame
+
+	Decodes all candidates and keeps the largest one of each id, which is the outer edge of its border. The center of a marker is the intersection of its diagonals,
+	which stays exact under perspective. The points are in the order of proc::gnrc::centerPointsVector() and in the coordinates of the frame
+
+	@see mark::candidates()
+	@see mark::decode()
+
+	@return true if all reference markers were found, false if points is left untouched
+*/
+bool mark::referencePoints(std::vector<cv::Point> & points, cv::Mat const & gray, int const pyramidLevel, cv::Point const & offset)
+{
+	TRACE_SCOPE("mark::referencePoints");
+	ALLOCATION_SCOPE("mark::referencePoints");
+	PERF_SCOPE("mark::referencePoints", gray.total());
+
+	vector<vector<cv::Point2f>> quads;
+	double areas[cnst::NUMBER_CORNERS] = { 0.0, 0.0, 0.0, 0.0 };
+	cv::Point2f centers[cnst::NUMBER_CORNERS];
+
+	mark::candidates(quads, gray);
+
+	for(vector<vector<cv::Point2f>>::iterator it = quads.begin(); it != quads.end(); ++it)
+	{
+		int id;
+		double const area = cv::contourArea(*it);
+
+		if(!mark::decode(id, gray, *it) || area <= areas[id]) continue;
+
+		vector<cv::Point2f> const & q = *it;
+		cv::Point2f const d1 = q[2] - q[0], d2 = q[3] - q[1], x = q[1] - q[0];
+
+		double const t = (x.x * d2.y - x.y * d2.x) / (d1.x * d2.y - d1.y * d2.x);
+
+		areas[id] = area;
+		centers[id] = q[0] + d1 * (float) t;
+	}
+
+	for(int i = 0; i < cnst::NUMBER_CORNERS; i++) if(areas[i] == 0.0) return false;
+
+	double const scale = 1 << pyramidLevel;
+
+	for(int i = 0; i < cnst::NUMBER_CORNERS; i++)
+		points.push_back(cv::Point(cvRound((centers[i].x + 0.5) * scale - 0.5) + offset.x, cvRound((centers[i].y + 0.5) * scale - 0.5) + offset.y));
+
+	return true;
+}
+
+/**
+	\brief member function
+
+	@param[out] image a reference to a cv::Mat object the marker is drawn into as function output
+	@param[in] id a constant int containing the id of the reference marker
+	@param[in] area a constant reference to a cv::Rect object containing the square the marker fills
+
+	Draws the reference marker, e.g. for printing it or for synthetic frames. The quiet zone around it is left to the caller
+*/
+void mark::drawMarker(cv::Mat & image, int const id, cv::Rect const & area)
+{
+	int const cells = cnst::MARKER_BITS + 2;
+
+	for(int r = 0; r < cells; r++)
+	{
+		for(int k = 0; k < cells; k++)
+		{
+			bool white = false;
+
+			if(r > 0 && k > 0 && r < cells - 1 && k < cells - 1)
+			{
+				int const bit = (r - 1) * cnst::MARKER_BITS + (k - 1);
+
+				white = (cnst::MARKER_CODES[id] >> (cnst::MARKER_BITS * cnst::MARKER_BITS - 1 - bit)) & 1;
+			}
+
+			cv::Point const from(area.x + (k * area.width) / cells, area.y + (r * area.height) / cells);
+			cv::Point const to(area.x + ((k + 1) * area.width) / cells - 1, area.y + ((r + 1) * area.height) / cells - 1);
+			int const value = white ? cnst::MAXIMUM_COLOR_CHANNEL_VALUE : cnst::MINIMUM_COLOR_CHANNEL_VALUE;
+
+			cv::rectangle(image, from, to, cv::Scalar(value, value, value, cnst::MAXIMUM_COLOR_CHANNEL_VALUE), -1);
+		}
+	}
+}
@@ -0,0 +1,28 @@
+#ifndef FUNCTIONS_MARKERFUNCTIONS_HPP_
+#define FUNCTIONS_MARKERFUNCTIONS_HPP_
+
+#include <vector>
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+#include "Constants.hpp"
+
+/**
+	\namespace mark
+
+	the namespace mark contains the function collection detecting square binary fiducial markers as alternative to the colored reference stickers.
+	A marker consists of cnst::MARKER_BITS x cnst::MARKER_BITS white (1) or black (0) cells surrounded by a black border of one cell and needs a light quiet zone around it.
+	The reference marker with id i carries the bits of cnst::MARKER_CODES[i], read row by row starting with the most significant bit in any of its four rotations,
+	and replaces the reference sticker i in the order of proc::gnrc::centerPointsVector().
+	Any two rotations of the codes, including two rotations of the same code, differ in at least 8 of the 16 bits and every row and column mixes both colors,
+	so the cnst::MARKER_MAX_CORRECTION corrected bits leave a wide margin against reading one marker or rotation as another
+*/
+namespace mark
+{
+	void lumaImage(cv::Mat &, cv::Mat const &, int const);
+	void candidates(std::vector<std::vector<cv::Point2f>> &, cv::Mat const &);
+	bool decode(int &, cv::Mat const &, std::vector<cv::Point2f> const &);
+	bool referencePoints(std::vector<cv::Point> &, cv::Mat const &, int const, cv::Point const &);
+	void drawMarker(cv::Mat &, int const, cv::Rect const &);
+}
+
+#endif /* FUNCTIONS_MARKERFUNCTIONS_HPP_ */
@@ -1,31 +1,51 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
 #include "Constants.hpp"
 #include "Functions/ProcessingFunctions.hpp"
 #include "Functions/FileReadingFunctions.hpp"
+#include "Functions/MarkerFunctions.hpp"
+#include "Functions/CodeFunctions.hpp"
+#include "Functions/KernelFunctions.hpp"
+#include "AuxiliaryClasses/Trace.hpp"
+#include "AuxiliaryClasses/PerfCounters.hpp"
+#include "AuxiliaryClasses/AllocationTracker.hpp"
 
 using namespace std;
 
 /**
 	\brief gnrc member function
 
+	@param[in] session a reference to the aux::Session object containing the color correction factors
 	@param[out] frame a reference to a cv::Mat object containing the data of a frame to be modified as function output
 
 	Multiplies the red and blue color channels of each pixel with the respective correction factors in order to perform white balancing.
+	The gain kernel of the instruction set chosen by krnl::active() saturates the products at cnst::MAXIMUM_COLOR_CHANNEL_VALUE instead of letting them wrap around,
+	a frame without a layout of color channels is left unchanged
 
 	@see cnst::NUMBER_BLUE_CHANNEL
 	@see cnst::NUMBER_RED_CHANNEL
-	@see proc::gnrc::blueFactor()
-	@see proc::gnrc::redFactor()
+	@see aux::Session::blueFactor()
+	@see aux::Session::redFactor()
+	@see krnl::gain()
 */
-void proc::gnrc::correctColors(cv::Mat & frame)
+void proc::gnrc::correctColors(aux::Session & session, cv::Mat & frame)
 {
-	for(int i = 0; i < frame.rows; i++)
-	{
-		for(int k = 0; k < frame.cols; k++)
-		{
-			frame.data[frame.step * i + frame.channels() * k + cnst::NUMBER_BLUE_CHANNEL] *= proc::gnrc::blueFactor;
-			frame.data[frame.step * i + frame.channels() * k + cnst::NUMBER_RED_CHANNEL] *= proc::gnrc::redFactor;
-		}
-	}
+	TRACE_SCOPE("proc::gnrc::correctColors");
+	ALLOCATION_SCOPE("proc::gnrc::correctColors");
+	PERF_SCOPE("proc::gnrc::correctColors", frame.total());
+
+	krnl::Layout layout;
+
+	if(!krnl::layout(layout, frame)) return;
+
+	cv::Scalar factors = cv::Scalar::all(1.0);
+
+	factors[cnst::NUMBER_BLUE_CHANNEL] = session.blueFactor();
+	factors[cnst::NUMBER_RED_CHANNEL] = session.redFactor();
+
+	krnl::gain(frame, layout, factors);
 }
 
 /**
@@ -34,23 +54,28 @@ void proc::gnrc::correctColors(cv::Mat & frame)
 	@param[out] contours a reference to a std::vector of std::vectors containing cv::Point objects to be filled with the detected contours as first function output
 	@param[out] maxarea a refernce to a double variable containing the value of the highest detected area as second function output
 
-	@param[in] frame a constant reference to a cv::Mat object containing frame data
+	@param[in] frame a constant reference to a cv::Mat object containing the HSV detection image of proc::gnrc::detectionImage()
 	@param[in] lb a constant reference to a cv::Scalar object containing the lower bounds of a color values interval
 	@param[in] ub a constant reference to a cv::Scalar object containing the upper bounds of a color values interval
+	@param[in] pyramidLevel a constant int containing the number of times the frame was halved for the detection image
 
-	Calcualtes the detected contours based on their maximal area and stores them into their respective variables
+	Calcualtes the detected contours based on their maximal area and stores them into their respective variables in the coordinates of the frame
 
 	@see proc::gnrc::contours()
 	@see proc::gnrc::maxArea()
 	@see proc::gnrc::saveContours()
 */
-void proc::gnrc::contourVector(std::vector<std::vector<cv::Point>> & contours, double & maxarea, cv::Mat const & frame, cv::Scalar const & lb, cv::Scalar const & ub)
+void proc::gnrc::contourVector(std::vector<std::vector<cv::Point>> & contours, double & maxarea, cv::Mat const & frame, cv::Scalar const & lb, cv::Scalar const & ub, int const pyramidLevel)
 {
+	TRACE_SCOPE("proc::gnrc::contourVector");
+	ALLOCATION_SCOPE("proc::gnrc::contourVector");
+	PERF_SCOPE("proc::gnrc::contourVector", frame.total());
+
 	std::vector<std::vector<cv::Point>> tContours;
 
 	proc::gnrc::contours(tContours, frame, lb, ub);
 	proc::gnrc::maxArea(maxarea, tContours);
-	proc::gnrc::saveContours(contours, tContours, maxarea);
+	proc::gnrc::saveContours(contours, tContours, maxarea, pyramidLevel);
 }
 
 /**
@@ -65,6 +90,9 @@ void proc::gnrc::contourVector(std::vector<std::vector<cv::Point>> & contours, d
 */
 void proc::gnrc::rectangleVector(std::vector<cv::Rect> & rects, std::vector<std::vector<cv::Point>> & contours)
 {
+	TRACE_SCOPE("proc::gnrc::rectangleVector");
+	ALLOCATION_SCOPE("proc::gnrc::rectangleVector");
+
 	for(std::vector<std::vector<cv::Point>>::iterator it = contours.begin(); it != contours.end(); ++it)
 	{
 		cv::Rect rect;
@@ -83,14 +111,30 @@ void proc::gnrc::rectangleVector(std::vector<cv::Rect> & rects, std::vector<std:
 	@param[out] points a reference to a std::vector containing cv::Point objects to be filled with data as function output
 	@param[in] rects a reference to a std::vector containing cv::Rects objects representing the detected areas of a pair of reference stickers
 	@param[in] refRects a reference to a std::vector containing cv::Rects objects representing the detected areas of another pair of reference stickers
+	@param[in] aspect a constant double containing the configured width of the reference stickers divided by their height
 
-	Approximates the center point of each reference sticker based on the received rectangle pairs
+	Approximates the center point of each reference sticker based on the received rectangle pairs. Exactly one pair of each color is taken as it is,
+	so the actions judge it like before, further candidates are resolved by proc::gnrc::pairReferences()
 
 	@see cnst::CORRECT_NUMBER_DETECTED_RECTANGLES_BOT_TOP
+	@see proc::gnrc::pairReferences()
 */
-void proc::gnrc::centerPointsVector(std::vector<cv::Point> & points, std::vector<cv::Rect> & rects, std::vector<cv::Rect> & refRects)
+void proc::gnrc::centerPointsVector(std::vector<cv::Point> & points, std::vector<cv::Rect> & rects, std::vector<cv::Rect> & refRects, double const aspect)
 {
-	if(rects.size() == cnst::CORRECT_NUMBER_DETECTED_RECTANGLES_BOT_TOP && refRects.size() == cnst::CORRECT_NUMBER_DETECTED_RECTANGLES_BOT_TOP)
+	TRACE_SCOPE("proc::gnrc::centerPointsVector");
+	ALLOCATION_SCOPE("proc::gnrc::centerPointsVector");
+
+	if(rects.size() < cnst::CORRECT_NUMBER_DETECTED_RECTANGLES_BOT_TOP || refRects.size() < cnst::CORRECT_NUMBER_DETECTED_RECTANGLES_BOT_TOP) return;
+
+	if(rects.size() > cnst::CORRECT_NUMBER_DETECTED_RECTANGLES_BOT_TOP || refRects.size() > cnst::CORRECT_NUMBER_DETECTED_RECTANGLES_BOT_TOP)
+	{
+		vector<vector<cv::Point>> quads;
+
+		proc::gnrc::pairReferences(quads, rects, refRects, vector<double>(1, aspect), 1);
+
+		if(!quads.empty()) points.insert(points.end(), quads[0].begin(), quads[0].end());
+	}
+	else
 	{
 		vector<cv::Point> refPoints;
 
@@ -108,26 +152,555 @@ void proc::gnrc::centerPointsVector(std::vector<cv::Point> & points, std::vector
 	}
 }
 
+/**
+	\brief gnrc member function
+
+	@param[out] quads a reference to a std::vector of std::vectors containing cv::Point objects to be filled with the reference sticker centers of each found board or storage as function output
+	@param[in] rects a constant reference to a std::vector containing cv::Rect objects representing the candidate areas of the bottom reference stickers
+	@param[in] refRects a constant reference to a std::vector containing cv::Rect objects representing the candidate areas of the top reference stickers
+	@param[in] aspects a constant reference to a std::vector containing the configured width of the reference stickers divided by their height of every kind of object searched
+	@param[in] maxQuads a constant int containing the maximal number of boards or storages to be found
+
+	Pairs any number of candidates of both colors to the reference stickers of up to maxQuads boards or storages. Only the cnst::PAIRING_MAX_CANDIDATES largest candidates
+	of each color are considered, so a frame costs at most a few hundred quadrilaterals per board. Each pair of bottom and pair of top candidates forms a quadrilateral in the order
+	of proc::gnrc::centerPointsVector(), which is scored by geo::referenceQuadScore() at the best fitting aspect plus cnst::PAIRING_SIZE_WEIGHT times the logarithmic spread of the candidate areas.
+	The best quadrilateral below cnst::PAIRING_MAX_SCORE is taken and its candidates are removed before the next one is searched, the quads are ordered by their score
+
+	@see geo::referenceQuadScore()
+*/
+void proc::gnrc::pairReferences(std::vector<std::vector<cv::Point>> & quads, std::vector<cv::Rect> const & rects, std::vector<cv::Rect> const & refRects, std::vector<double> const & aspects, int const maxQuads)
+{
+	TRACE_SCOPE("proc::gnrc::pairReferences");
+	ALLOCATION_SCOPE("proc::gnrc::pairReferences");
+
+	vector<cv::Rect> candidates[2] = { rects, refRects };
+	vector<cv::Point> centers[2];
+	vector<bool> used[2];
+
+	for(int c = 0; c < 2; c++)
+	{
+		if(candidates[c].size() > (size_t) cnst::PAIRING_MAX_CANDIDATES)
+		{
+			std::partial_sort(candidates[c].begin(), candidates[c].begin() + cnst::PAIRING_MAX_CANDIDATES, candidates[c].end(), [](cv::Rect const & a, cv::Rect const & b) { return a.area() > b.area(); });
+			candidates[c].resize(cnst::PAIRING_MAX_CANDIDATES);
+		}
+
+		for(vector<cv::Rect>::iterator it = candidates[c].begin(); it != candidates[c].end(); ++it)
+			centers[c].push_back(cv::Point(it->x + it->width / 2, it->y + it->height / 2));
+
+		used[c].assign(candidates[c].size(), false);
+	}
+
+	vector<cv::Rect> const & bottom = candidates[0];
+	vector<cv::Rect> const & top = candidates[1];
+
+	while((int) quads.size() < maxQuads)
+	{
+		double best = cnst::PAIRING_MAX_SCORE;
+		int chosen[4] = { -1, -1, -1, -1 };
+
+		for(size_t a = 0; a < bottom.size(); a++)
+		{
+			for(size_t b = a + 1; b < bottom.size(); b++)
+			{
+				if(used[0][a] || used[0][b]) continue;
+
+				size_t const bottomLeft = centers[0][a].x <= centers[0][b].x ? a : b;
+				size_t const bottomRight = bottomLeft == a ? b : a;
+
+				for(size_t c = 0; c < top.size(); c++)
+				{
+					for(size_t d = c + 1; d < top.size(); d++)
+					{
+						if(used[1][c] || used[1][d]) continue;
+
+						size_t const topLeft = centers[1][c].x <= centers[1][d].x ? c : d;
+						size_t const topRight = topLeft == c ? d : c;
+
+						vector<cv::Point> const quad { centers[1][topLeft], centers[0][bottomLeft], centers[0][bottomRight], centers[1][topRight] };
+
+						double const smallest = std::min(std::min(bottom[a].area(), bottom[b].area()), std::min(top[c].area(), top[d].area()));
+						double const largest = std::max(std::max(bottom[a].area(), bottom[b].area()), std::max(top[c].area(), top[d].area()));
+
+						if(!(smallest > 0.0)) continue;
+
+						double shape = std::numeric_limits<double>::infinity();
+
+						for(vector<double>::const_iterator it = aspects.begin(); it != aspects.end(); ++it) shape = std::min(shape, geo::referenceQuadScore(quad, *it));
+
+						double const score = shape + cnst::PAIRING_SIZE_WEIGHT * std::log(largest / smallest);
+
+						if(score < best)
+						{
+							best = score;
+							chosen[0] = (int) topLeft; chosen[1] = (int) bottomLeft; chosen[2] = (int) bottomRight; chosen[3] = (int) topRight;
+						}
+					}
+				}
+			}
+		}
+
+		if(chosen[0] < 0) break;
+
+		quads.push_back(vector<cv::Point> { centers[1][chosen[0]], centers[0][chosen[1]], centers[0][chosen[2]], centers[1][chosen[3]] });
+
+		used[1][chosen[0]] = used[0][chosen[1]] = used[0][chosen[2]] = used[1][chosen[3]] = true;
+	}
+}
+
+/**
+	\brief gnrc member function
+
+	@param[out] objects a reference to a std::vector of std::vectors containing cv::Point objects to be filled with the reference sticker centers of each object as function output
+	@param[in] points a constant reference to a std::vector containing cv::Point objects depicting the reference sticker centers of the found objects one after another
+	@param[in] aspects a constant reference to a std::vector containing the configured width of the reference stickers divided by their height of every object
+
+	Tells the found objects apart by the aspect ratio of their reference stickers. Every object gets at most one quadrilateral of cnst::NUMBER_CORNERS points,
+	the assignment with the lowest sum of geo::referenceQuadScore() wins. An object which is not found is left empty, the points of objects in excess are dropped
+
+	@see proc::gnrc::pairReferences()
+	@see geo::referenceQuadScore()
+*/
+void proc::gnrc::assignReferences(std::vector<std::vector<cv::Point>> & objects, std::vector<cv::Point> const & points, std::vector<double> const & aspects)
+{
+	TRACE_SCOPE("proc::gnrc::assignReferences");
+	ALLOCATION_SCOPE("proc::gnrc::assignReferences");
+
+	size_t const found = std::min(points.size() / cnst::NUMBER_CORNERS, aspects.size());
+
+	vector<int> order(aspects.size()), chosen;
+	double best = std::numeric_limits<double>::infinity();
+
+	for(size_t i = 0; i < order.size(); i++) order[i] = (int) i;
+
+	objects.assign(aspects.size(), vector<cv::Point>());
+
+	do
+	{
+		double score = 0.0;
+
+		for(size_t q = 0; q < found; q++)
+			score += geo::referenceQuadScore(vector<cv::Point>(points.begin() + q * cnst::NUMBER_CORNERS, points.begin() + (q + 1) * cnst::NUMBER_CORNERS), aspects[order[q]]);
+
+		if(chosen.empty() || score < best)
+		{
+			best = score;
+			chosen = order;
+		}
+	}
+	while(std::next_permutation(order.begin(), order.end()));
+
+	for(size_t q = 0; q < found; q++)
+		objects[chosen[q]].assign(points.begin() + q * cnst::NUMBER_CORNERS, points.begin() + (q + 1) * cnst::NUMBER_CORNERS);
+}
+
+/**
+	\brief gnrc member function
+
+	@param[out] graph a reference to an aux::TaskGraph object to be filled with the detection steps as first function output
+	@param[out] points a reference to a std::vector containing cv::Point objects to be filled with the reference sticker center points by the last node as second function output
+	@param[out] topReferenceRects a reference to a std::vector containing cv::Rect objects to be filled with the red reference sticker areas
+	@param[out] bottomReferenceRects a reference to a std::vector containing cv::Rect objects to be filled with the blue reference sticker areas
+	@param[out] pyramid a reference to a cv::Mat object to be filled with the downsampled color corrected frame, or the luma image if the model uses markers
+	@param[out] hsv a reference to a cv::Mat object to be filled with the HSV detection image
+	@param[in] session a reference to the aux::Session object containing the color correction factors and the pinned model
+	@param[in] frame a reference to a cv::Mat object containing frame data
+	@param[in] plan a constant reference to the aux::QualityController::Plan of the frame, which has to outlive the graph
+	@param[in] aspects a constant reference to a std::vector containing the configured width of the reference stickers divided by their height of every object searched, which has to outlive the graph
+
+	Declares the detection steps shared by the withdrawal and implementation action. The detection image is built once after the color correction,
+	the red and blue reference sticker detections, the white balance and the optional region statistics only depend on it and therefore run concurrently,
+	the detections join before the center points are calculated.
+	The center points node is the last node added. A single object takes its center points from proc::gnrc::centerPointsVector(), several objects are paired from the same
+	candidates by proc::gnrc::pairReferences() and their points follow one another, so the combined action segments the frame only once. The stickers are searched in the window and at the pyramid level of the plan, a frame which is not planned
+	to detect them reuses the reference points of the plan.
+	A model referenced by binary fiducial markers skips the detection image, the white balance and the region statistics. The luma of the raw frame is taken first,
+	then the color correction and the marker detection run concurrently and are joined by the last node. The markers are searched one pyramid level finer than
+	the stickers, since a bit is smaller than a sticker and the luma costs a quarter of the color image.
+	A frame due for the QR code search searches the color corrected frame concurrently to the detections and is joined by the last node as well, since the code is
+	sampled from the frame before the overlay is drawn into it. The luma of the markers is reused if it covers the whole frame.
+
+	@see aux::QualityController::plan()
+	@see proc::gnrc::correctColors()
+	@see proc::gnrc::detectionImage()
+	@see proc::gnrc::balanceWhite()
+	@see proc::gnrc::regionStatistics()
+	@see proc::gnrc::contourVector()
+	@see proc::gnrc::rectangleVector()
+	@see proc::gnrc::centerPointsVector()
+	@see proc::gnrc::pairReferences()
+	@see mark::referencePoints()
+	@see proc::gnrc::scanCode()
+	@see aux::Session::codeScanDue()
+	@see cnst::BOTTOM_STICKERS_RED
+	@see cnst::COLOR_RADIUS_BOTTOM
+	@see cnst::TOP_STICKERS_BLUE
+	@see cnst::COLOR_RADIUS_TOP
+*/
+void proc::gnrc::detectionGraph(aux::TaskGraph & graph, std::vector<cv::Point> & points, std::vector<cv::Rect> & topReferenceRects, std::vector<cv::Rect> & bottomReferenceRects, cv::Mat & pyramid, cv::Mat & hsv, aux::Session & session, cv::Mat & frame, aux::QualityController::Plan const & plan, std::vector<double> const & aspects)
+{
+	if(plan.detect && session.model().board().markers())
+	{
+		int const level = std::max(plan.quality.pyramidLevel - 1, 0);
+
+		int luma = graph.add("lumaImage", [&pyramid, &frame, &plan, level] {
+			mark::lumaImage(pyramid, frame(plan.window), level);
+		});
+
+		int correction = graph.add("correctColors", [&session, &frame] {
+			proc::gnrc::correctColors(session, frame);
+		}, { luma });
+
+		int markers = graph.add("detectMarkers", [&points, &pyramid, &plan, level] {
+			mark::referencePoints(points, pyramid, level, plan.window.tl());
+		}, { luma });
+
+		vector<int> joined = { correction, markers };
+
+		if(session.codeScanDue())
+		{
+			joined.push_back(graph.add("scanCode", [&session, &pyramid, &frame, &plan, level] {
+				if(plan.window.size() == frame.size()) proc::gnrc::scanCode(session, pyramid, level, plan.window.tl(), frame);
+				else proc::gnrc::scanCode(session, frame);
+			}, { correction }));
+		}
+
+		graph.add("referencePoints", [] {}, joined);
+
+		return;
+	}
+
+	int correction = graph.add("correctColors", [&session, &frame] {
+		proc::gnrc::correctColors(session, frame);
+	});
+
+	vector<int> scanned;
+
+	if(session.codeScanDue())
+	{
+		scanned.push_back(graph.add("scanCode", [&session, &frame] {
+			proc::gnrc::scanCode(session, frame);
+		}, { correction }));
+	}
+
+	if(!plan.detect)
+	{
+		vector<int> joined = { correction };
+
+		joined.insert(joined.end(), scanned.begin(), scanned.end());
+
+		graph.add("trackedPoints", [&points, &plan] {
+			points = plan.references;
+		}, joined);
+
+		return;
+	}
+
+	int image = graph.add("detectionImage", [&pyramid, &hsv, &frame, &plan] {
+		proc::gnrc::detectionImage(pyramid, hsv, frame(plan.window), plan.quality.pyramidLevel);
+	}, { correction });
+
+	graph.add("balanceWhite", [&session, &pyramid] {
+		proc::gnrc::balanceWhite(session, pyramid);
+	}, { image });
+
+	if(session.collectsStatistics())
+	{
+		graph.add("regionStatistics", [&session, &pyramid, &plan] {
+			proc::gnrc::regionStatistics(session, pyramid, plan.quality.pyramidLevel, plan.window.tl());
+		}, { image });
+	}
+
+	int red = graph.add("detectRed", [&hsv, &topReferenceRects, &plan] {
+		double maxAreaRed = 0.0;
+		vector<vector<cv::Point>> contours;
+
+		proc::gnrc::contourVector(contours, maxAreaRed, hsv, cnst::BOTTOM_STICKERS_RED - cnst::COLOR_RADIUS_BOTTOM, cnst::BOTTOM_STICKERS_RED + cnst::COLOR_RADIUS_BOTTOM, plan.quality.pyramidLevel);
+		proc::gnrc::rectangleVector(topReferenceRects, contours);
+
+		for(vector<cv::Rect>::iterator it = topReferenceRects.begin(); it != topReferenceRects.end(); ++it) *it += plan.window.tl();
+	}, { image });
+
+	int blue = graph.add("detectBlue", [&hsv, &bottomReferenceRects, &plan] {
+		double maxAreaBlue = 0.0;
+		vector<vector<cv::Point>> contours;
+
+		proc::gnrc::contourVector(contours, maxAreaBlue, hsv, cnst::TOP_STICKERS_BLUE - cnst::COLOR_RADIUS_TOP, cnst::TOP_STICKERS_BLUE + cnst::COLOR_RADIUS_TOP, plan.quality.pyramidLevel);
+		proc::gnrc::rectangleVector(bottomReferenceRects, contours);
+
+		for(vector<cv::Rect>::iterator it = bottomReferenceRects.begin(); it != bottomReferenceRects.end(); ++it) *it += plan.window.tl();
+	}, { image });
+
+	vector<int> joined = { red, blue };
+
+	joined.insert(joined.end(), scanned.begin(), scanned.end());
+
+	graph.add("centerPointsVector", [&points, &topReferenceRects, &bottomReferenceRects, &aspects] {
+		if(aspects.size() == 1)
+		{
+			proc::gnrc::centerPointsVector(points, topReferenceRects, bottomReferenceRects, aspects[0]);
+			return;
+		}
+
+		vector<vector<cv::Point>> quads;
+
+		proc::gnrc::pairReferences(quads, topReferenceRects, bottomReferenceRects, aspects, (int) aspects.size());
+
+		for(vector<vector<cv::Point>>::iterator it = quads.begin(); it != quads.end(); ++it) points.insert(points.end(), it->begin(), it->end());
+	}, joined);
+}
+
+/**
+	\brief gnrc member function
+
+	@param[out] pyramid a reference to a cv::Mat object to be filled with the downsampled frame as first function output
+	@param[out] hsv a reference to a cv::Mat object to be filled with the downsampled frame in the full range HSV space as second function output
+	@param[in] frame a constant reference to a cv::Mat object containing the color corrected frame data
+	@param[in] pyramidLevel a constant int containing the number of times the frame is halved, at least 1
+
+	Builds the detection image shared by the sticker detections and the white balance
+
+	@see cnst::DETECTION_PYRAMID_LEVEL
+*/
+void proc::gnrc::detectionImage(cv::Mat & pyramid, cv::Mat & hsv, cv::Mat const & frame, int const pyramidLevel)
+{
+	TRACE_SCOPE("proc::gnrc::detectionImage");
+	ALLOCATION_SCOPE("proc::gnrc::detectionImage");
+	PERF_SCOPE("proc::gnrc::detectionImage", frame.total());
+
+	cv::pyrDown(frame, pyramid);
+
+	for(int i = 1; i < pyramidLevel; i++) cv::pyrDown(pyramid, pyramid);
+
+	cv::cvtColor(pyramid, hsv, cv::COLOR_RGB2HSV_FULL);
+}
+
+/**
+	\brief gnrc member function
+
+	@param[out] session a reference to the aux::Session object whose color correction factors are adjusted
+	@param[in] pyramid a constant reference to a cv::Mat object containing the downsampled color corrected frame
+
+	Averages the neutral pixels, whose channels all lie between cnst::WHITE_BALANCE_DARK and cnst::WHITE_BALANCE_SATURATION and differ by at most
+	cnst::WHITE_BALANCE_NEUTRAL_SPREAD of the brightest one, which leaves out the board, the reference stickers, the components, highlights and shadows.
+	The correction factors of the following frames are adjusted with it. Frames with less than cnst::WHITE_BALANCE_MIN_COVERAGE of neutral pixels are skipped
+
+	@see aux::Session::balanceColors()
+	@see aux::WhiteBalance
+	@see aux::Recording::now()
+*/
+void proc::gnrc::balanceWhite(aux::Session & session, cv::Mat const & pyramid)
+{
+	TRACE_SCOPE("proc::gnrc::balanceWhite");
+	ALLOCATION_SCOPE("proc::gnrc::balanceWhite");
+	PERF_SCOPE("proc::gnrc::balanceWhite", pyramid.total());
+
+	int const channels = pyramid.channels();
+	double sums[3] = { 0.0, 0.0, 0.0 };
+	int neutral = 0;
+
+	for(int y = 0; y < pyramid.rows; y++)
+	{
+		uchar const * pixel = pyramid.ptr<uchar>(y);
+
+		for(int x = 0; x < pyramid.cols; x++, pixel += channels)
+		{
+			int const low = std::min(std::min(pixel[0], pixel[1]), pixel[2]);
+			int const high = std::max(std::max(pixel[0], pixel[1]), pixel[2]);
+
+			if(low < cnst::WHITE_BALANCE_DARK || high > cnst::WHITE_BALANCE_SATURATION || high - low > cnst::WHITE_BALANCE_NEUTRAL_SPREAD * high) continue;
+
+			sums[0] += pixel[0];
+			sums[1] += pixel[1];
+			sums[2] += pixel[2];
+			neutral++;
+		}
+	}
+
+	if(neutral == 0 || neutral < cnst::WHITE_BALANCE_MIN_COVERAGE * pyramid.total()) return;
+
+	session.balanceColors(cv::Scalar(sums[0] / neutral, sums[1] / neutral, sums[2] / neutral), aux::Recording::now());
+}
+
+/**
+	\brief gnrc member function
+
+	@param[out] session a reference to the aux::Session object the statistics are published to
+	@param[in] pyramid a constant reference to a cv::Mat object containing the downsampled color corrected frame
+	@param[in] pyramidLevel a constant int containing the number of times the frame was halved for the pyramid
+	@param[in] offset a constant reference to a cv::Point object containing the position of the pyramid origin in the frame
+
+	Builds the summed-area table of the detection image, after which any number of regions of the frame is measured in constant time each.
+	The collection is checked again before the table is built and when it is published, so a frame running while the collection is disabled publishes nothing
+
+	@see aux::RegionStatistics
+	@see aux::Session::collectsStatistics()
+	@see aux::Session::publishStatistics()
+	@see aux::Session::statistics()
+*/
+void proc::gnrc::regionStatistics(aux::Session & session, cv::Mat const & pyramid, int const pyramidLevel, cv::Point const & offset)
+{
+	TRACE_SCOPE("proc::gnrc::regionStatistics");
+	ALLOCATION_SCOPE("proc::gnrc::regionStatistics");
+	PERF_SCOPE("proc::gnrc::regionStatistics", pyramid.total());
+
+	if(!session.collectsStatistics()) return;
+
+	std::shared_ptr<aux::RegionStatistics> statistics = std::make_shared<aux::RegionStatistics>();
+
+	statistics->build(pyramid, pyramidLevel, offset);
+
+	session.publishStatistics(statistics);
+}
+
+/**
+	\brief gnrc member function
+
+	@param[out] session a reference to the aux::Session object the decoded code is published to
+	@param[in] gray a constant reference to a cv::Mat object containing the luma image the finder patterns are searched in
+	@param[in] pyramidLevel a constant int containing the number of times the frame was halved for the luma image
+	@param[in] offset a constant reference to a cv::Point object containing the position of the luma image origin in the frame
+	@param[in] frame a constant reference to a cv::Mat object containing RGBA frame data the code is sampled from
+
+	Searches the luma image for a QR code, only its region of the frame is converted and rectified
+
+	@see qr::scan()
+	@see aux::Session::takeCode()
+
+	@return true if a code was decoded, false otherwise
+*/
+bool proc::gnrc::scanCode(aux::Session & session, cv::Mat const & gray, int const pyramidLevel, cv::Point const & offset, cv::Mat const & frame)
+{
+	TRACE_SCOPE("proc::gnrc::scanCode");
+	ALLOCATION_SCOPE("proc::gnrc::scanCode");
+
+	std::string code;
+
+	if(!qr::scan(code, gray, pyramidLevel, offset, frame)) return false;
+
+	session.publishCode(code);
+
+	return true;
+}
+
+/**
+	\brief gnrc member function
+
+	@param[out] session a reference to the aux::Session object the decoded code is published to
+	@param[in] frame a constant reference to a cv::Mat object containing RGBA frame data
+
+	Searches the whole frame for a QR code in its luma at cnst::CODE_PYRAMID_LEVEL, for frames without a luma image of the pipeline
+
+	@see mark::lumaImage()
+
+	@return true if a code was decoded, false otherwise
+*/
+bool proc::gnrc::scanCode(aux::Session & session, cv::Mat const & frame)
+{
+	cv::Mat gray;
+
+	mark::lumaImage(gray, frame, cnst::CODE_PYRAMID_LEVEL);
+
+	return proc::gnrc::scanCode(session, gray, cnst::CODE_PYRAMID_LEVEL, cv::Point(0, 0), frame);
+}
+
+/**
+	\brief gnrc member function
+
+	@param[out] area a reference to a cv::Rect object to be filled with the part of the frame an overlay is drawn in as function output
+	@param[in] outline a constant reference to a std::vector containing cv::Point objects depicting the corner points of the board or storage enclosing the overlay
+	@param[in] size a constant reference to a cv::Size object containing the dimensions of the frame
+
+	Calculates the bounding rectangle of the outline grown by the line thickness and clipped to the frame, outside of it blending leaves the frame unchanged
+
+	@see cnst::HIGHLIGHT_LINE_THICKNESS
+*/
+void proc::gnrc::overlayArea(cv::Rect & area, std::vector<cv::Point> const & outline, cv::Size const & size)
+{
+	cv::Rect const extent = cv::boundingRect(outline);
+
+	int const margin = cnst::HIGHLIGHT_LINE_THICKNESS + 1;
+	int const left = std::max(0, extent.x - margin);
+	int const top = std::max(0, extent.y - margin);
+	int const right = std::min(size.width, extent.x + extent.width + margin);
+	int const bottom = std::min(size.height, extent.y + extent.height + margin);
+
+	area = cv::Rect(left, top, std::max(0, right - left), std::max(0, bottom - top));
+}
+
+/**
+	\brief gnrc member function
+
+	@param[out] undistorted a reference to a std::vector containing cv::Point objects to be filled with the points in the pinhole frame as function output
+	@param[in] points a constant reference to a std::vector containing cv::Point objects depicting detected points in the frame
+	@param[in] camera a constant pointer to the aux::CameraModel of the lens built for the frame, nullptr for a pinhole camera
+
+	Moves the detected reference points into the pinhole frame the geometry is computed in, they are copied for a pinhole camera
+
+	@see aux::CameraModel::undistort()
+*/
+void proc::gnrc::undistortPoints(std::vector<cv::Point> & undistorted, std::vector<cv::Point> const & points, aux::CameraModel const * camera)
+{
+	TRACE_SCOPE("proc::gnrc::undistortPoints");
+
+	if(camera) camera->undistort(undistorted, points);
+	else undistorted = points;
+}
+
+/**
+	\brief gnrc member function
+
+	@param[in,out] points a reference to a std::vector containing cv::Point objects depicting vertices in the pinhole frame to be moved to the frame as function output
+	@param[in] camera a constant pointer to the aux::CameraModel of the lens built for the frame, nullptr for a pinhole camera
+
+	@see aux::CameraModel::distort()
+*/
+void proc::gnrc::distortPoints(std::vector<cv::Point> & points, aux::CameraModel const * camera)
+{
+	if(camera) camera->distort(points);
+}
+
+/**
+	\brief gnrc member function
+
+	@param[in,out] polygons a reference to a std::vector of std::vectors containing cv::Point objects depicting polygons in the pinhole frame to be moved to the frame as function output
+	@param[in] camera a constant pointer to the aux::CameraModel of the lens built for the frame, nullptr for a pinhole camera
+
+	Only the vertices are moved, the edges between them stay straight, which is accurate as long as a polygon covers a small part of the frame
+
+	@see aux::CameraModel::distort()
+*/
+void proc::gnrc::distortPoints(std::vector<std::vector<cv::Point>> & polygons, aux::CameraModel const * camera)
+{
+	TRACE_SCOPE("proc::gnrc::distortPoints");
+
+	if(camera) camera->distort(polygons);
+}
+
 /**
 	\brief asmb member function
 
+	@param[in] session a reference to the aux::Session object whose pinned aux::Model contains the board factors
 	@param[out] targetPoints a reference to a std::vector containing cv::Point objects to be filled with retrieved data as function output
 	@param[in] points a constant reference to a std::vector containing cv::Point objects used as geometric vectors to calculate the target points
 
 	Calculates the target corner points of the observed real object via the geometric vectors of the reference stickers and determined shrinking or stretching vectors and stores them to the data structure.
 
-	@see proc::asmb::targetPointsVectors
+	@see aux::Model::boardTargetPointsVectors()
 	@see geo::vectorToPoint()
 	@see cnst::NUMBER_CORNERS
 */
-void proc::asmb::targetPointsVector(std::vector<cv::Point> & targetPoints, std::vector<cv::Point> const & points)
+void proc::asmb::targetPointsVector(aux::Session & session, std::vector<cv::Point> & targetPoints, std::vector<cv::Point> const & points)
 {
+	TRACE_SCOPE("proc::asmb::targetPointsVector");
+	ALLOCATION_SCOPE("proc::asmb::targetPointsVector");
+
 	if(points.size() == cnst::NUMBER_CORNERS && points[0].y < points[1].y)
 	{
-		cv::Point topLeftTargetPoint = geo::vectorToPoint(vector<cv::Point> {points[0], points[1], points[3]}, proc::asmb::targetPointsVectors[0]);
-		cv::Point bottomLeftTargetPoint = geo::vectorToPoint(vector<cv::Point> {points[1], points[0], points[2]}, proc::asmb::targetPointsVectors[1]);
-		cv::Point bottomRightTargetPoint = geo::vectorToPoint(vector<cv::Point> {points[2], points[3], points[1]}, proc::asmb::targetPointsVectors[2]);
-		cv::Point topRightTargetPoint = geo::vectorToPoint(vector<cv::Point> {points[3], points[2], points[0]}, proc::asmb::targetPointsVectors[3]);
+		cv::Point topLeftTargetPoint = geo::vectorToPoint(vector<cv::Point> {points[0], points[1], points[3]}, session.model().boardTargetPointsVectors()[0]);
+		cv::Point bottomLeftTargetPoint = geo::vectorToPoint(vector<cv::Point> {points[1], points[0], points[2]}, session.model().boardTargetPointsVectors()[1]);
+		cv::Point bottomRightTargetPoint = geo::vectorToPoint(vector<cv::Point> {points[2], points[3], points[1]}, session.model().boardTargetPointsVectors()[2]);
+		cv::Point topRightTargetPoint = geo::vectorToPoint(vector<cv::Point> {points[3], points[2], points[0]}, session.model().boardTargetPointsVectors()[3]);
 
 		targetPoints.push_back(topLeftTargetPoint);
 		targetPoints.push_back(bottomLeftTargetPoint);
@@ -139,20 +712,26 @@ void proc::asmb::targetPointsVector(std::vector<cv::Point> & targetPoints, std::
 /**
 	\brief asmb member function
 
+	@param[in] session a reference to the aux::Session object whose pinned aux::Model contains the board
 	@param[out] assemblyPlaces a reference to a std::vector of std::vectors containing cv::Point objects to be filled with retrieved data as function output
 	@param[in] boardPoints a constant reference to a std::vector containing cv::Point objects depicting the corner points of a board
 	@param[in] compNum a constant int variable containing the number of the component
+	@param[in] frameSize a constant reference to a cv::Size object containing the dimensions of the frame
 
-	Calculates the implementation locations of a component based on its number
+	Calculates the implementation locations of a component based on its number, only locations within the frame and larger than a pixel are calculated
 
 	@see cnst::NUMBER_CORNERS
-	@see proc::asmb::board
+	@see aux::Model::board()
+	@see aux::Model::placementIndex()
 	@see geo::assemblyPointsVector<T>()
 */
-void proc::asmb::insertionPlacesVector(std::vector<std::vector<cv::Point>> & assemblyPlaces, std::vector<cv::Point> const & boardPoints, int const compNum)
+void proc::asmb::insertionPlacesVector(aux::Session & session, std::vector<std::vector<cv::Point>> & assemblyPlaces, std::vector<cv::Point> const & boardPoints, int const compNum, cv::Size const & frameSize)
 {
+	TRACE_SCOPE("proc::asmb::insertionPlacesVector");
+	ALLOCATION_SCOPE("proc::asmb::insertionPlacesVector");
+
 	if(boardPoints.size() == cnst::NUMBER_CORNERS)
-		geo::assemblyPointsVector<double>(assemblyPlaces, boardPoints, proc::asmb::board, compNum);
+		geo::assemblyPointsVector<double>(assemblyPlaces, boardPoints, session.model().board(), session.model().placementIndex(), compNum, frameSize);
 }
 
 /**
@@ -161,11 +740,15 @@ void proc::asmb::insertionPlacesVector(std::vector<std::vector<cv::Point>> & ass
 	@param[out] frame a reference to a cv::Mat object containing frame data to be modified as function output
 	@param[in] points a constant reference to a std::vector containing cv::Point objects depicting the corner points of the board
 	@param[in] locations a constant reference to a std::vector of std::vectors containing cv::Point objects depicting the implementation locations
+	@param[in] overlay a constant aux::QualityController::Overlay containing the drawing quality
 
-	Displays all the calculated data
+	Displays all the calculated data. The full quality blends the whole frame and draws anti-aliased lines, the blended quality only blends the area
+	of the board and draws plain lines, the outline quality only draws plain lines.
+	The locations are drawn into a second untouched copy of the blended area, so the board keeps the same tint whether locations are shown or not
 
 	@see cnst::NUMBER_CORNERS
 	@see geo::areTargetAnglesSufficient()
+	@see proc::gnrc::overlayArea()
 	@see cnst::COLOR_RED
 	@see cnst::HIGHLIGHTING_COLOR
 	@see cnst::HIGHLIGHT_LINE_THICKNESS
@@ -176,40 +759,444 @@ void proc::asmb::insertionPlacesVector(std::vector<std::vector<cv::Point>> & ass
 	@see cnst::IMPLEMENTATION_BETA_2
 	@see cnst::GAMMA
 	@see cnst::ANTI_ALIASING
+	@see cnst::HIGHLIGHT_LINE_TYPE
 */
-void proc::asmb::displayImplementation(cv::Mat & frame, std::vector<cv::Point> const & points, std::vector<std::vector<cv::Point>> & locations)
+void proc::asmb::displayImplementation(cv::Mat & frame, std::vector<cv::Point> const & points, std::vector<std::vector<cv::Point>> & locations, aux::QualityController::Overlay const overlay)
 {
+	TRACE_SCOPE("proc::asmb::displayImplementation");
+	ALLOCATION_SCOPE("proc::asmb::displayImplementation");
+
 	if(points.size() == cnst::NUMBER_CORNERS)
 	{
 		if(geo::areTargetAnglesSufficient(points))
 		{
-			cv::Mat mat1, mat2;
-			frame.copyTo(mat1);
-			frame.copyTo(mat2);
+			int const lineType = overlay == aux::QualityController::OVERLAY_FULL ? cnst::ANTI_ALIASING : cnst::HIGHLIGHT_LINE_TYPE;
 
-			cv::fillConvexPoly(mat1, points, cnst::COLOR_RED);
+			cv::Rect area(0, 0, frame.cols, frame.rows);
 
-			for(int i = 0; i < locations.size(); i++)
-				cv::fillConvexPoly(mat2, locations[i], cnst::HIGHLIGHTING_COLOR, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::HIGHLIGHT_SHIFT_NONE);
+			if(overlay == aux::QualityController::OVERLAY_BLENDED) proc::gnrc::overlayArea(area, points, frame.size());
+
+			if(overlay != aux::QualityController::OVERLAY_OUTLINE && area.area() > 0)
+			{
+				cv::Mat region(frame, area);
+				cv::Mat mat, highlighted;
+
+				ALLOCATION_TRACK(mat);
+				ALLOCATION_TRACK(highlighted);
+
+				region.copyTo(mat);
+				mat.copyTo(highlighted);
+
+				for(int i = 0; i < locations.size(); i++)
+				{
+					cv::Point const * corners = locations[i].data();
+					int const count = (int) locations[i].size();
+
+					cv::fillPoly(highlighted, &corners, &count, 1, cnst::HIGHLIGHTING_COLOR, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::HIGHLIGHT_SHIFT_NONE, -area.tl());
+				}
+
+				cv::fillConvexPoly(frame, points, cnst::COLOR_RED);
+
+				{
+					PERF_SCOPE("proc::asmb::displayImplementation/addWeighted1", region.total());
+					cv::addWeighted(mat, cnst::IMPLEMENTATION_APLHA_1, region, cnst::IMPLEMENTATION_BETA_1, cnst::GAMMA, region);
+				}
 
+				{
+					PERF_SCOPE("proc::asmb::displayImplementation/addWeighted2", region.total());
+					cv::addWeighted(region, cnst::IMPLEMENTATION_APLHA_2, highlighted, cnst::IMPLEMENTATION_BETA_2, cnst::GAMMA, region);
+				}
 
-			cv::addWeighted(frame, cnst::IMPLEMENTATION_APLHA_1, mat1, cnst::IMPLEMENTATION_BETA_1, cnst::GAMMA, frame);
-			cv::addWeighted(frame, cnst::IMPLEMENTATION_APLHA_2, mat2, cnst::IMPLEMENTATION_BETA_2, cnst::GAMMA, frame);
+				mat.release();
+				highlighted.release();
+			}
 
-			cv::line(frame, points[0], points[1], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
-			cv::line(frame, points[0], points[3], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
-			cv::line(frame, points[2], points[1], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
-			cv::line(frame, points[2], points[3], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
+			cv::line(frame, points[0], points[1], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+			cv::line(frame, points[0], points[3], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+			cv::line(frame, points[2], points[1], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+			cv::line(frame, points[2], points[3], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
 
 			for(int i = 0; i < locations.size(); i++)
 			{
-				cv::line(frame, locations[i][0], locations[i][1], cnst::HIGHLIGHTING_COLOR, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
-				cv::line(frame, locations[i][0], locations[i][3], cnst::HIGHLIGHTING_COLOR, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
-				cv::line(frame, locations[i][2], locations[i][1], cnst::HIGHLIGHTING_COLOR, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
-				cv::line(frame, locations[i][2], locations[i][3], cnst::HIGHLIGHTING_COLOR, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
+				cv::line(frame, locations[i][0], locations[i][1], cnst::HIGHLIGHTING_COLOR, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+				cv::line(frame, locations[i][0], locations[i][3], cnst::HIGHLIGHTING_COLOR, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+				cv::line(frame, locations[i][2], locations[i][1], cnst::HIGHLIGHTING_COLOR, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+				cv::line(frame, locations[i][2], locations[i][3], cnst::HIGHLIGHTING_COLOR, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+			}
+		}
+	}
+}
+
+/**
+	\brief asmb member function
+
+	@param[in] session a reference to the aux::Session object of the camera stream
+	@param[out] frame a reference to a cv::Mat object containing frame data to be highlighted as function output
+	@param[in] compNum an constant int containing the number of the component which has to be implemented
+	@param[in] captureTimestamp a constant std::int64_t containing the steady clock time in nanoseconds the frame was captured at, stored with the recorded frame
+	@param[in] pool a reference to the aux::ThreadPool object running the steps of the frame
+	@param[out] result a reference to the aux::FrameResult object to be filled with the reference points, the board corners and the assembly locations as function output
+
+	Calculates all data needed for displaying of implementation locations and shows them for the given frame.
+	The model of the session is pinned for the whole frame, the frame is left untouched if the session is not calibrated yet.
+	The frame is processed as planned by the quality controller of the session, which is given the measured times afterwards.
+	With a camera model the geometry is computed from the undistorted reference points and only the board corners and the locations are distorted back,
+	the reference points of the result stay the detected ones. The unprocessed frame and the result are recorded if a recorder is attached to the session
+
+	@see aux::Session::beginFrame()
+	@see aux::Session::recorder()
+	@see aux::Session::camera()
+	@see aux::QualityController::plan()
+	@see aux::QualityController::update()
+	@see proc::gnrc::detectionGraph()
+	@see proc::gnrc::undistortPoints()
+	@see proc::gnrc::distortPoints()
+	@see proc::asmb::targetPointsVector()
+	@see proc::asmb::insertionPlacesVector()
+	@see proc::asmb::displayImplementation()
+
+	@return true if the frame was processed, false if the session is not calibrated yet
+*/
+bool proc::asmb::processImplementation(aux::Session & session, cv::Mat & frame, int const compNum, std::int64_t const captureTimestamp, aux::ThreadPool & pool, aux::FrameResult & result)
+{
+	vector<vector<cv::Point> > & assemblyPlaces = result.overlay;
+
+	vector<cv::Rect> topReferenceRects, bottomReferenceRects;
+	vector<cv::Point> & points = result.referencePoints;
+	vector<cv::Point> & targetPoints = result.outline;
+	vector<cv::Point> pinholePoints;
+
+	cv::Mat pyramid, hsv;
+
+	std::shared_ptr<aux::RecordingWriter> recorder = session.recorder();
+	aux::RecordingWriter::Frame recorded;
+
+	double const blueFactor = session.blueFactor();
+	double const redFactor = session.redFactor();
+
+	result.clear();
+
+	if(recorder) recorder->capture(recorded, frame);
+
+	result.processed = session.beginFrame();
+
+	if(result.processed)
+	{
+		ALLOCATION_FRAME_SCOPE("implementationFrame");
+
+		aux::TaskGraph graph;
+		aux::QualityController::Plan const plan = session.quality().plan(frame.size());
+
+		std::shared_ptr<aux::CameraModel const> const camera = session.camera(frame.size());
+		cv::Size const pinholeSize = camera ? camera->size() : frame.size();
+
+		std::int64_t const start = aux::Recording::now();
+		std::int64_t detected = start, drawing = start, drawn = start;
+
+		std::vector<double> const & reference = session.model().board().refDimensions();
+		std::vector<double> const aspects(1, reference[0] / reference[1]);
+
+		proc::gnrc::detectionGraph(graph, points, topReferenceRects, bottomReferenceRects, pyramid, hsv, session, frame, plan, aspects);
+
+		graph.add("implementation", [&] {
+			detected = aux::Recording::now();
+			proc::gnrc::undistortPoints(pinholePoints, points, camera.get());
+			proc::asmb::targetPointsVector(session, targetPoints, pinholePoints);
+			proc::asmb::insertionPlacesVector(session, assemblyPlaces, targetPoints, compNum, pinholeSize);
+			proc::gnrc::distortPoints(targetPoints, camera.get());
+			proc::gnrc::distortPoints(assemblyPlaces, camera.get());
+			drawing = aux::Recording::now();
+			proc::asmb::displayImplementation(frame, targetPoints, assemblyPlaces, plan.quality.overlay);
+			drawn = aux::Recording::now();
+		}, { graph.size() - 1 });
+
+		graph.run(pool);
+
+		session.quality().update(points, detected - start, drawn - drawing, aux::Recording::now() - start);
+		session.endFrame();
+	}
+
+	if(recorder) recorder->commit(recorded, aux::Recording::IMPLEMENTATION, compNum, captureTimestamp, blueFactor, redFactor, result);
+
+	return result.processed;
+}
+
+/**
+	\brief asmb member function
+
+	@param[in] session a reference to the aux::Session object whose pinned aux::Model contains the board
+	@param[out] assemblyPlaces a reference to a std::vector of std::vectors containing cv::Point objects to be filled with the implementation locations of all items in drawing order as first function output
+	@param[out] items a reference to a std::vector containing ints to be filled with the index of the work order item of each location as second function output
+	@param[in] boardPoints a constant reference to a std::vector containing cv::Point objects depicting the corner points of a board
+	@param[in] order a constant reference to the aux::WorkOrder containing the components to be highlighted
+	@param[in] frameSize a constant reference to a cv::Size object containing the dimensions of the frame
+
+	Calculates the implementation locations of all components of the work order. The visible region of the board and the minimal size are derived once,
+	the placements of every component are gathered from the placement index and mapped into the frame in one batch. Items naming no component of the board are skipped
+
+	@see cnst::NUMBER_CORNERS
+	@see aux::WorkOrder::drawingOrder()
+	@see aux::Model::placementIndex()
+	@see geo::visibleBoardRegion()
+	@see geo::pixelsPerBoardUnit()
+	@see geo::assemblyPointsVector()
+*/
+void proc::asmb::workOrderPlacesVector(aux::Session & session, std::vector<std::vector<cv::Point>> & assemblyPlaces, std::vector<int> & items, std::vector<cv::Point> const & boardPoints, aux::WorkOrder const & order, cv::Size const & frameSize)
+{
+	TRACE_SCOPE("proc::asmb::workOrderPlacesVector");
+	ALLOCATION_SCOPE("proc::asmb::workOrderPlacesVector");
+
+	if(boardPoints.size() != cnst::NUMBER_CORNERS) return;
+
+	aux::Board<double> const & board = session.model().board();
+
+	double const width = board.boardDimensions()[0];
+	double const height = board.boardDimensions()[1];
+
+	cv::Rect_<double> const region = geo::visibleBoardRegion(boardPoints, width, height, frameSize);
+	double const scale = geo::pixelsPerBoardUnit(boardPoints, width, height);
+
+	vector<aux::PlacementIndex::Placement const *> visible;
+	vector<int> drawing;
+
+	order.drawingOrder(drawing);
+
+	for(vector<int>::const_iterator it = drawing.begin(); it != drawing.end(); ++it)
+	{
+		int const component = order.items[*it].component;
+
+		if(component < 0 || component >= (int) board.components().size()) continue;
+
+		session.model().placementIndex().query(visible, component, region, scale > 0 ? 1.0 / scale : 0.0);
+
+		items.resize(visible.size(), *it);
+	}
+
+	geo::assemblyPointsVector(assemblyPlaces, boardPoints, width, height, visible);
+}
+
+/**
+	\brief asmb member function
+
+	@param[out] frame a reference to a cv::Mat object containing frame data to be modified as function output
+	@param[in] points a constant reference to a std::vector containing cv::Point objects depicting the corner points of the board
+	@param[in] locations a constant reference to a std::vector of std::vectors containing cv::Point objects depicting the implementation locations in drawing order
+	@param[in] items a constant reference to a std::vector containing the index of the work order item of each location
+	@param[in] order a constant reference to the aux::WorkOrder the locations belong to
+	@param[in] overlay a constant aux::QualityController::Overlay containing the drawing quality
+
+	Displays the locations of all components of the work order in the color of their state, tinted like proc::asmb::displayImplementation() tints the board
+	and its locations. The board is blended once at the combined weights of the two passes of proc::asmb::displayImplementation(). The locations are filled once
+	in drawing order into a shared highlight buffer and mask covering the bounding rectangle of their union, the two passes run once over that rectangle
+	and the result is copied through the mask, so every location is drawn a constant number of times.
+	The overlay qualities are the ones of proc::asmb::displayImplementation()
+
+	@see cnst::NUMBER_CORNERS
+	@see geo::areTargetAnglesSufficient()
+	@see proc::gnrc::overlayArea()
+	@see cnst::COLOR_RED
+	@see cnst::WORK_ORDER_COLORS
+	@see cnst::IMPLEMENTATION_APLHA_1
+	@see cnst::IMPLEMENTATION_APLHA_2
+	@see cnst::IMPLEMENTATION_BETA_1
+	@see cnst::IMPLEMENTATION_BETA_2
+	@see cnst::GAMMA
+	@see cnst::HIGHLIGHT_LINE_THICKNESS
+	@see cnst::ANTI_ALIASING
+	@see cnst::HIGHLIGHT_LINE_TYPE
+*/
+void proc::asmb::displayWorkOrder(cv::Mat & frame, std::vector<cv::Point> const & points, std::vector<std::vector<cv::Point>> const & locations, std::vector<int> const & items, aux::WorkOrder const & order, aux::QualityController::Overlay const overlay)
+{
+	TRACE_SCOPE("proc::asmb::displayWorkOrder");
+	ALLOCATION_SCOPE("proc::asmb::displayWorkOrder");
+
+	if(points.size() != cnst::NUMBER_CORNERS || !geo::areTargetAnglesSufficient(points)) return;
+
+	int const lineType = overlay == aux::QualityController::OVERLAY_FULL ? cnst::ANTI_ALIASING : cnst::HIGHLIGHT_LINE_TYPE;
+
+	cv::Rect area(0, 0, frame.cols, frame.rows);
+
+	if(overlay == aux::QualityController::OVERLAY_BLENDED) proc::gnrc::overlayArea(area, points, frame.size());
+
+	if(overlay != aux::QualityController::OVERLAY_OUTLINE && area.area() > 0)
+	{
+		cv::Mat region(frame, area);
+		cv::Mat mat, tinted, highlighted, mask;
+
+		ALLOCATION_TRACK(mat);
+		ALLOCATION_TRACK(tinted);
+		ALLOCATION_TRACK(highlighted);
+		ALLOCATION_TRACK(mask);
+
+		region.copyTo(mat);
+
+		cv::fillConvexPoly(frame, points, cnst::COLOR_RED);
+
+		cv::Rect bounds = locations.empty() ? cv::Rect() : cv::boundingRect(locations[0]);
+
+		for(size_t i = 1; i < locations.size(); i++) bounds |= cv::boundingRect(locations[i]);
+
+		bounds &= area;
+
+		cv::Rect const local(bounds.x - area.x, bounds.y - area.y, bounds.width, bounds.height);
+
+		if(bounds.area() > 0)
+		{
+			cv::Mat const untouched(mat, local);
+			cv::Point const offset = -bounds.tl();
+
+			untouched.copyTo(highlighted);
+			mask = cv::Mat::zeros(local.size(), CV_8UC1);
+
+			for(size_t i = 0; i < locations.size(); i++)
+			{
+				cv::Point const * corners = locations[i].data();
+				int const count = (int) locations[i].size();
+
+				cv::fillPoly(highlighted, &corners, &count, 1, cnst::WORK_ORDER_COLORS[order.items[items[i]].state], cnst::HIGHLIGHT_LINE_THICKNESS, cnst::HIGHLIGHT_SHIFT_NONE, offset);
+				cv::fillPoly(mask, &corners, &count, 1, cv::Scalar::all(cnst::MAXIMUM_COLOR_CHANNEL_VALUE), cnst::HIGHLIGHT_LINE_THICKNESS, cnst::HIGHLIGHT_SHIFT_NONE, offset);
 			}
+
+			cv::addWeighted(untouched, cnst::IMPLEMENTATION_APLHA_1, cv::Mat(region, local), cnst::IMPLEMENTATION_BETA_1, cnst::GAMMA, tinted);
+			cv::addWeighted(tinted, cnst::IMPLEMENTATION_APLHA_2, highlighted, cnst::IMPLEMENTATION_BETA_2, cnst::GAMMA, tinted);
+		}
+
+		{
+			PERF_SCOPE("proc::asmb::displayWorkOrder/addWeighted", region.total());
+			cv::addWeighted(mat, cnst::IMPLEMENTATION_APLHA_1 * cnst::IMPLEMENTATION_APLHA_2 + cnst::IMPLEMENTATION_BETA_2, region,
+				cnst::IMPLEMENTATION_BETA_1 * cnst::IMPLEMENTATION_APLHA_2, cnst::GAMMA, region);
+		}
+
+		if(bounds.area() > 0)
+		{
+			cv::Mat target(region, local);
+
+			tinted.copyTo(target, mask);
 		}
+
+		mat.release();
+		tinted.release();
+		highlighted.release();
+		mask.release();
+	}
+
+	cv::line(frame, points[0], points[1], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+	cv::line(frame, points[0], points[3], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+	cv::line(frame, points[2], points[1], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+	cv::line(frame, points[2], points[3], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+
+	for(size_t i = 0; i < locations.size(); i++)
+	{
+		cv::Scalar const & color = cnst::WORK_ORDER_COLORS[order.items[items[i]].state];
+
+		cv::line(frame, locations[i][0], locations[i][1], color, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+		cv::line(frame, locations[i][0], locations[i][3], color, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+		cv::line(frame, locations[i][2], locations[i][1], color, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+		cv::line(frame, locations[i][2], locations[i][3], color, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+	}
+}
+
+/**
+	\brief asmb member function
+
+	@param[in] session a reference to the aux::Session object of the camera stream
+	@param[out] frame a reference to a cv::Mat object containing frame data to be highlighted as function output
+	@param[in] order a constant reference to the aux::WorkOrder containing the components to be highlighted and their states
+	@param[in] captureTimestamp a constant std::int64_t containing the steady clock time in nanoseconds the frame was captured at, stored with the recorded frame
+	@param[in] pool a reference to the aux::ThreadPool object running the steps of the frame
+	@param[out] result a reference to the aux::FrameResult object to be filled with the reference points, the board corners and the locations of all items in drawing order as function output
+
+	Shows the implementation locations of all components of the work order for the given frame with one detection, one batch of locations and one blending pass,
+	so the cost grows with the number of locations drawn instead of the number of components. Otherwise the frame is processed like by proc::asmb::processImplementation(),
+	including the correction of the lens by a camera model.
+	A recorder attached to the session stores the frame as the implementation of the first current component with only its locations, which is what a replay of that
+	component reproduces, a work order without a current component is not recorded
+
+	@see aux::Session::beginFrame()
+	@see aux::Session::recorder()
+	@see aux::QualityController::plan()
+	@see aux::QualityController::update()
+	@see proc::gnrc::detectionGraph()
+	@see proc::asmb::targetPointsVector()
+	@see proc::asmb::workOrderPlacesVector()
+	@see proc::asmb::displayWorkOrder()
+	@see aux::WorkOrder::current()
+
+	@return true if the frame was processed, false if the session is not calibrated yet
+*/
+bool proc::asmb::processWorkOrder(aux::Session & session, cv::Mat & frame, aux::WorkOrder const & order, std::int64_t const captureTimestamp, aux::ThreadPool & pool, aux::FrameResult & result)
+{
+	vector<cv::Rect> topReferenceRects, bottomReferenceRects;
+	vector<cv::Point> pinholePoints;
+	vector<int> items;
+
+	cv::Mat pyramid, hsv;
+
+	int const current = order.current();
+
+	std::shared_ptr<aux::RecordingWriter> recorder = current >= 0 ? session.recorder() : std::shared_ptr<aux::RecordingWriter>();
+	aux::RecordingWriter::Frame recorded;
+
+	double const blueFactor = session.blueFactor();
+	double const redFactor = session.redFactor();
+
+	result.clear();
+
+	if(recorder) recorder->capture(recorded, frame);
+
+	result.processed = session.beginFrame();
+
+	if(result.processed)
+	{
+		ALLOCATION_FRAME_SCOPE("workOrderFrame");
+
+		aux::TaskGraph graph;
+		aux::QualityController::Plan const plan = session.quality().plan(frame.size());
+
+		std::shared_ptr<aux::CameraModel const> const camera = session.camera(frame.size());
+		cv::Size const pinholeSize = camera ? camera->size() : frame.size();
+
+		std::int64_t const start = aux::Recording::now();
+		std::int64_t detected = start, drawing = start, drawn = start;
+
+		std::vector<double> const & reference = session.model().board().refDimensions();
+		std::vector<double> const aspects(1, reference[0] / reference[1]);
+
+		proc::gnrc::detectionGraph(graph, result.referencePoints, topReferenceRects, bottomReferenceRects, pyramid, hsv, session, frame, plan, aspects);
+
+		graph.add("workOrder", [&] {
+			detected = aux::Recording::now();
+			proc::gnrc::undistortPoints(pinholePoints, result.referencePoints, camera.get());
+			proc::asmb::targetPointsVector(session, result.outline, pinholePoints);
+			proc::asmb::workOrderPlacesVector(session, result.overlay, items, result.outline, order, pinholeSize);
+			proc::gnrc::distortPoints(result.outline, camera.get());
+			proc::gnrc::distortPoints(result.overlay, camera.get());
+			drawing = aux::Recording::now();
+			proc::asmb::displayWorkOrder(frame, result.outline, result.overlay, items, order, plan.quality.overlay);
+			drawn = aux::Recording::now();
+		}, { graph.size() - 1 });
+
+		graph.run(pool);
+
+		session.quality().update(result.referencePoints, detected - start, drawn - drawing, aux::Recording::now() - start);
+		session.endFrame();
+	}
+
+	if(recorder)
+	{
+		aux::FrameResult implementation;
+
+		implementation.processed = result.processed;
+		implementation.referencePoints = result.referencePoints;
+		implementation.outline = result.outline;
+
+		for(size_t i = 0; i < items.size(); i++)
+			if(items[i] == current) implementation.overlay.push_back(result.overlay[i]);
+
+		recorder->commit(recorded, aux::Recording::IMPLEMENTATION, order.items[current].component, captureTimestamp, blueFactor, redFactor, implementation);
 	}
+
+	return result.processed;
 }
 
 /**
@@ -250,6 +1237,7 @@ void proc::gnrc::combineMultipleRectangles(std::vector<cv::Rect> & rects)
 /**
 	\brief gnrc member function
 
+	@param[out] session a reference to the aux::Session object to be calibrated
 	@param[out] strings a std::vector of std::vectors containing std::string objects to be filled with retrieved data as function output
 
 	@param[in] mat a constant cv::Mat object containing frame data
@@ -261,20 +1249,19 @@ void proc::gnrc::combineMultipleRectangles(std::vector<cv::Rect> & rects)
 	@param[in] srHeight a constant reference to an int containing the height of a scan rectangle
 	@param[in] configFilePath a constant reference to an std::string containing the path to a configuration file
 
-	Sets the color correction factors as a mean of white balancing and retrieves data from a configuration file needed for calculation and displaying of data
+	Sets the color correction factors as a mean of white balancing and retrieves data from a configuration file needed for calculation and displaying of data.
+	The configuration file is either an xml file or a compiled aux::ModelImage. The retrieved data is published as a new aux::Model,
+	frames being processed meanwhile finish with the previous one. The optional camera model of the xml file or model image replaces the one of the session,
+	a configuration without one is processed as a pinhole camera. An invalid model image leaves the session model, camera model and strings untouched
 
 	@see cnst::NUMBER_SCALAR_VALUES
-	@see proc::gnrc::blueFactor
-	@see proc::gnrc::redFactor
-	@see readf::readFile<T1, T2>
-	@see proc::asmb::board
-	@see proc::wdr::storage
-	@see geo::targetVectorFactors<T>()
-	@see proc::asmb::targetPointsVectors
-	@see proc::wdr::targetPointsVectors
-	@see cnst::INVERSION_FACTOR
-*/
-void proc::gnrc::calibrate(std::vector<std::vector<std::string>> & strings, cv::Mat const & mat, int const & ccvWidth, int const & ccvHeight, int const & srX, int const & srY, int const & srWidth, int const & srHeight, std::string const & configFilePath)
+	@see aux::Session::setColorFactors()
+	@see aux::Session::setCamera()
+	@see readf::readModel()
+	@see readf::readCameraModel()
+	@see proc::gnrc::configure()
+*/
+void proc::gnrc::calibrate(aux::Session & session, std::vector<std::vector<std::string>> & strings, cv::Mat const & mat, int const & ccvWidth, int const & ccvHeight, int const & srX, int const & srY, int const & srWidth, int const & srHeight, std::string const & configFilePath)
 {
 	int xOffset = (ccvWidth - mat.cols) / 2;
 	int yOffset = (ccvHeight - mat.rows) / 2;
@@ -287,43 +1274,58 @@ void proc::gnrc::calibrate(std::vector<std::vector<std::string>> & strings, cv::
 
 	for(int i = 0; i < cnst::NUMBER_SCALAR_VALUES; i++) rgb.val[i] /= (rect.width * rect.height);
 
-	proc::gnrc::blueFactor = rgb.val[1] / rgb.val[2];
-	proc::gnrc::redFactor = rgb.val[1] / rgb.val[0];
+	session.setColorFactors(rgb.val[1] / rgb.val[2], rgb.val[1] / rgb.val[0]);
+
+	std::shared_ptr<aux::Model const> model = readf::readModel(configFilePath);
+
+	if(model)
+	{
+		session.setCamera(readf::readCameraModel(configFilePath));
+		proc::gnrc::configure(session, strings, model);
+	}
+
+	regionRGBA.release();
+}
+
+/**
+	\brief gnrc member function
+
+	@param[out] session a reference to the aux::Session object to be configured
+	@param[out] strings a std::vector of std::vectors containing std::string objects to be filled with the board name, component names, occurrences and polarities as function output
+
+	@param[in] model a constant reference to a std::shared_ptr to the aux::Model to be used by the session
 
-	readf::readFile<double, double>(proc::asmb::board, proc::wdr::storage, configFilePath);
+	Publishes the model as the one used for all following frames of the session and retrieves the data needed for displaying of the work task
 
-	geo::targetVectorFactors<double>(proc::asmb::targetPointsVectors, asmb::board.refDimensions()[0], asmb::board.refDimensions()[1], proc::asmb::board.distRefToCorners());
-	geo::targetVectorFactors<double>(proc::wdr::targetPointsVectors, wdr::storage.refMidDimensions()[0], wdr::storage.refMidDimensions()[1], proc::wdr::storage.distRefsToCorners());
+	@see aux::Session::publish()
+	@see aux::Model
+*/
+void proc::gnrc::configure(aux::Session & session, std::vector<std::vector<std::string>> & strings, std::shared_ptr<aux::Model const> const & model)
+{
+	aux::Board<double> const & board = model->board();
 
-	for(int i = 0; i < proc::wdr::targetPointsVectors.size(); i++)
-		for(int k = 0; k < proc::wdr::targetPointsVectors[i].size(); k++)
-			 proc::wdr::targetPointsVectors[i][k] *= cnst::INVERSION_FACTOR;
+	session.publish(model);
 
-	strings.push_back(vector<string> {proc::asmb::board.name()});
+	strings.push_back(vector<string> {board.name()});
 
 	vector<string> temp, temp2, temp3;
 
-	for(int i = 0; i < proc::asmb::board.components().size(); i++)
+	for(int i = 0; i < board.components().size(); i++)
 	{
-		int num;
-		string str;
+		temp.push_back(board.components()[i].name());
 
-		temp.push_back(proc::asmb::board.components()[i].name());
+		ostringstream occurrences, polarity;
 
-		num = proc::asmb::board.components()[i].occurrences();
-		str = static_cast<ostringstream *>(& (ostringstream() << num))->str();
-		temp2.push_back(str);
+		occurrences << board.components()[i].occurrences();
+		temp2.push_back(occurrences.str());
 
-		num = proc::asmb::board.components()[i].polarity();
-		str = static_cast<ostringstream *>(& (ostringstream() << num))->str();
-		temp3.push_back(str);
+		polarity << board.components()[i].polarity();
+		temp3.push_back(polarity.str());
 	}
 
 	strings.push_back(temp);
 	strings.push_back(temp2);
 	strings.push_back(temp3);
-
-	regionRGBA.release();
 }
 
 /**
@@ -369,26 +1371,26 @@ void proc::gnrc::measuredImageValues(double buf [5], cv::Mat const & frame, cv::
 
 	@param[out] contours a reference to a std::vector of std::vectors containing cv::Point objects to be filled with retrieved data as function output
 
-	@param[in] frame a constant reference to a cv::Mat object containing frame data
+	@param[in] frame a constant reference to a cv::Mat object containing the HSV detection image of proc::gnrc::detectionImage()
 	@param[in] lb a constant reference to a cv::Scalar object depicting the lower bounds of a color interval
 	@param[in] ub a constant reference to a cv::Scalar object depicting the upper bounds of a color interval
 
-	Detects and stores the contours to the data structure based on a color interval bounded by lower and upper values
+	Detects and stores the contours to the data structure based on a color interval bounded by lower and upper values, the contours are in the coordinates of the detection image
 */
 void proc::gnrc::contours(std::vector<std::vector<cv::Point>> & contours, cv::Mat const & frame, cv::Scalar const & lb, cv::Scalar const & ub)
 {
-	cv::Mat mPyrDownMat, mHsvMat, mMask, mDilatedMask;
+	cv::Mat mMask, mDilatedMask;
+
+	ALLOCATION_TRACK(mMask);
+	ALLOCATION_TRACK(mDilatedMask);
 
 	std::vector<cv::Vec4i> mHierarchy;
 
-	cv::pyrDown(frame, mPyrDownMat);
-	cv::pyrDown(mPyrDownMat, mPyrDownMat);
-	cv::cvtColor(mPyrDownMat, mHsvMat, cv::COLOR_RGB2HSV_FULL);
-	cv::inRange(mHsvMat, lb, ub, mMask);
+	cv::inRange(frame, lb, ub, mMask);
 	cv::dilate(mMask, mDilatedMask, cv::Mat());
 	cv::findContours(mDilatedMask, contours, mHierarchy, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
 
-	mPyrDownMat.release(); mHsvMat.release(); mMask.release(); mDilatedMask.release();
+	mMask.release(); mDilatedMask.release();
 }
 
 /**
@@ -417,21 +1419,23 @@ void proc::gnrc::maxArea(double & maxArea, std::vector<std::vector<cv::Point>> &
 
 	@param[in] contours a reference to a std::vector of std::vectors containing cv::Point objects depicting detected contours
 	@param[in] maxArea a constant double variable containing the value of the maximal contour area
+	@param[in] pyramidLevel a constant int containing the number of times the frame of the contours was halved
 
-	Modifies a contour with a multiplying cv::Scalar object if the product of a minimum value and the maxArea variable is less than the contour area of a contour
+	Scales a contour back to the coordinates of the frame if the product of a minimum value and the maxArea variable is less than the contour area of a contour
 
 	@see cnst::MINIMAL_CONTOUR_AREA
-	@see cnst::CONTOUR_MULTIPLIER
 */
-void proc::gnrc::saveContours(std::vector<std::vector<cv::Point>> & outContours, std::vector<std::vector<cv::Point>> & contours, double const maxArea)
+void proc::gnrc::saveContours(std::vector<std::vector<cv::Point>> & outContours, std::vector<std::vector<cv::Point>> & contours, double const maxArea, int const pyramidLevel)
 {
+	cv::Scalar const multiplier(1 << pyramidLevel, 1 << pyramidLevel);
+
 	outContours.clear();
 
 	for(std::vector<std::vector<cv::Point> >::iterator it = contours.begin(); it != contours.end(); ++it)
 	{
 		if(cv::contourArea(*it) > cnst::MINIMAL_CONTOUR_AREA * maxArea)
 		{
-			cv::multiply(*it, cnst::CONTOUR_MULTIPLIER, *it);
+			cv::multiply(*it, multiplier, *it);
 
 			outContours.push_back(*it);
 		}
@@ -468,32 +1472,44 @@ void proc::gnrc::contourRectangle(cv::Rect & rect, std::vector<cv::Point> const
 
 	 @param frame a cv::Mat object holding camera frame data
 
-	 Calculates the correlated color temperature of the whole frame
+	 Calculates the correlated color temperature of the frame from every cnst::CCT_SAMPLE_STEP th pixel of every cnst::CCT_SAMPLE_STEP th row.
+	 The conversion to XYZ is linear, so the mean color is converted instead of every pixel
+
+	 @see cnst::RGB_TO_XYZ
 
-	 @return an int depicting the color temperature in Kelvin
+	 @return an int depicting the color temperature in Kelvin, 0 for a black frame
 */
 int proc::gnrc::correlatedColorTemperature(cv::Mat const & frame)
 {
-	cv::Mat regionXYZ;
+	double rgb[3] = { 0.0, 0.0, 0.0 };
+	double xyz[3] = { 0.0, 0.0, 0.0 };
+
+	for(int i = 0; i < frame.rows; i += cnst::CCT_SAMPLE_STEP)
+	{
+		for(int k = 0; k < frame.cols; k += cnst::CCT_SAMPLE_STEP)
+		{
+			for(int c = 0; c < 3; c++) rgb[c] += frame.data[frame.step * i + frame.channels() * k + c];
+		}
+	}
 
-	cv::cvtColor(frame, regionXYZ, cv::COLOR_RGB2XYZ);
+	for(int r = 0; r < 3; r++)
+		for(int c = 0; c < 3; c++) xyz[r] += cnst::RGB_TO_XYZ[r][c] * rgb[c];
 
-	cv::Scalar colorXYZ = cv::sum(regionXYZ);
+	double const total = xyz[0] + xyz[1] + xyz[2];
 
-	for(int i = 0; i < cnst::NUMBER_SCALAR_VALUES; i++) colorXYZ /= (regionXYZ.cols * regionXYZ.rows);
+	if(!(total > 0.0)) return 0;
 
-	double x = colorXYZ.val[0] / (colorXYZ.val[0] + colorXYZ.val[1] + colorXYZ.val[2]);
-	double y = colorXYZ.val[1] / (colorXYZ.val[0] + colorXYZ.val[1] + colorXYZ.val[2]);
+	double x = xyz[0] / total;
+	double y = xyz[1] / total;
 	double n = (x - 0.3320) / (0.1858 - y);
 
-	regionXYZ.release();
-
 	return (int) ((499 * n * n * n) + (3525 * n * n) + (6823.3 *n) + 5520.33);
 }
 
 /**
 	\brief wdr member function
 
+	@param[in] session a reference to the aux::Session object whose pinned aux::Model contains the storage factors
 	@param[out] corners a reference to a std::vector containing cv::Point objects to be filled with retrieved data as function output
 	@param[in] points a constant reference to a std::vector containing cv::Point objects used as geometric vectors to calculate the target points
 
@@ -501,22 +1517,26 @@ int proc::gnrc::correlatedColorTemperature(cv::Mat const & frame)
 
 	@see cnst::NUMBER_CORNERS
 	@see geo::vectorToPoint()
-	@see proc::wdr::targetPointsVectors
+	@see aux::Model::storageTargetPointsVectors()
 */
-void proc::wdr::cornerPointsVector(std::vector<cv::Point> & corners, std::vector<cv::Point> const & points)
+void proc::wdr::cornerPointsVector(aux::Session & session, std::vector<cv::Point> & corners, std::vector<cv::Point> const & points)
 {
+	TRACE_SCOPE("proc::wdr::cornerPointsVector");
+	ALLOCATION_SCOPE("proc::wdr::cornerPointsVector");
+
 	if(points.size() == cnst::NUMBER_CORNERS)
 	{
-		corners.push_back(geo::vectorToPoint(vector<cv::Point> {points[0], points[1], points[3]}, proc::wdr::targetPointsVectors[0]));
-		corners.push_back(geo::vectorToPoint(vector<cv::Point> {points[1], points[0], points[2]}, proc::wdr::targetPointsVectors[1]));
-		corners.push_back(geo::vectorToPoint(vector<cv::Point> {points[2], points[3], points[1]}, proc::wdr::targetPointsVectors[2]));
-		corners.push_back(geo::vectorToPoint(vector<cv::Point> {points[3], points[2], points[0]}, proc::wdr::targetPointsVectors[3]));
+		corners.push_back(geo::vectorToPoint(vector<cv::Point> {points[0], points[1], points[3]}, session.model().storageTargetPointsVectors()[0]));
+		corners.push_back(geo::vectorToPoint(vector<cv::Point> {points[1], points[0], points[2]}, session.model().storageTargetPointsVectors()[1]));
+		corners.push_back(geo::vectorToPoint(vector<cv::Point> {points[2], points[3], points[1]}, session.model().storageTargetPointsVectors()[2]));
+		corners.push_back(geo::vectorToPoint(vector<cv::Point> {points[3], points[2], points[0]}, session.model().storageTargetPointsVectors()[3]));
 	}
 }
 
 /**
 	\brief wdr member function
 
+	@param[in] session a reference to the aux::Session object whose pinned aux::Model contains the storage
 	@param[out] tp a reference to a std::vector containing cv::Point objects to be filled with retrieved data as first function output
 	@param[out] mp a reference to a std::vector of std::vectors containing cv::Point objects to be filled with retrieved data as second function output
 	@param[out] bp a reference to a std::vector containing cv::Point objects to be filled with retrieved data as third function output
@@ -527,21 +1547,25 @@ void proc::wdr::cornerPointsVector(std::vector<cv::Point> & corners, std::vector
 
 	@see cnst::NUMBER_CORNERS
 	@see proc::wdr::edgePointsVectors()
-	@see proc::wdr::storage
+	@see aux::Model::storage()
 	@see proc::wdr::middlePointsVectorsVectors()
 */
-void proc::wdr::gridPointsVectors(std::vector<cv::Point> & tp, std::vector<std::vector<cv::Point>> & mp, std::vector<cv::Point> & bp, std::vector<cv::Point> const & cp)
+void proc::wdr::gridPointsVectors(aux::Session & session, std::vector<cv::Point> & tp, std::vector<std::vector<cv::Point>> & mp, std::vector<cv::Point> & bp, std::vector<cv::Point> const & cp)
 {
+	TRACE_SCOPE("proc::wdr::gridPointsVectors");
+	ALLOCATION_SCOPE("proc::wdr::gridPointsVectors");
+
 	if(cp.size() == cnst::NUMBER_CORNERS)
 	{
-		proc::wdr::edgePointsVectors(tp, bp, cp, proc::wdr::storage.storageMatrix()[1]);
-		proc::wdr::middlePointsVectorsVectors(mp, tp, bp, cp, proc::wdr::storage.storageMatrix()[0], proc::wdr::storage.storageMatrix()[1]);
+		proc::wdr::edgePointsVectors(session, tp, bp, cp, session.model().storage().storageMatrix()[1]);
+		proc::wdr::middlePointsVectorsVectors(session, mp, tp, bp, cp, session.model().storage().storageMatrix()[0], session.model().storage().storageMatrix()[1]);
 	}
 }
 
 /**
 	\brief wdr member function
 
+	@param[in] session a reference to the aux::Session object whose pinned aux::Model contains the storage
 	@param[out] tp a reference to a std::vector containing cv::Point objects to be filled with retrieved data as first function output
 	@param[out] bp a reference to a std::vector containing cv::Point objects to be filled with retrieved data as second function output
 
@@ -552,9 +1576,9 @@ void proc::wdr::gridPointsVectors(std::vector<cv::Point> & tp, std::vector<std::
 
 	@see geo::vectorToPoint()
 	@see geo::withdrawalGridPointsVectorsFactors<T>()
-	@see proc::wdr::storage
+	@see aux::Model::storage()
 */
-void proc::wdr::edgePointsVectors(std::vector<cv::Point> & tp, std::vector<cv::Point> & bp, std::vector<cv::Point> const & cp, int const c)
+void proc::wdr::edgePointsVectors(aux::Session & session, std::vector<cv::Point> & tp, std::vector<cv::Point> & bp, std::vector<cv::Point> const & cp, int const c)
 {
 	cv::Point p, q;
 
@@ -563,8 +1587,8 @@ void proc::wdr::edgePointsVectors(std::vector<cv::Point> & tp, std::vector<cv::P
 
 	for(int i = 1; i < c; i++)
 	{
-		p = geo::vectorToPoint(vector<cv::Point> {cp[0], cp[1], cp[3]}, geo::withdrawalGridPointsVectorsFactors<double>(proc::wdr::storage, i, 0));
-		q = geo::vectorToPoint(vector<cv::Point> {cp[1], cp[0], cp[2]}, geo::withdrawalGridPointsVectorsFactors<double>(proc::wdr::storage, i, 0));
+		p = geo::vectorToPoint(vector<cv::Point> {cp[0], cp[1], cp[3]}, geo::withdrawalGridPointsVectorsFactors<double>(session.model().storage(), i, 0));
+		q = geo::vectorToPoint(vector<cv::Point> {cp[1], cp[0], cp[2]}, geo::withdrawalGridPointsVectorsFactors<double>(session.model().storage(), i, 0));
 
 		tp.push_back(p);
 		bp.push_back(q);
@@ -577,6 +1601,7 @@ void proc::wdr::edgePointsVectors(std::vector<cv::Point> & tp, std::vector<cv::P
 /**
 	\brief wdr member function
 
+	@param[in] session a reference to the aux::Session object whose pinned aux::Model contains the storage
 	@param[out] mp a reference to a std::vector of std::vectors containing cv::Point objects to be filled with retrieved data as function output
 	@param[out] tp a reference to a std::vector containing cv::Point objects to be filled with retrieved data
 	@param[out] bp a reference to a std::vector containing cv::Point objects to be filled with retrieved data
@@ -589,18 +1614,18 @@ void proc::wdr::edgePointsVectors(std::vector<cv::Point> & tp, std::vector<cv::P
 
 	@see geo::vectorToPoint()
 	@see geo::withdrawalGridPointsVectorsFactors<T>()
-	@see proc::wdr::storage
+	@see aux::Model::storage()
 	@see geo::intersection()
 */
-void proc::wdr::middlePointsVectorsVectors(std::vector<std::vector<cv::Point>> & mp, std::vector<cv::Point> & tp, std::vector<cv::Point> & bp, std::vector<cv::Point> const & cp, int const r, int const c)
+void proc::wdr::middlePointsVectorsVectors(aux::Session & session, std::vector<std::vector<cv::Point>> & mp, std::vector<cv::Point> & tp, std::vector<cv::Point> & bp, std::vector<cv::Point> const & cp, int const r, int const c)
 {
 	for(int i = 1; i < r; i++)
 	{
 		cv::Point u, v;
 		vector<cv::Point> me;
 
-		u = geo::vectorToPoint(vector<cv::Point> {cp[1], cp[0], cp[2]}, geo::withdrawalGridPointsVectorsFactors<double>(proc::wdr::storage, 0, i));
-		v = geo::vectorToPoint(vector<cv::Point> {cp[2], cp[3], cp[1]}, geo::withdrawalGridPointsVectorsFactors<double>(proc::wdr::storage, 0, i));
+		u = geo::vectorToPoint(vector<cv::Point> {cp[1], cp[0], cp[2]}, geo::withdrawalGridPointsVectorsFactors<double>(session.model().storage(), 0, i));
+		v = geo::vectorToPoint(vector<cv::Point> {cp[2], cp[3], cp[1]}, geo::withdrawalGridPointsVectorsFactors<double>(session.model().storage(), 0, i));
 
 		me.push_back(u);
 
@@ -616,6 +1641,7 @@ void proc::wdr::middlePointsVectorsVectors(std::vector<std::vector<cv::Point>> &
 /**
 	\brief wdr member function
 
+	@param[in] session a reference to the aux::Session object whose pinned aux::Model contains the storage
 	@param[out] b a reference to a std::vector containing aux::Box objects to be filled with retrieved data as function output
 
 	@param[in] tp a reference to a std::vector containing cv::Point objects depicting the top edge points
@@ -626,18 +1652,21 @@ void proc::wdr::middlePointsVectorsVectors(std::vector<std::vector<cv::Point>> &
 	Calculates all boxes in the storage matrixes and stores them in the given data structure
 
 	@see cnst::NUMBER_CORNERS
-	@see proc::wdr::storage
+	@see aux::Model::storage()
 	@see cnst::MINIMUM_NUMBER_BOXES_IN_ROW
 	@see aux::Box
 	@see cnst::MINIMUM_NUMBER_BOXES_IN_COLUMN
 
 */
-void proc::wdr::boxesVector(std::vector<aux::Box> & b, std::vector<cv::Point> & tp, std::vector<std::vector<cv::Point>> & mp, std::vector<cv::Point> & bp, std::vector<cv::Point> const & cp)
+void proc::wdr::boxesVector(aux::Session & session, std::vector<aux::Box> & b, std::vector<cv::Point> & tp, std::vector<std::vector<cv::Point>> & mp, std::vector<cv::Point> & bp, std::vector<cv::Point> const & cp)
 {
+	TRACE_SCOPE("proc::wdr::boxesVector");
+	ALLOCATION_SCOPE("proc::wdr::boxesVector");
+
 	if(cp.size() == cnst::NUMBER_CORNERS)
 	{
-		int const r = proc::wdr::storage.storageMatrix()[0];
-		int const c = proc::wdr::storage.storageMatrix()[1];
+		int const r = session.model().storage().storageMatrix()[0];
+		int const c = session.model().storage().storageMatrix()[1];
 
 		if(r > cnst::MINIMUM_NUMBER_BOXES_IN_ROW)
 		{
@@ -667,16 +1696,20 @@ void proc::wdr::boxesVector(std::vector<aux::Box> & b, std::vector<cv::Point> &
 /**
 	\brief wdr member function
 
+	@param[in] session a reference to the aux::Session object whose pinned aux::Model contains the board
 	@param[out] frame a reference to a cv::Mat object containing frame data to be modified as function output
 	@param[in] b a reference to a std::vector containing aux::Box objects depicting all boxes of a storage matrix
 	@param[in] compNum a constant int variable depicting the number of the box the component is stored in
 	@param[in] cp a constant reference to a std::vector containing cv::Point objects depicting the corner points of the storage matrix
+	@param[in] overlay a constant aux::QualityController::Overlay containing the drawing quality
 
-	Displays all the calculated data
+	Displays all the calculated data. The full quality blends the whole frame and draws anti-aliased lines, the blended quality only blends the area
+	of the storage and draws plain lines, the outline quality only draws plain lines
 
 	@see cnst::NUMBER_CORNERS
 	@see geo::areTargetAnglesSufficient()
-	@see proc::asmb::board
+	@see proc::gnrc::overlayArea()
+	@see aux::Model::board()
 	@see cnst::COLOR_GREEN
 	@see cnst::COLOR_RED
 	@see cnst::WITHDRAWAL_ALPHA
@@ -684,40 +1717,259 @@ void proc::wdr::boxesVector(std::vector<aux::Box> & b, std::vector<cv::Point> &
 	@see cnst::GAMMA
 	@see cnst::HIGHLIGHT_LINE_THICKNESS
 	@see cnst::ANTI_ALIASING
+	@see cnst::HIGHLIGHT_LINE_TYPE
 */
-void proc::wdr::displayWithdrawal(cv::Mat & frame, std::vector<aux::Box> & b, int const compNum, std::vector<cv::Point> const & cp)
+void proc::wdr::displayWithdrawal(aux::Session & session, cv::Mat & frame, std::vector<aux::Box> & b, int const compNum, std::vector<cv::Point> const & cp, aux::QualityController::Overlay const overlay)
 {
+	TRACE_SCOPE("proc::wdr::displayWithdrawal");
+	ALLOCATION_SCOPE("proc::wdr::displayWithdrawal");
+
 	if(cp.size() == cnst::NUMBER_CORNERS)
 	{
 		if(geo::areTargetAnglesSufficient(cp))
 		{
-			cv::Mat mat;
-			frame.copyTo(mat);
+			int const lineType = overlay == aux::QualityController::OVERLAY_FULL ? cnst::ANTI_ALIASING : cnst::HIGHLIGHT_LINE_TYPE;
+			int retrievalIndex = session.model().board().components()[compNum].boxNum() - 1;
+
+			cv::Rect area(0, 0, frame.cols, frame.rows);
 
-			int retrievalIndex = proc::asmb::board.components()[compNum].boxNum() - 1;
+			if(overlay == aux::QualityController::OVERLAY_BLENDED) proc::gnrc::overlayArea(area, cp, frame.size());
 
-			for(int i = 0; i < b.size(); i++)
+			if(overlay != aux::QualityController::OVERLAY_OUTLINE && area.area() > 0)
 			{
-				if(i == retrievalIndex)
+				cv::Mat region(frame, area);
+				cv::Mat mat;
+
+				ALLOCATION_TRACK(mat);
+
+				region.copyTo(mat);
+
+				for(int i = 0; i < b.size(); i++)
 				{
-					cv::fillConvexPoly(frame, b[i].corners(), cnst::COLOR_GREEN);
+					if(i == retrievalIndex)
+					{
+						cv::fillConvexPoly(frame, b[i].corners(), cnst::COLOR_GREEN);
+					}
+					else
+						cv::fillConvexPoly(frame, b[i].corners(), cnst::COLOR_RED);
 				}
-				else
-					cv::fillConvexPoly(frame, b[i].corners(), cnst::COLOR_RED);
-			}
 
-			cv::addWeighted(frame, cnst::WITHDRAWAL_ALPHA, mat, cnst::WITHDRAWAL_BETA, cnst::GAMMA, frame);
+				{
+					PERF_SCOPE("proc::wdr::displayWithdrawal/addWeighted", region.total());
+					cv::addWeighted(region, cnst::WITHDRAWAL_ALPHA, mat, cnst::WITHDRAWAL_BETA, cnst::GAMMA, region);
+				}
 
-			cv::line(frame, cp[0], cp[1], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
-			cv::line(frame, cp[0], cp[3], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
-			cv::line(frame, cp[2], cp[1], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
-			cv::line(frame, cp[2], cp[3], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
-			cv::line(frame, b[retrievalIndex].corners()[0], b[retrievalIndex].corners()[1], cnst::COLOR_GREEN, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
-			cv::line(frame, b[retrievalIndex].corners()[0], b[retrievalIndex].corners()[3], cnst::COLOR_GREEN, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
-			cv::line(frame, b[retrievalIndex].corners()[2], b[retrievalIndex].corners()[1], cnst::COLOR_GREEN, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
-			cv::line(frame, b[retrievalIndex].corners()[2], b[retrievalIndex].corners()[3], cnst::COLOR_GREEN, cnst::HIGHLIGHT_LINE_THICKNESS, cnst::ANTI_ALIASING);
+				mat.release();
+			}
 
-			mat.release();
+			cv::line(frame, cp[0], cp[1], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+			cv::line(frame, cp[0], cp[3], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+			cv::line(frame, cp[2], cp[1], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+			cv::line(frame, cp[2], cp[3], cnst::COLOR_RED, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+			cv::line(frame, b[retrievalIndex].corners()[0], b[retrievalIndex].corners()[1], cnst::COLOR_GREEN, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+			cv::line(frame, b[retrievalIndex].corners()[0], b[retrievalIndex].corners()[3], cnst::COLOR_GREEN, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+			cv::line(frame, b[retrievalIndex].corners()[2], b[retrievalIndex].corners()[1], cnst::COLOR_GREEN, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
+			cv::line(frame, b[retrievalIndex].corners()[2], b[retrievalIndex].corners()[3], cnst::COLOR_GREEN, cnst::HIGHLIGHT_LINE_THICKNESS, lineType);
 		}
 	}
 }
+
+/**
+	\brief wdr member function
+
+	@param[in] session a reference to the aux::Session object of the camera stream
+	@param[out] frame a reference to a cv::Mat object containing frame data to be highlighted as function output
+	@param[in] compNum an constant int containing the number of the box of the active component which has to be withdrawn
+	@param[in] captureTimestamp a constant std::int64_t containing the steady clock time in nanoseconds the frame was captured at, stored with the recorded frame
+	@param[in] pool a reference to the aux::ThreadPool object running the steps of the frame
+	@param[out] result a reference to the aux::FrameResult object to be filled with the reference points, the storage corners and the box corners as function output
+
+	Calculates all data needed for displaying of withdrawal locations and shows them for the given frame.
+	The model of the session is pinned for the whole frame, the frame is left untouched if the session is not calibrated yet.
+	The frame is processed as planned by the quality controller of the session, which is given the measured times afterwards.
+	With a camera model the grid is computed from the undistorted reference points and its points are distorted back before the boxes are formed,
+	the reference points of the result stay the detected ones. The unprocessed frame and the result are recorded if a recorder is attached to the session
+
+	@see aux::Session::beginFrame()
+	@see aux::Session::recorder()
+	@see aux::Session::camera()
+	@see aux::QualityController::plan()
+	@see aux::QualityController::update()
+	@see proc::gnrc::detectionGraph()
+	@see proc::gnrc::undistortPoints()
+	@see proc::gnrc::distortPoints()
+	@see proc::wdr::cornerPointsVector()
+	@see proc::wdr::gridPointsVectors()
+	@see proc::wdr::boxesVector()
+	@see proc::wdr::displayWithdrawal()
+
+	@return true if the frame was processed, false if the session is not calibrated yet
+*/
+bool proc::wdr::processWithdrawal(aux::Session & session, cv::Mat & frame, int const compNum, std::int64_t const captureTimestamp, aux::ThreadPool & pool, aux::FrameResult & result)
+{
+	vector<vector<cv::Point>> middlePoints;
+	vector<cv::Point> topPoints, bottomPoints, pinholePoints;
+	vector<cv::Point> & points = result.referencePoints;
+	vector<cv::Point> & corners = result.outline;
+
+	vector<cv::Rect> topReferenceRects, bottomReferenceRects;
+
+	vector<aux::Box> boxes;
+
+	cv::Mat pyramid, hsv;
+
+	std::shared_ptr<aux::RecordingWriter> recorder = session.recorder();
+	aux::RecordingWriter::Frame recorded;
+
+	double const blueFactor = session.blueFactor();
+	double const redFactor = session.redFactor();
+
+	result.clear();
+
+	if(recorder) recorder->capture(recorded, frame);
+
+	result.processed = session.beginFrame();
+
+	if(result.processed)
+	{
+		ALLOCATION_FRAME_SCOPE("withdrawalFrame");
+
+		aux::TaskGraph graph;
+		aux::QualityController::Plan const plan = session.quality().plan(frame.size());
+
+		std::shared_ptr<aux::CameraModel const> const camera = session.camera(frame.size());
+
+		std::int64_t const start = aux::Recording::now();
+		std::int64_t detected = start, drawing = start, drawn = start;
+
+		std::vector<double> const & reference = session.model().storage().refMidDimensions();
+		std::vector<double> const aspects(1, reference[0] / reference[1]);
+
+		proc::gnrc::detectionGraph(graph, points, topReferenceRects, bottomReferenceRects, pyramid, hsv, session, frame, plan, aspects);
+
+		graph.add("withdrawal", [&] {
+			detected = aux::Recording::now();
+			proc::gnrc::undistortPoints(pinholePoints, points, camera.get());
+			proc::wdr::cornerPointsVector(session, corners, pinholePoints);
+			proc::wdr::gridPointsVectors(session, topPoints, middlePoints, bottomPoints, corners);
+			proc::gnrc::distortPoints(corners, camera.get());
+			proc::gnrc::distortPoints(topPoints, camera.get());
+			proc::gnrc::distortPoints(middlePoints, camera.get());
+			proc::gnrc::distortPoints(bottomPoints, camera.get());
+			proc::wdr::boxesVector(session, boxes, topPoints, middlePoints, bottomPoints, corners);
+			drawing = aux::Recording::now();
+			proc::wdr::displayWithdrawal(session, frame, boxes, compNum, corners, plan.quality.overlay);
+			drawn = aux::Recording::now();
+		}, { graph.size() - 1 });
+
+		graph.run(pool);
+
+		session.quality().update(points, detected - start, drawn - drawing, aux::Recording::now() - start);
+		session.endFrame();
+
+		for(vector<aux::Box>::iterator it = boxes.begin(); it != boxes.end(); ++it)
+			result.overlay.push_back(it->corners());
+	}
+
+	if(recorder) recorder->commit(recorded, aux::Recording::WITHDRAWAL, compNum, captureTimestamp, blueFactor, redFactor, result);
+
+	return result.processed;
+}
+
+/**
+	\brief cmb member function
+
+	@param[in] session a reference to the aux::Session object of the camera stream
+	@param[out] frame a reference to a cv::Mat object containing frame data to be highlighted as function output
+	@param[in] compNum an constant int containing the number of the component which has to be withdrawn and implemented
+	@param[in] pool a reference to the aux::ThreadPool object running the steps of the frame
+	@param[out] withdrawal a reference to the aux::FrameResult object to be filled with the reference points, the storage corners and the box corners as first function output
+	@param[out] implementation a reference to the aux::FrameResult object to be filled with the reference points, the board corners and the assembly locations as second function output
+
+	Calculates and shows the withdrawal and the implementation locations of a component for a frame showing the storage and the board.
+	The frame is color corrected and segmented once, the reference sticker candidates are paired to both objects at once and told apart by the aspect ratio
+	of their reference stickers, then the box of the component and its assembly locations are drawn one after the other. An object which is not found is left out.
+	The model of the session is pinned for the whole frame, the frame is left untouched if the session is not calibrated yet. The frame is processed as planned
+	by the quality controller of the session for both objects, which is given the measured times afterwards. A camera model corrects the lens for both objects
+	like for each of them alone. The frame is not recorded, since a record holds the result of a single action
+
+	@see aux::Session::beginFrame()
+	@see aux::QualityController::plan()
+	@see aux::QualityController::update()
+	@see proc::gnrc::detectionGraph()
+	@see proc::gnrc::assignReferences()
+	@see proc::wdr::processWithdrawal()
+	@see proc::asmb::processImplementation()
+
+	@return true if the frame was processed, false if the session is not calibrated yet
+*/
+bool proc::cmb::processCombined(aux::Session & session, cv::Mat & frame, int const compNum, aux::ThreadPool & pool, aux::FrameResult & withdrawal, aux::FrameResult & implementation)
+{
+	vector<vector<cv::Point>> middlePoints, objects;
+	vector<cv::Point> topPoints, bottomPoints, points, storagePoints, boardPoints;
+
+	vector<cv::Rect> topReferenceRects, bottomReferenceRects;
+
+	vector<aux::Box> boxes;
+
+	cv::Mat pyramid, hsv;
+
+	withdrawal.clear();
+	implementation.clear();
+
+	withdrawal.processed = implementation.processed = session.beginFrame();
+
+	if(withdrawal.processed)
+	{
+		ALLOCATION_FRAME_SCOPE("combinedFrame");
+
+		std::vector<double> const & storageReference = session.model().storage().refMidDimensions();
+		std::vector<double> const & boardReference = session.model().board().refDimensions();
+		std::vector<double> const aspects { storageReference[0] / storageReference[1], boardReference[0] / boardReference[1] };
+
+		aux::TaskGraph graph;
+		aux::QualityController::Plan const plan = session.quality().plan(frame.size(), (int) aspects.size());
+
+		std::shared_ptr<aux::CameraModel const> const camera = session.camera(frame.size());
+		cv::Size const pinholeSize = camera ? camera->size() : frame.size();
+
+		std::int64_t const start = aux::Recording::now();
+		std::int64_t detected = start, drawing = start, drawn = start;
+
+		proc::gnrc::detectionGraph(graph, points, topReferenceRects, bottomReferenceRects, pyramid, hsv, session, frame, plan, aspects);
+
+		graph.add("combined", [&] {
+			detected = aux::Recording::now();
+			proc::gnrc::assignReferences(objects, points, aspects);
+			withdrawal.referencePoints = objects[0];
+			implementation.referencePoints = objects[1];
+			proc::gnrc::undistortPoints(storagePoints, objects[0], camera.get());
+			proc::gnrc::undistortPoints(boardPoints, objects[1], camera.get());
+			proc::wdr::cornerPointsVector(session, withdrawal.outline, storagePoints);
+			proc::wdr::gridPointsVectors(session, topPoints, middlePoints, bottomPoints, withdrawal.outline);
+			proc::gnrc::distortPoints(withdrawal.outline, camera.get());
+			proc::gnrc::distortPoints(topPoints, camera.get());
+			proc::gnrc::distortPoints(middlePoints, camera.get());
+			proc::gnrc::distortPoints(bottomPoints, camera.get());
+			proc::wdr::boxesVector(session, boxes, topPoints, middlePoints, bottomPoints, withdrawal.outline);
+			proc::asmb::targetPointsVector(session, implementation.outline, boardPoints);
+			proc::asmb::insertionPlacesVector(session, implementation.overlay, implementation.outline, compNum, pinholeSize);
+			proc::gnrc::distortPoints(implementation.outline, camera.get());
+			proc::gnrc::distortPoints(implementation.overlay, camera.get());
+			drawing = aux::Recording::now();
+			proc::wdr::displayWithdrawal(session, frame, boxes, compNum, withdrawal.outline, plan.quality.overlay);
+			proc::asmb::displayImplementation(frame, implementation.outline, implementation.overlay, plan.quality.overlay);
+			drawn = aux::Recording::now();
+		}, { graph.size() - 1 });
+
+		graph.run(pool);
+
+		session.quality().update(points, detected - start, drawn - drawing, aux::Recording::now() - start);
+		session.endFrame();
+
+		for(vector<aux::Box>::iterator it = boxes.begin(); it != boxes.end(); ++it)
+			withdrawal.overlay.push_back(it->corners());
+	}
+
+	return withdrawal.processed;
+}
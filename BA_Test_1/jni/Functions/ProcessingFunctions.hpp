@@ -1,6 +1,8 @@
 #ifndef PROCESSINGFUNCTIONS_HPP_
 #define PROCESSINGFUNCTIONS_HPP_
 
+#include <cstdint>
+#include <memory>
 #include <opencv2/core/core.hpp>
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
@@ -9,11 +11,19 @@
 #include "AuxiliaryClasses/Box.hpp"
 #include "Functions/GeometryFunctions.hpp"
 #include "AuxiliaryClasses/Storage.hpp"
+#include "AuxiliaryClasses/Model.hpp"
+#include "AuxiliaryClasses/Session.hpp"
+#include "AuxiliaryClasses/CameraModel.hpp"
+#include "AuxiliaryClasses/TaskGraph.hpp"
+#include "AuxiliaryClasses/ThreadPool.hpp"
+#include "AuxiliaryClasses/FrameResult.hpp"
+#include "AuxiliaryClasses/WorkOrder.hpp"
 
 /**
 	\namespace proc
 
-	the namespace proc contains the function collections needed for image processing and result displaying for both the widthdrawal step and implementation step
+	the namespace proc contains the function collections needed for image processing and result displaying for both the widthdrawal step and implementation step,
+	apart or together
 */
 namespace proc
 {
@@ -25,32 +35,31 @@ namespace proc
 	*/
 	namespace gnrc
 	{
-		/**
-		 	\brief blue color channel correction factor
-
-			This factor is used to correct the blue channel of a pixel by multiplying the initial value with this one
-		*/
-		static double blueFactor;
-
-		/**
-			\brief blue color channel correction factor
-
-			This factor is used to correct the red channel of a pixel by multiplying the initial value with this one
-		*/
-		static double redFactor;
-
-		void correctColors(cv::Mat &);
-		void contourVector(std::vector<std::vector<cv::Point>> &, double &, cv::Mat const &, cv::Scalar const &, cv::Scalar const &);
+		void correctColors(aux::Session &, cv::Mat &);
+		void contourVector(std::vector<std::vector<cv::Point>> &, double &, cv::Mat const &, cv::Scalar const &, cv::Scalar const &, int const);
 		void rectangleVector(std::vector<cv::Rect> &, std::vector<std::vector<cv::Point>> &);
-		void centerPointsVector(std::vector<cv::Point> &, std::vector<cv::Rect> &, std::vector<cv::Rect> &);
+		void centerPointsVector(std::vector<cv::Point> &, std::vector<cv::Rect> &, std::vector<cv::Rect> &, double const);
+		void pairReferences(std::vector<std::vector<cv::Point>> &, std::vector<cv::Rect> const &, std::vector<cv::Rect> const &, std::vector<double> const &, int const);
+		void assignReferences(std::vector<std::vector<cv::Point>> &, std::vector<cv::Point> const &, std::vector<double> const &);
 		void combineMultipleRectangles(std::vector<cv::Rect> &);
-		void calibrate(std::vector<std::vector<std::string>> &, cv::Mat const &, int const &,  int const &,  int const &,  int const &,  int const &,  int const &, std::string const &);
+		void calibrate(aux::Session &, std::vector<std::vector<std::string>> &, cv::Mat const &, int const &,  int const &,  int const &,  int const &,  int const &,  int const &, std::string const &);
+		void configure(aux::Session &, std::vector<std::vector<std::string>> &, std::shared_ptr<aux::Model const> const &);
 		void measuredImageValues(double [5], cv::Mat const &, cv::Rect const &);
 		void contours(std::vector<std::vector<cv::Point>> &, cv::Mat const &, cv::Scalar const &, cv::Scalar const &);
 		void maxArea(double &, std::vector<std::vector<cv::Point>> &);
-		void saveContours(std::vector<std::vector<cv::Point>> &,  std::vector<std::vector<cv::Point>> &, double const);
+		void saveContours(std::vector<std::vector<cv::Point>> &,  std::vector<std::vector<cv::Point>> &, double const, int const);
 		void contourRectangle(cv::Rect &, std::vector<cv::Point> const &);
 		int correlatedColorTemperature(cv::Mat const &);
+		void detectionGraph(aux::TaskGraph &, std::vector<cv::Point> &, std::vector<cv::Rect> &, std::vector<cv::Rect> &, cv::Mat &, cv::Mat &, aux::Session &, cv::Mat &, aux::QualityController::Plan const &, std::vector<double> const &);
+		void detectionImage(cv::Mat &, cv::Mat &, cv::Mat const &, int const);
+		void balanceWhite(aux::Session &, cv::Mat const &);
+		void regionStatistics(aux::Session &, cv::Mat const &, int const, cv::Point const &);
+		bool scanCode(aux::Session &, cv::Mat const &, int const, cv::Point const &, cv::Mat const &);
+		bool scanCode(aux::Session &, cv::Mat const &);
+		void overlayArea(cv::Rect &, std::vector<cv::Point> const &, cv::Size const &);
+		void undistortPoints(std::vector<cv::Point> &, std::vector<cv::Point> const &, aux::CameraModel const *);
+		void distortPoints(std::vector<cv::Point> &, aux::CameraModel const *);
+		void distortPoints(std::vector<std::vector<cv::Point>> &, aux::CameraModel const *);
 	}
 
 	/**
@@ -60,19 +69,13 @@ namespace proc
 	*/
 	namespace asmb
 	{
-		/**
-			\brief the shrinking or stretching factors used to calculate the target points needed for assembly
-		*/
-		static std::vector<std::vector<double>> targetPointsVectors;
-
-		/**
-			\brief the aux::Board object used for all calculations based on board specific values
-		*/
-		static aux::Board<double> board;
-
-		void targetPointsVector(std::vector<cv::Point> &, std::vector<cv::Point> const &);
-		void insertionPlacesVector(std::vector<std::vector<cv::Point>> &, std::vector<cv::Point> const &, int const);
-		void displayImplementation(cv::Mat &, std::vector<cv::Point> const &, std::vector<std::vector<cv::Point>> &);
+		void targetPointsVector(aux::Session &, std::vector<cv::Point> &, std::vector<cv::Point> const &);
+		void insertionPlacesVector(aux::Session &, std::vector<std::vector<cv::Point>> &, std::vector<cv::Point> const &, int const, cv::Size const &);
+		void displayImplementation(cv::Mat &, std::vector<cv::Point> const &, std::vector<std::vector<cv::Point>> &, aux::QualityController::Overlay const);
+		bool processImplementation(aux::Session &, cv::Mat &, int const, std::int64_t const, aux::ThreadPool &, aux::FrameResult &);
+		void workOrderPlacesVector(aux::Session &, std::vector<std::vector<cv::Point>> &, std::vector<int> &, std::vector<cv::Point> const &, aux::WorkOrder const &, cv::Size const &);
+		void displayWorkOrder(cv::Mat &, std::vector<cv::Point> const &, std::vector<std::vector<cv::Point>> const &, std::vector<int> const &, aux::WorkOrder const &, aux::QualityController::Overlay const);
+		bool processWorkOrder(aux::Session &, cv::Mat &, aux::WorkOrder const &, std::int64_t const, aux::ThreadPool &, aux::FrameResult &);
 	}
 
 	/**
@@ -82,22 +85,23 @@ namespace proc
 	*/
 	namespace wdr
 	{
-		/**
-			\brief the shrinking or stretching factors used to calculate the target points needed for withdrawal
-	 	*/
-		static std::vector<std::vector<double>> targetPointsVectors;
+		void cornerPointsVector(aux::Session &, std::vector<cv::Point> &, std::vector<cv::Point> const &);
+		void gridPointsVectors(aux::Session &, std::vector<cv::Point> &, std::vector<std::vector<cv::Point>> &, std::vector<cv::Point> &, std::vector<cv::Point> const &);
+		void edgePointsVectors(aux::Session &, std::vector<cv::Point> &, std::vector<cv::Point> &, std::vector<cv::Point> const &, int const);
+		void middlePointsVectorsVectors(aux::Session &, std::vector<std::vector<cv::Point>> &, std::vector<cv::Point> &, std::vector<cv::Point> &, std::vector<cv::Point> const &, int const, int const);
+		void boxesVector(aux::Session &, std::vector<aux::Box> &, std::vector<cv::Point> &, std::vector<std::vector<cv::Point>> &, std::vector<cv::Point> &, std::vector<cv::Point> const &);
+		void displayWithdrawal(aux::Session &, cv::Mat &, std::vector<aux::Box> &, int const, std::vector<cv::Point> const &, aux::QualityController::Overlay const);
+		bool processWithdrawal(aux::Session &, cv::Mat &, int const, std::int64_t const, aux::ThreadPool &, aux::FrameResult &);
+	}
 
-		/**
-			the aux::Storage object used for all calculations based on storage specific values
-		*/
-		static aux::Storage<double> storage;
+	/**
+		\namespace proc::cmb
 
-		void cornerPointsVector(std::vector<cv::Point> &, std::vector<cv::Point> const &);
-		void gridPointsVectors(std::vector<cv::Point> &, std::vector<std::vector<cv::Point>> &, std::vector<cv::Point> &, std::vector<cv::Point> const &);
-		void edgePointsVectors(std::vector<cv::Point> &, std::vector<cv::Point> &, std::vector<cv::Point> const &, int const);
-		void middlePointsVectorsVectors(std::vector<std::vector<cv::Point>> &, std::vector<cv::Point> &, std::vector<cv::Point> &, std::vector<cv::Point> const &, int const, int const);
-		void boxesVector(std::vector<aux::Box> &, std::vector<cv::Point> &, std::vector<std::vector<cv::Point>> &, std::vector<cv::Point> &, std::vector<cv::Point> const &);
-		void displayWithdrawal(cv::Mat &, std::vector<aux::Box> &, int const, std::vector<cv::Point> const &);
+		the namespace cmb contains the function collection which shows the withdrawal step and implementation step together from one detection
+	*/
+	namespace cmb
+	{
+		bool processCombined(aux::Session &, cv::Mat &, int const, aux::ThreadPool &, aux::FrameResult &, aux::FrameResult &);
 	}
 }
 
@@ -0,0 +1,89 @@
+#include "Functions/ProcessingFunctions.hpp"
+#include "JNI_Functions/JNI_Functions.hpp"
+
+using namespace std;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/**
+		\brief Java Native Interface function called from Java which switches the QR code search of a camera stream on or off
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
+		@param enabled a jboolean variable containing whether the following frames are searched for QR codes
+
+		@see aux::Session::scanCodes()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.setCodeScanning()
+	*/
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setCodeScanningNative(JNIEnv * env, jobject jo, jlong sessionAddress, jboolean enabled)
+	{
+		aux::Session & session = *(aux::Session *) sessionAddress;
+
+		session.scanCodes(enabled == JNI_TRUE);
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which searches a frame which is not processed by an action for a QR code
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
+		@param frameAddress a jlong variable containing the memory address of a cv::Mat object containing frame data which is generated by Java via the camera
+
+		Frames processed by an action are searched by the action itself, so a frame is offered exactly once. The frame is only searched if it is due,
+		a decoded code is published to the session
+
+		@see aux::Session::codeScanDue()
+		@see proc::gnrc::scanCode()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.scanCode()
+
+		@return a jboolean containing true if a code was decoded, false otherwise
+	*/
+	JNIEXPORT jboolean JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_scanCodeNative(JNIEnv * env, jobject jo, jlong sessionAddress, jlong frameAddress)
+	{
+		aux::Session & session = *(aux::Session *) sessionAddress;
+		cv::Mat & frame = *(cv::Mat *) frameAddress;
+
+		if(!session.codeScanDue()) return JNI_FALSE;
+
+		return proc::gnrc::scanCode(session, frame) ? JNI_TRUE : JNI_FALSE;
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which takes the last decoded QR code of a camera stream
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
+
+		The bytes of the code are read as ISO-8859-1, since they need not be valid UTF-8
+
+		@see aux::Session::takeCode()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.takeCode()
+
+		@return a jstring containing the code decoded since the last call, empty if there is none
+	*/
+	JNIEXPORT jstring JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_takeCodeNative(JNIEnv * env, jobject jo, jlong sessionAddress)
+	{
+		aux::Session & session = *(aux::Session *) sessionAddress;
+
+		string const code = session.takeCode();
+		vector<jchar> characters(code.size());
+
+		for(size_t i = 0; i < code.size(); i++) characters[i] = (jchar) (unsigned char) code[i];
+
+		return env->NewString(characters.empty() ? 0 : &characters[0], (jsize) characters.size());
+	}
+
+#ifdef __cplusplus
+}
+#endif
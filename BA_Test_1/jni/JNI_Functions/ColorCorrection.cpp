@@ -1,6 +1,7 @@
 #include "Functions/ProcessingFunctions.hpp"
-#include "JNI_FUNCTIONS/JNI_Functions.hpp"
+#include "JNI_Functions/JNI_Functions.hpp"
 #include "Constants.hpp"
+#include "AuxiliaryClasses/ModelCache.hpp"
 
 using namespace std;
 
@@ -12,6 +13,7 @@ extern "C" {
 
 		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
 		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object to be calibrated
 		@param frameAddress a jlong variable containing the memory address of a cv::Mat object containing frame data which is generated by Java via the camera
 		@param ccvWidth a jint containing the width of the camera view in pixels
 		@param ccvHeight a jint containing the height of the camera view in pixels
@@ -31,8 +33,9 @@ extern "C" {
 
 		@return a jobjectArray containing jobjectArrays containing objects with the name of the board, names of the components, number of occurrences and whether they have polarity or not
 	*/
-	JNIEXPORT jobjectArray JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_calibrateNative(JNIEnv * env, jobject jo, jlong frameAddress, jint ccvWidth, jint ccvHeight, jint srX, jint srY, jint srWidth, jint srHeight, jstring filepath)
+	JNIEXPORT jobjectArray JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_calibrateNative(JNIEnv * env, jobject jo, jlong sessionAddress, jlong frameAddress, jint ccvWidth, jint ccvHeight, jint srX, jint srY, jint srWidth, jint srHeight, jstring filepath)
 	{
+		aux::Session & session = *(aux::Session *) sessionAddress;
 		cv::Mat & mat = *(cv::Mat *) frameAddress;
 
 		const char * path = env->GetStringUTFChars(filepath, 0);
@@ -40,7 +43,7 @@ extern "C" {
 		jobjectArray rows;
 		vector<vector<string>> strings;
 
-		proc::gnrc::calibrate(strings, mat, ccvWidth, ccvHeight, srX, srY, srWidth, srHeight, string(path));
+		proc::gnrc::calibrate(session, strings, mat, ccvWidth, ccvHeight, srX, srY, srWidth, srHeight, string(path));
 
 		getUIDisplayalInformation(& rows, strings, env);
 
@@ -49,6 +52,48 @@ extern "C" {
 		return rows;
 	}
 
+	/**
+		\brief Java Native Interface function called from Java which switches a session to a board of the model cache and retrieves the data to be visualized in the ANDROID UI
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object to be switched
+		@param cacheAddress a jlong variable containing the memory address of the aux::ModelCache object
+		@param boardId a jstring variable containing the board id, e.g. the content of the QR code of the board
+
+		Selects the model of the board from the cache without reading its configuration file again if it is resident.
+		The color correction factors of the session are kept
+
+		@see aux::ModelCache::get()
+		@see proc::gnrc::configure()
+		@see getUIDisplayalInformation()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.activateModel()
+
+		@return a jobjectArray like the one of calibrateNative(), empty if the board id is unknown
+	*/
+	JNIEXPORT jobjectArray JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_activateModelNative(JNIEnv * env, jobject jo, jlong sessionAddress, jlong cacheAddress, jstring boardId)
+	{
+		aux::Session & session = *(aux::Session *) sessionAddress;
+		aux::ModelCache & cache = *(aux::ModelCache *) cacheAddress;
+
+		const char * id = env->GetStringUTFChars(boardId, 0);
+
+		jobjectArray rows;
+		vector<vector<string>> strings;
+
+		std::shared_ptr<aux::Model const> model = cache.get(string(id));
+
+		if(model) proc::gnrc::configure(session, strings, model);
+
+		getUIDisplayalInformation(& rows, strings, env);
+
+		env->ReleaseStringUTFChars(boardId, id);
+
+		return rows;
+	}
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,5 +1,7 @@
 #include "Functions/ProcessingFunctions.hpp"
-#include "JNI_FUNCTIONS/JNI_Functions.hpp"
+#include "JNI_Functions/JNI_Functions.hpp"
+
+#include <limits>
 
 using namespace std;
 
@@ -44,6 +46,78 @@ extern "C" {
 		return ret;
 	}
 
+	/**
+		\brief Java Native Interface function called from Java which switches the region statistics of the frames of a camera stream on or off
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
+		@param enabled a jboolean variable containing whether the following frames build region statistics
+
+		@see aux::Session::collectStatistics()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.setRegionStatistics()
+	*/
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setRegionStatisticsNative(JNIEnv * env, jobject jo, jlong sessionAddress, jboolean enabled)
+	{
+		aux::Session & session = *(aux::Session *) sessionAddress;
+
+		session.collectStatistics(enabled == JNI_TRUE);
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which measures regions of the last processed frame of a camera stream
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
+		@param rects a jdoubleArray data structure containing the x and y coordinates as well as the width and height of each region in frame coordinates
+
+		Answers all regions from the region statistics of the last processed frame, so the cost does not depend on the size of the regions.
+		Each region yields the mean of the red, green and blue channel of the color corrected frame followed by their variances, NaN if the region lies outside the
+		searched window or no statistics were built
+
+		@see aux::RegionStatistics::statistics()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.regionStatistics()
+
+		@return a jdoubleArray containing six values per region
+	*/
+	JNIEXPORT jdoubleArray JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_regionStatisticsNative(JNIEnv * env, jobject jo, jlong sessionAddress, jdoubleArray rects)
+	{
+		aux::Session & session = *(aux::Session *) sessionAddress;
+
+		std::shared_ptr<aux::RegionStatistics const> statistics = session.statistics();
+
+		jsize const count = env->GetArrayLength(rects) / 4;
+		jdouble * rectsBody = env->GetDoubleArrayElements(rects, 0);
+
+		vector<double> values(6 * count, std::numeric_limits<double>::quiet_NaN());
+
+		for(jsize i = 0; statistics && i < count; i++)
+		{
+			cv::Scalar mean, variance;
+
+			if(!statistics->statistics(cv::Rect(rectsBody[4 * i], rectsBody[4 * i + 1], rectsBody[4 * i + 2], rectsBody[4 * i + 3]), mean, variance)) continue;
+
+			for(int c = 0; c < 3; c++)
+			{
+				values[6 * i + c] = mean.val[c];
+				values[6 * i + 3 + c] = variance.val[c];
+			}
+		}
+
+		env->ReleaseDoubleArrayElements(rects, rectsBody, JNI_ABORT);
+
+		jdoubleArray ret = env->NewDoubleArray(6 * count);
+
+		if(count > 0) env->SetDoubleArrayRegion(ret, 0, 6 * count, &values[0]);
+
+		return ret;
+	}
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,9 +1,7 @@
 #include "Functions/ProcessingFunctions.hpp"
-#include "Constants.hpp"
-#include "JNI_FUNCTIONS/JNI_Functions.hpp"
-#include "Functions/GeometryFunctions.hpp"
-#include "AuxiliaryClasses/Box.hpp"
-#include <android/log.h>
+#include "JNI_Functions/JNI_Functions.hpp"
+#include "AuxiliaryClasses/ThreadPool.hpp"
+#include "AuxiliaryClasses/Recording.hpp"
 
 using namespace std;
 
@@ -16,53 +14,33 @@ extern "C" {
 
 		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
 		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
 		@param frameAddress a jlong variable containing the memory address of a cv::Mat object containing frame data which is generated by Java via the camera
 		@param componentNumber a jint variable containing the number of the box of the active component which has to be withdrawn
+		@param captureTimestamp a jlong variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a jlong variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
 
-		Calculates all data needed for displaying of withdrawal locations and shows them for the given frame
+		Delegates the frame to the withdrawal pipeline on the shared thread pool and accounts the latency of the result with the session
 
-		@see proc::gnrc::correctColors()
-		@see proc::gnrc::contourVector()
-		@see proc::gnrc::rectangleVector()
-		@see proc::gnrc::centerPointsVector()
-
-		@see proc::wdr::cornerPointsVector()
-		@see proc::wdr::gridPointsVectors()
-		@see proc::wdr::boxesVector()
-		@see proc::wdr::displayWithdrawal()
-		@see cnst::BOTTOM_STICKERS_RED
-		@see cnst::COLOR_RADIUS_BOTTOM
-		@see cnst::TOP_STICKERS_BLUE
-		@see cnst::COLOR_RADIUS_TOP
+		@see proc::wdr::processWithdrawal()
+		@see aux::ThreadPool::shared()
+		@see aux::LatencyMonitor::record()
 
 		@see Java/Android Component Documentation
 		@see de.ur.juergenhahn.ba.Handler.NativeHandler.processWithdrawal
 	*/
-	JNIEXPORT jint JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_processWithdrawalNative(JNIEnv *env, jobject jo, jlong frameAddress, jint componentNumber)
+	JNIEXPORT jint JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_processWithdrawalNative(JNIEnv *env, jobject jo, jlong sessionAddress, jlong frameAddress, jint componentNumber, jlong captureTimestamp, jlong droppedFrames)
 	{
-		int compNum = (int) componentNumber;
-
-		double maxAreaRed = 0.0, maxAreaBlue = 0.0;
+		std::int64_t const entry = aux::Recording::now();
 
-		vector<vector<cv::Point>> contours, middlePoints;
-		vector<cv::Point> points, corners, topPoints, bottomPoints;
+		aux::Session & session = *(aux::Session *) sessionAddress;
+		cv::Mat & frame = *(cv::Mat *) frameAddress;
 
-		vector<cv::Rect> topReferenceRects, bottomReferenceRects;
+		aux::FrameResult result;
 
-		vector<aux::Box> boxes;
+		proc::wdr::processWithdrawal(session, frame, (int) componentNumber, captureTimestamp > 0 ? captureTimestamp : entry, aux::ThreadPool::shared(), result);
 
-		cv::Mat & frame = *(cv::Mat *) frameAddress;
-
-		proc::gnrc::correctColors(frame);
-		proc::gnrc::contourVector(contours, maxAreaRed, frame, cnst::BOTTOM_STICKERS_RED - cnst::COLOR_RADIUS_BOTTOM, cnst::BOTTOM_STICKERS_RED + cnst::COLOR_RADIUS_BOTTOM);
-		proc::gnrc::rectangleVector(topReferenceRects, contours);
-		proc::gnrc::contourVector(contours, maxAreaBlue, frame, cnst::TOP_STICKERS_BLUE - cnst::COLOR_RADIUS_TOP, cnst::TOP_STICKERS_BLUE + cnst::COLOR_RADIUS_TOP);
-		proc::gnrc::rectangleVector(bottomReferenceRects, contours);
-		proc::gnrc::centerPointsVector(points, topReferenceRects, bottomReferenceRects);
-		proc::wdr::cornerPointsVector(corners, points);
-		proc::wdr::gridPointsVectors(topPoints, middlePoints, bottomPoints, corners);
-		proc::wdr::boxesVector(boxes, topPoints, middlePoints, bottomPoints, corners);
-		proc::wdr::displayWithdrawal(frame, boxes, compNum, corners);
+		session.latency().record(captureTimestamp, entry, aux::Recording::now(), droppedFrames);
 
 		return 0;
 	}
@@ -72,49 +50,119 @@ extern "C" {
 
 		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
 		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
 		@param frameAddress a jlong variable containing the memory address of a cv::Mat object containing frame data which is generated by Java via the camera
 		@param componentNumber a jint variable containing the number of the box of the active component which has to be withdrawn
+		@param captureTimestamp a jlong variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a jlong variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
+
+		Delegates the frame to the implementation pipeline on the shared thread pool and accounts the latency of the result with the session
+
+		@see proc::asmb::processImplementation()
+		@see aux::ThreadPool::shared()
+		@see aux::LatencyMonitor::record()
 
-		Calculates all data needed for displayal of implementation locations and shows them for the given frame
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.processImplementation()
+	*/
+	JNIEXPORT jint JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_processImplementationNative(JNIEnv *env, jobject jo, jlong sessionAddress, jlong frameAddress, jint componentNumber, jlong captureTimestamp, jlong droppedFrames)
+	{
+		std::int64_t const entry = aux::Recording::now();
+
+		aux::Session & session = *(aux::Session *) sessionAddress;
+		cv::Mat & frame = *(cv::Mat *) frameAddress;
 
-		@see proc::gnrc::correctColors()
-		@see proc::gnrc::contourVector()
-		@see proc::gnrc::rectangleVector()
-		@see proc::gnrc::centerPointsVector()
+		aux::FrameResult result;
 
-		@see proc::asmb::targetPointsVector()
-		@see proc::asmb::insertionPlacesVector()
-		@see proc::asmb::displayImplementation()
+		proc::asmb::processImplementation(session, frame, (int) componentNumber, captureTimestamp > 0 ? captureTimestamp : entry, aux::ThreadPool::shared(), result);
 
-		@see cnst::BOTTOM_STICKERS_RED
-		@see cnst::COLOR_RADIUS_BOTTOM
-		@see cnst::TOP_STICKERS_BLUE
-		@see cnst::COLOR_RADIUS_TOP
+		session.latency().record(captureTimestamp, entry, aux::Recording::now(), droppedFrames);
+
+		return 0;
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which handles all calculations and visualizing of the data used for the Withdrawal-Action and the Implementation-Action together
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
+		@param frameAddress a jlong variable containing the memory address of a cv::Mat object containing frame data which is generated by Java via the camera
+		@param componentNumber a jint variable containing the number of the component which has to be withdrawn and implemented
+		@param captureTimestamp a jlong variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a jlong variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
+
+		Delegates the frame to the combined pipeline on the shared thread pool, which detects the storage and the board from one pass, and accounts the latency of the result with the session
+
+		@see proc::cmb::processCombined()
+		@see aux::ThreadPool::shared()
+		@see aux::LatencyMonitor::record()
 
 		@see Java/Android Component Documentation
-		@see de.ur.juergenhahn.ba.Handler.NativeHandler.processImplementation()
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.processCombined()
 	*/
-	JNIEXPORT jint JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_processImplementationNative(JNIEnv *env, jobject jo, jlong frameAddress, jint componentNumber)
+	JNIEXPORT jint JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_processCombinedNative(JNIEnv *env, jobject jo, jlong sessionAddress, jlong frameAddress, jint componentNumber, jlong captureTimestamp, jlong droppedFrames)
 	{
-		int compNum = (int) componentNumber;
-		double maxAreaRed = 0.0, maxAreaBlue = 0.0;
+		std::int64_t const entry = aux::Recording::now();
 
-		vector<vector<cv::Point> > contours, assemblyPlaces;
+		aux::Session & session = *(aux::Session *) sessionAddress;
+		cv::Mat & frame = *(cv::Mat *) frameAddress;
+
+		aux::FrameResult withdrawal, implementation;
+
+		proc::cmb::processCombined(session, frame, (int) componentNumber, aux::ThreadPool::shared(), withdrawal, implementation);
+
+		session.latency().record(captureTimestamp, entry, aux::Recording::now(), droppedFrames);
+
+		return 0;
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which handles all calculations and visualizing of the data used for the Implementation-Action of several components at once
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
+		@param frameAddress a jlong variable containing the memory address of a cv::Mat object containing frame data which is generated by Java via the camera
+		@param componentNumbers a jintArray variable containing the numbers of the components to be highlighted
+		@param states a jintArray variable containing the aux::WorkOrder::State of each component, an item of an unknown state is dropped
+		@param captureTimestamp a jlong variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a jlong variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
+
+		Delegates the frame to the work order pipeline on the shared thread pool and accounts the latency of the result with the session.
+		Only as many items as both arrays contain are taken
+
+		@see proc::asmb::processWorkOrder()
+		@see aux::WorkOrder::add()
+		@see aux::ThreadPool::shared()
+		@see aux::LatencyMonitor::record()
 
-		vector<cv::Rect> topReferenceRects, bottomReferenceRects;
-		vector<cv::Point> points, targetPoints;
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.processWorkOrder()
+	*/
+	JNIEXPORT jint JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_processWorkOrderNative(JNIEnv *env, jobject jo, jlong sessionAddress, jlong frameAddress, jintArray componentNumbers, jintArray states, jlong captureTimestamp, jlong droppedFrames)
+	{
+		std::int64_t const entry = aux::Recording::now();
 
+		aux::Session & session = *(aux::Session *) sessionAddress;
 		cv::Mat & frame = *(cv::Mat *) frameAddress;
 
-		proc::gnrc::correctColors(frame);
-		proc::gnrc::contourVector(contours, maxAreaRed, frame, cnst::BOTTOM_STICKERS_RED - cnst::COLOR_RADIUS_BOTTOM, cnst::BOTTOM_STICKERS_RED + cnst::COLOR_RADIUS_BOTTOM);
-		proc::gnrc::rectangleVector(topReferenceRects, contours);
-		proc::gnrc::contourVector(contours, maxAreaBlue, frame, cnst::TOP_STICKERS_BLUE - cnst::COLOR_RADIUS_TOP, cnst::TOP_STICKERS_BLUE + cnst::COLOR_RADIUS_TOP);
-		proc::gnrc::rectangleVector(bottomReferenceRects, contours);
-		proc::gnrc::centerPointsVector(points, topReferenceRects, bottomReferenceRects);
-		proc::asmb::targetPointsVector(targetPoints, points);
-		proc::asmb::insertionPlacesVector(assemblyPlaces, targetPoints, compNum);
-		proc::asmb::displayImplementation(frame, targetPoints, assemblyPlaces);
+		jsize const count = std::min(env->GetArrayLength(componentNumbers), env->GetArrayLength(states));
+		jint * componentsBody = env->GetIntArrayElements(componentNumbers, 0);
+		jint * statesBody = env->GetIntArrayElements(states, 0);
+
+		aux::WorkOrder order;
+
+		for(jsize i = 0; i < count; i++) order.add((int) componentsBody[i], (int) statesBody[i]);
+
+		env->ReleaseIntArrayElements(componentNumbers, componentsBody, JNI_ABORT);
+		env->ReleaseIntArrayElements(states, statesBody, JNI_ABORT);
+
+		aux::FrameResult result;
+
+		proc::asmb::processWorkOrder(session, frame, order, captureTimestamp > 0 ? captureTimestamp : entry, aux::ThreadPool::shared(), result);
+
+		session.latency().record(captureTimestamp, entry, aux::Recording::now(), droppedFrames);
 
 		return 0;
 	}
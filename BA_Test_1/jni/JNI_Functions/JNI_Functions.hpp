@@ -2,16 +2,48 @@
 #define JNI_FUNCTIONS_H_
 
 #include <jni.h>
+#include <vector>
+#include <string>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-	JNIEXPORT jobjectArray JNICALL Java_de_ur_zollner_juergenhahn_ba_Handler_NativeHandler_calibrateNative(JNIEnv *, jobject, jlong, jint, jint, jint, jint, jint, jint, jstring);
-	JNIEXPORT jint JNICALL Java_de_ur_zollner_juergenhahn_ba_Handler_NativeHandler_processImplementationNative(JNIEnv *, jobject, jlong, jint);
-	JNIEXPORT jint JNICALL Java_de_ur_zollner_juergenhahn_ba_Handler_NativeHandler_processWithdrawalNative(JNIEnv *, jobject, jlong, jint);
+	JNIEXPORT jlong JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_createSessionNative(JNIEnv *, jobject);
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_releaseSessionNative(JNIEnv *, jobject, jlong);
+	JNIEXPORT jdoubleArray JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_latencyStatisticsNative(JNIEnv *, jobject, jlong);
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_resetLatencyStatisticsNative(JNIEnv *, jobject, jlong);
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setQualityBudgetNative(JNIEnv *, jobject, jlong, jdouble);
 
-	JNIEXPORT jdoubleArray JNICALL Java_de_ur_zollner_juergenhahn_ba_Handler_NativeHandler_measureImageValuesNative(JNIEnv *, jobject, jlong, jdoubleArray);
+	JNIEXPORT jlong JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_createModelCacheNative(JNIEnv *, jobject, jlong);
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_releaseModelCacheNative(JNIEnv *, jobject, jlong);
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_preloadModelsNative(JNIEnv *, jobject, jlong, jstring);
+
+	JNIEXPORT jobjectArray JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_calibrateNative(JNIEnv *, jobject, jlong, jlong, jint, jint, jint, jint, jint, jint, jstring);
+	JNIEXPORT jobjectArray JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_activateModelNative(JNIEnv *, jobject, jlong, jlong, jstring);
+	JNIEXPORT jint JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_processImplementationNative(JNIEnv *, jobject, jlong, jlong, jint, jlong, jlong);
+	JNIEXPORT jint JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_processWithdrawalNative(JNIEnv *, jobject, jlong, jlong, jint, jlong, jlong);
+	JNIEXPORT jint JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_processCombinedNative(JNIEnv *, jobject, jlong, jlong, jint, jlong, jlong);
+	JNIEXPORT jint JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_processWorkOrderNative(JNIEnv *, jobject, jlong, jlong, jintArray, jintArray, jlong, jlong);
+
+	JNIEXPORT jdoubleArray JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_measureImageValuesNative(JNIEnv *, jobject, jlong, jdoubleArray);
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setRegionStatisticsNative(JNIEnv *, jobject, jlong, jboolean);
+	JNIEXPORT jdoubleArray JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_regionStatisticsNative(JNIEnv *, jobject, jlong, jdoubleArray);
+
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setCodeScanningNative(JNIEnv *, jobject, jlong, jboolean);
+	JNIEXPORT jboolean JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_scanCodeNative(JNIEnv *, jobject, jlong, jlong);
+	JNIEXPORT jstring JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_takeCodeNative(JNIEnv *, jobject, jlong);
+
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setTracingNative(JNIEnv *, jobject, jboolean);
+	JNIEXPORT jboolean JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_exportTraceNative(JNIEnv *, jobject, jstring);
+	JNIEXPORT jstring JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_traceSummaryNative(JNIEnv *, jobject);
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setPerfCountersNative(JNIEnv *, jobject, jboolean);
+	JNIEXPORT jstring JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_perfSummaryNative(JNIEnv *, jobject);
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setAllocationTrackingNative(JNIEnv *, jobject, jboolean);
+	JNIEXPORT jstring JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_allocationSummaryNative(JNIEnv *, jobject);
+
+	JNIEXPORT jboolean JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_startRecordingNative(JNIEnv *, jobject, jlong, jstring, jboolean);
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_stopRecordingNative(JNIEnv *, jobject, jlong);
 
 
 	static jobjectArray row(JNIEnv *, const jsize, const char **);
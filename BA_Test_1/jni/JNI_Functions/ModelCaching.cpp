@@ -0,0 +1,85 @@
+#include "AuxiliaryClasses/ModelCache.hpp"
+#include "Boards/BoardTables.hpp"
+#include "JNI_Functions/JNI_Functions.hpp"
+
+using namespace std;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/**
+		\brief Java Native Interface function called from Java which creates the model cache shared by all sessions
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param budget a jlong variable containing the maximum estimated number of bytes of all resident models
+
+		Registers the models of all compiled in production boards pinned
+
+		@see aux::ModelCache
+		@see boards::BOARD_TABLES
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.createModelCache()
+
+		@return a jlong containing the memory address of the created aux::ModelCache object
+	*/
+	JNIEXPORT jlong JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_createModelCacheNative(JNIEnv * env, jobject jo, jlong budget)
+	{
+		aux::ModelCache * cache = new aux::ModelCache((std::size_t) budget);
+
+		for(aux::BoardTable const * const * table = boards::BOARD_TABLES; *table != nullptr; table++)
+			cache->add((*table)->id, make_shared<aux::Model const>(**table));
+
+		return (jlong) cache;
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which releases the model cache
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param cacheAddress a jlong variable containing the memory address of the aux::ModelCache object to be released
+
+		Stops the background loading and deletes the aux::ModelCache object. Models activated in sessions stay valid
+
+		@see aux::ModelCache
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.releaseModelCache()
+	*/
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_releaseModelCacheNative(JNIEnv * env, jobject jo, jlong cacheAddress)
+	{
+		delete (aux::ModelCache *) cacheAddress;
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which loads a directory of board configurations in the background
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param cacheAddress a jlong variable containing the memory address of the aux::ModelCache object
+		@param directory a jstring variable containing the path of the directory containing the xml files and compiled model images
+
+		Registers the directory and returns immediately, the models are built on a background thread
+
+		@see aux::ModelCache::preload()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.preloadModels()
+	*/
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_preloadModelsNative(JNIEnv * env, jobject jo, jlong cacheAddress, jstring directory)
+	{
+		aux::ModelCache & cache = *(aux::ModelCache *) cacheAddress;
+
+		const char * path = env->GetStringUTFChars(directory, 0);
+
+		cache.preload(string(path));
+
+		env->ReleaseStringUTFChars(directory, path);
+	}
+
+#ifdef __cplusplus
+}
+#endif
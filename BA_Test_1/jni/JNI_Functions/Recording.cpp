@@ -0,0 +1,72 @@
+#include <memory>
+#include "AuxiliaryClasses/Session.hpp"
+#include "AuxiliaryClasses/Recording.hpp"
+#include "JNI_Functions/JNI_Functions.hpp"
+
+using namespace std;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/**
+		\brief Java Native Interface function called from Java which starts recording the frames of a camera stream
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
+		@param filepath a jstring variable containing the path of the recording to be created
+		@param nv21 a jboolean variable containing whether the frames are stored as NV21 (true) or RGBA (false)
+
+		Every following frame is recorded together with its component number and results until stopRecordingNative() is called.
+		A recording running before is replaced
+
+		@see aux::RecordingWriter
+		@see aux::Session::record()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.startRecording()
+
+		@return a jboolean containing true if the recording was created, false otherwise
+	*/
+	JNIEXPORT jboolean JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_startRecordingNative(JNIEnv * env, jobject jo, jlong sessionAddress, jstring filepath, jboolean nv21)
+	{
+		aux::Session & session = *(aux::Session *) sessionAddress;
+
+		const char * path = env->GetStringUTFChars(filepath, 0);
+
+		shared_ptr<aux::RecordingWriter> recorder = make_shared<aux::RecordingWriter>(string(path), nv21 == JNI_TRUE);
+
+		env->ReleaseStringUTFChars(filepath, path);
+
+		if(!recorder->valid()) return JNI_FALSE;
+
+		session.record(recorder);
+
+		return JNI_TRUE;
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which stops recording the frames of a camera stream
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
+
+		Detaches the recorder, the recording is completed and closed once the running frame is committed
+
+		@see aux::Session::record()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.stopRecording()
+	*/
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_stopRecordingNative(JNIEnv * env, jobject jo, jlong sessionAddress)
+	{
+		aux::Session & session = *(aux::Session *) sessionAddress;
+
+		session.record(shared_ptr<aux::RecordingWriter>());
+	}
+
+#ifdef __cplusplus
+}
+#endif
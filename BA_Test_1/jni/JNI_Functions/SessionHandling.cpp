@@ -0,0 +1,138 @@
+#include "AuxiliaryClasses/Session.hpp"
+#include "AuxiliaryClasses/Recording.hpp"
+#include "JNI_Functions/JNI_Functions.hpp"
+
+using namespace std;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/**
+		\brief Java Native Interface function called from Java which creates the processing session of a camera stream
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+
+		Creates an uncalibrated aux::Session object. Each camera stream owns its own session, so several streams can be processed concurrently
+
+		@see aux::Session
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.createSession()
+
+		@return a jlong containing the memory address of the created aux::Session object
+	*/
+	JNIEXPORT jlong JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_createSessionNative(JNIEnv * env, jobject jo)
+	{
+		return (jlong) new aux::Session();
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which releases the processing session of a camera stream
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object to be released
+
+		Deletes the aux::Session object. The session must not be used afterwards
+
+		@see aux::Session
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.releaseSession()
+	*/
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_releaseSessionNative(JNIEnv * env, jobject jo, jlong sessionAddress)
+	{
+		delete (aux::Session *) sessionAddress;
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which reads the latency statistics of a camera stream
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
+
+		Copies the counters and percentiles of the rolling windows, which is cheap enough to be called every frame.
+		The array contains the number of frames and dropped frames in total and in the windows, the seconds the windows cover and the frame rate,
+		followed by the 50th, 90th and 99th percentile and the maximum in milliseconds of the latency, the processing time and the interval between results
+
+		@see aux::LatencyMonitor::statistics()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.latencyStatistics()
+
+		@return a jdoubleArray containing the statistics
+	*/
+	JNIEXPORT jdoubleArray JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_latencyStatisticsNative(JNIEnv * env, jobject jo, jlong sessionAddress)
+	{
+		aux::Session & session = *(aux::Session *) sessionAddress;
+
+		aux::LatencyMonitor::Statistics const s = session.latency().statistics(aux::Recording::now());
+
+		double values[6 + 4 * aux::LatencyMonitor::METRICS] = { (double) s.frames, (double) s.dropped, (double) s.windowFrames, (double) s.windowDropped, s.windowSeconds, s.fps };
+
+		for(int m = 0; m < aux::LatencyMonitor::METRICS; m++)
+		{
+			values[6 + 4 * m] = s.metrics[m].p50;
+			values[7 + 4 * m] = s.metrics[m].p90;
+			values[8 + 4 * m] = s.metrics[m].p99;
+			values[9 + 4 * m] = s.metrics[m].max;
+		}
+
+		jsize const length = sizeof(values) / sizeof(values[0]);
+		jdoubleArray ret = env->NewDoubleArray(length);
+
+		env->SetDoubleArrayRegion(ret, 0, length, values);
+
+		return ret;
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which resets the latency statistics of a camera stream
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
+
+		@see aux::LatencyMonitor::reset()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.resetLatencyStatistics()
+	*/
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_resetLatencyStatisticsNative(JNIEnv * env, jobject jo, jlong sessionAddress)
+	{
+		aux::Session & session = *(aux::Session *) sessionAddress;
+
+		session.latency().reset();
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which sets the processing time budget per frame of a camera stream
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param sessionAddress a jlong variable containing the memory address of the aux::Session object of the camera stream
+		@param budget a jdouble variable containing the milliseconds per frame to be held, 0 to always process at full quality
+
+		Keeps the default bounds of the quality controller and restarts it at full quality
+
+		@see aux::QualityController::configure()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.setQualityBudget()
+	*/
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setQualityBudgetNative(JNIEnv * env, jobject jo, jlong sessionAddress, jdouble budget)
+	{
+		aux::Session & session = *(aux::Session *) sessionAddress;
+
+		aux::QualityController::Bounds bounds = session.quality().bounds();
+
+		bounds.budget = (double) budget;
+		session.quality().configure(bounds);
+	}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,163 @@
+#include <fstream>
+#include "AuxiliaryClasses/Trace.hpp"
+#include "AuxiliaryClasses/PerfCounters.hpp"
+#include "AuxiliaryClasses/AllocationTracker.hpp"
+#include "JNI_Functions/JNI_Functions.hpp"
+
+using namespace std;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/**
+		\brief Java Native Interface function called from Java which enables or disables the recording of the processing stages
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param enabled a jboolean variable containing whether the stages are recorded from now on (true) or not (false)
+
+		Enabling discards all stages recorded before. Nothing is recorded if the library is built without BA_TRACE
+
+		@see aux::Trace::enable()
+		@see aux::Trace::clear()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.setTracing()
+	*/
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setTracingNative(JNIEnv * env, jobject jo, jboolean enabled)
+	{
+		if(enabled) aux::Trace::shared().clear();
+
+		aux::Trace::shared().enable(enabled);
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which writes the recorded stages as Chrome trace event file
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param filepath a jstring variable containing the path of the JSON file to be written
+
+		The file can be opened in chrome://tracing or any other viewer of the trace event format
+
+		@see aux::Trace::chromeTrace()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.exportTrace()
+
+		@return a jboolean containing true if the file was written, false otherwise
+	*/
+	JNIEXPORT jboolean JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_exportTraceNative(JNIEnv * env, jobject jo, jstring filepath)
+	{
+		const char * path = env->GetStringUTFChars(filepath, 0);
+
+		string trace = aux::Trace::shared().chromeTrace();
+		ofstream file(path, ios::trunc);
+
+		env->ReleaseStringUTFChars(filepath, path);
+
+		return (file << trace) ? JNI_TRUE : JNI_FALSE;
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which summarizes the recorded stages
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+
+		@see aux::Trace::summary()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.traceSummary()
+
+		@return a jstring containing a JSON object with the count, mean, 50th, 90th and 99th percentile and maximum duration in milliseconds of each stage
+	*/
+	JNIEXPORT jstring JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_traceSummaryNative(JNIEnv * env, jobject jo)
+	{
+		return env->NewStringUTF(aux::Trace::shared().summary().c_str());
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which enables or disables the hardware performance counters of the processing stages
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param enabled a jboolean variable containing whether the stages are counted from now on (true) or not (false)
+
+		Enabling discards all stages counted before. Nothing is counted if the library is built without BA_PERF or the kernel denies perf_event_open
+
+		@see aux::PerfCounters::enable()
+		@see aux::PerfCounters::clear()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.setPerfCounters()
+	*/
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setPerfCountersNative(JNIEnv * env, jobject jo, jboolean enabled)
+	{
+		if(enabled) aux::PerfCounters::shared().clear();
+
+		aux::PerfCounters::shared().enable(enabled);
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which summarizes the hardware performance counters of the processing stages
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+
+		@see aux::PerfCounters::summary()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.perfSummary()
+
+		@return a jstring containing a JSON object with the mean counter values per run, the instructions per cycle and the bytes per pixel of each stage
+	*/
+	JNIEXPORT jstring JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_perfSummaryNative(JNIEnv * env, jobject jo)
+	{
+		return env->NewStringUTF(aux::PerfCounters::shared().summary().c_str());
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which enables or disables the allocation accounting of the frames and processing stages
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+		@param enabled a jboolean variable containing whether the allocations are recorded from now on (true) or not (false)
+
+		Enabling discards all stages recorded before. Nothing is recorded if the library is built without BA_ALLOC
+
+		@see aux::AllocationTracker::enable()
+		@see aux::AllocationTracker::clear()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.setAllocationTracking()
+	*/
+	JNIEXPORT void JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setAllocationTrackingNative(JNIEnv * env, jobject jo, jboolean enabled)
+	{
+		if(enabled) aux::AllocationTracker::shared().clear();
+
+		aux::AllocationTracker::shared().enable(enabled);
+	}
+
+	/**
+		\brief Java Native Interface function called from Java which summarizes the allocations of the frames and processing stages
+
+		@param env a JNIEnv pointer variable pointing to the Java Native Interface Environment variable
+		@param jo a jobject variable containing an object of the Java Class calling this function
+
+		@see aux::AllocationTracker::summary()
+
+		@see Java/Android Component Documentation
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.allocationSummary()
+
+		@return a jstring containing a JSON object with the allocations, bytes and peak of live bytes per run of each frame type and stage
+	*/
+	JNIEXPORT jstring JNICALL Java_de_ur_juergenhahn_ba_Handler_NativeHandler_allocationSummaryNative(JNIEnv * env, jobject jo)
+	{
+		return env->NewStringUTF(aux::AllocationTracker::shared().summary().c_str());
+	}
+
+#ifdef __cplusplus
+}
+#endif
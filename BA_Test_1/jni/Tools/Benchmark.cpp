@@ -0,0 +1,775 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Functions/ProcessingFunctions.hpp"
+#include "Functions/GeometryFunctions.hpp"
+#include "Functions/MarkerFunctions.hpp"
+#include "Functions/CodeFunctions.hpp"
+#include "Functions/KernelFunctions.hpp"
+#include "AuxiliaryClasses/AllocationTracker.hpp"
+#include "Constants.hpp"
+
+using namespace std;
+
+/**
+	\struct Resolution
+	\brief a synthetic frame size with its name
+*/
+struct Resolution
+{
+	char const * name;
+	int width;
+	int height;
+};
+
+/**
+	\struct Result
+	\brief the measurement of a benchmark for one parameter set
+*/
+struct Result
+{
+	string name;
+	string parameters;
+	long long pixels;
+	long long iterations;
+	double meanNs;
+	double medianNs;
+	double allocations;
+	double bytes;
+};
+
+/**
+	\struct Options
+	\brief the command line options of the benchmark
+*/
+struct Options
+{
+	double minTime;
+	string filter;
+	string output;
+	string budgets;
+	bool verify;
+};
+
+/**
+	a volatile double the results of inline functions are written to, so the compiler cannot drop their calls
+*/
+static volatile double sink;
+
+static Resolution const RESOLUTIONS[] = { { "480p", 640, 480 }, { "720p", 1280, 720 }, { "1080p", 1920, 1080 } };
+static int const BLOB_COUNTS[] = { 4, 16, 64 };
+static int const PLACEMENT_COUNTS[] = { 100, 1000, 10000 };
+static int const STORAGE_GRIDS[] = { 2, 8, 16 };
+static int const VERIFY_SHORT_ROWS = 130;
+static char const * const LAYOUT_NAMES[krnl::LAYOUTS] = { "RGBA8888", "RGB888", "BGR", "NV21" };
+static int const LAYOUT_CHANNELS[krnl::LAYOUTS] = { krnl::LayoutTraits<krnl::RGBA8888>::CHANNELS, krnl::LayoutTraits<krnl::RGB888>::CHANNELS, krnl::LayoutTraits<krnl::BGR>::CHANNELS, krnl::LayoutTraits<krnl::NV21>::CHANNELS };
+
+/**
+	\brief static inline function
+
+	@return a double containing the time of the steady clock in nanoseconds
+*/
+static inline double now()
+{
+	return (double) chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+	\brief static function
+
+	@param[out] results a reference to a std::vector to be extended by the measurement as function output
+	@param[in] options a constant reference to the Options
+	@param[in] name a constant reference to a std::string containing the name of the benchmarked function
+	@param[in] parameters a constant reference to a std::string containing the parameter set as JSON members
+	@param[in] pixels a long long containing the number of pixels processed per run, 0 if the function does not process a frame
+	@param[in] setup a std::function preparing the input of a run outside of the measured time, empty if the function has no mutable input
+	@param[in] run a std::function containing one run of the benchmarked function
+
+	Runs the function until options.minTime seconds and at least five samples are measured. Functions without setup are timed in batches
+	doubling in size up to a millisecond, functions with setup are timed run by run. The allocations of the measured runs only are counted
+	if the benchmark is built with BA_ALLOC, they read 0 otherwise
+*/
+static void measure(vector<Result> & results, Options const & options, string const & name, string const & parameters, long long const pixels, function<void()> const & setup, function<void()> const & run)
+{
+	if(!options.filter.empty() && name.find(options.filter) == string::npos) return;
+
+	vector<double> samples;
+	long long iterations = 0;
+	long long batch = 1;
+	double total = 0.0;
+	double allocations = 0.0;
+	double bytes = 0.0;
+
+	if(setup) setup();
+	run();
+
+	while(total < options.minTime * 1e9 || samples.size() < 5)
+	{
+		if(setup)
+		{
+			setup();
+			batch = 1;
+		}
+
+		aux::AllocationTracker::Counters const before = aux::AllocationTracker::local();
+		double const begin = now();
+
+		for(long long i = 0; i < batch; i++) run();
+
+		double const elapsed = now() - begin;
+		aux::AllocationTracker::Counters const after = aux::AllocationTracker::local();
+
+		samples.push_back(elapsed / batch);
+		iterations += batch;
+		total += elapsed;
+		allocations += (double) (after.count - before.count);
+		bytes += (double) (after.bytes - before.bytes);
+
+		if(!setup && elapsed < 1e6) batch *= 2;
+	}
+
+	sort(samples.begin(), samples.end());
+
+	Result r;
+	r.name = name;
+	r.parameters = parameters;
+	r.pixels = pixels;
+	r.iterations = iterations;
+	r.meanNs = total / iterations;
+	r.medianNs = samples[samples.size() / 2];
+	r.allocations = allocations / iterations;
+	r.bytes = bytes / iterations;
+
+	results.push_back(r);
+
+	fprintf(stderr, "%-40s %-48s %14.1f ns %10.3f ns/px\n", name.c_str(), parameters.c_str(), r.medianNs, pixels > 0 ? r.medianNs / pixels : 0.0);
+}
+
+/**
+	\brief static function
+
+	@param size a constant reference to a cv::Size containing the dimensions of the frame
+	@param blobs an int containing the number of red and blue sticker blobs each
+	@param seed an unsigned containing the seed of the noise and blob placement
+
+	@return a cv::Mat containing an RGBA frame with a noisy gray background and the sticker blobs
+*/
+static cv::Mat syntheticFrame(cv::Size const & size, int const blobs, unsigned const seed)
+{
+	cv::Mat frame(size, CV_8UC4, cv::Scalar(128, 128, 128, 255));
+	cv::RNG rng(seed);
+
+	cv::Mat noise(size, CV_8UC4);
+	rng.fill(noise, cv::RNG::UNIFORM, cv::Scalar::all(0), cv::Scalar::all(32));
+	frame += noise;
+
+	int const side = max(4, size.width / 40);
+
+	for(int i = 0; i < 2 * blobs; i++)
+	{
+		cv::Point p(rng.uniform(0, size.width - side), rng.uniform(0, size.height - side));
+		cv::Scalar color = i % 2 ? cv::Scalar(30, 60, 220, 255) : cv::Scalar(220, 40, 30, 255);
+
+		cv::rectangle(frame, cv::Rect(p.x, p.y, side, side), color, -1);
+	}
+
+	return frame;
+}
+
+/**
+	\brief static function
+
+	@param placements an int containing the number of occurrences of the benchmarked component
+	@param grid an int containing the number of rows and columns of the storage
+
+	@return a std::shared_ptr to an aux::Model of a 300 x 200 board with one component and a grid x grid storage
+*/
+static shared_ptr<aux::Model const> syntheticModel(int const placements, int const grid)
+{
+	cv::RNG rng(placements * 31 + grid);
+	cv::Mat coordinates(placements, 4, CV_64F);
+
+	for(int i = 0; i < placements; i++)
+	{
+		coordinates.at<double>(i, 0) = rng.uniform(5.0, 295.0);
+		coordinates.at<double>(i, 1) = rng.uniform(5.0, 195.0);
+		coordinates.at<double>(i, 2) = 0.0;
+		coordinates.at<double>(i, 3) = 0.0;
+	}
+
+	cv::Mat boardDistances = (cv::Mat_<double>(cnst::NUMBER_CORNERS, 2) << -10, -10, -10, 210, 310, 210, 310, -10);
+	cv::Mat storageDistances = (cv::Mat_<double>(cnst::NUMBER_CORNERS, 2) << -5, -5, -5, 105, 105, 105, 105, -5);
+
+	vector<aux::Component<double>> components { aux::Component<double>("R1", placements, coordinates, 2.0, 1.0, false, 1) };
+
+	aux::Board<double> board("synthetic", components, vector<double> { 0.0, 0.0 }, vector<double> { 10.0, 10.0 }, vector<double> { 300.0, 200.0 }, false, boardDistances);
+	aux::Storage<double> storage(vector<int> { grid, grid }, vector<double> { 100.0, 100.0 }, vector<double> { 110.0, 110.0 }, vector<double> { 1.0, 1.0 }, vector<double> { 100.0 / grid - 1.0, 100.0 / grid - 1.0 }, storageDistances);
+
+	return make_shared<aux::Model const>(board, storage);
+}
+
+/**
+	\brief static function
+
+	@param size a constant reference to a cv::Size containing the dimensions of the frame
+
+	@return a std::vector containing four reference points spanning the center of the frame
+*/
+static vector<cv::Point> referencePoints(cv::Size const & size)
+{
+	return vector<cv::Point> { cv::Point(size.width / 5, size.height / 5), cv::Point(size.width / 5, size.height * 4 / 5), cv::Point(size.width * 4 / 5, size.height * 4 / 5), cv::Point(size.width * 4 / 5, size.height / 5) };
+}
+
+/**
+	\brief static function
+
+	Runs the kernels of every instruction set the host supports on random rows of every layout and compares their bytes with the scalar reference.
+	The rows have every length below VERIFY_SHORT_ROWS, which covers every tail of the vector loops, the width of every resolution and a whole 480p frame.
+	Half of the rows are multiplied with gain factors of the whole fixed point range, so the saturation is checked as well
+
+	@return an int containing the number of kernels which differ from the reference
+*/
+static int verifyKernels()
+{
+	krnl::Kernels const & reference = krnl::kernels(krnl::SCALAR);
+	vector<size_t> lengths;
+	cv::RNG rng(49);
+	int failures = 0;
+
+	for(int i = 0; i < VERIFY_SHORT_ROWS; i++) lengths.push_back((size_t) i);
+	for(size_t r = 0; r < sizeof(RESOLUTIONS) / sizeof(RESOLUTIONS[0]); r++) lengths.push_back((size_t) RESOLUTIONS[r].width);
+
+	lengths.push_back((size_t) RESOLUTIONS[0].width * RESOLUTIONS[0].height);
+
+	for(int isa = krnl::SCALAR + 1; isa < krnl::ISAS; isa++)
+	{
+		if(!krnl::supported((krnl::Isa) isa))
+		{
+			fprintf(stderr, "%-8s not supported\n", krnl::name((krnl::Isa) isa));
+			continue;
+		}
+
+		krnl::Kernels const & kernels = krnl::kernels((krnl::Isa) isa);
+
+		for(int l = 0; l < krnl::LAYOUTS; l++)
+		{
+			bool gainEqual = true, lumaEqual = true;
+
+			for(size_t n = 0; n < lengths.size(); n++)
+			{
+				vector<unsigned char> data(lengths[n] * LAYOUT_CHANNELS[l]), expected(lengths[n]), actual(lengths[n]);
+				unsigned short factors[cnst::NUMBER_SCALAR_VALUES];
+
+				for(size_t i = 0; i < data.size(); i++) data[i] = (unsigned char) rng.uniform(0, cnst::MAXIMUM_COLOR_CHANNEL_VALUE + 1);
+				for(int c = 0; c < cnst::NUMBER_SCALAR_VALUES; c++) factors[c] = (unsigned short) rng.uniform(0, (n % 2 ? cnst::KERNEL_GAIN_MAX : 2 * cnst::KERNEL_GAIN_ONE) + 1);
+
+				reference.luma[l](expected.data(), data.data(), lengths[n]);
+				kernels.luma[l](actual.data(), data.data(), lengths[n]);
+				lumaEqual = lumaEqual && expected == actual;
+
+				if(!reference.gain[l]) continue;
+
+				expected = actual = data;
+				reference.gain[l](expected.data(), lengths[n], factors);
+				kernels.gain[l](actual.data(), lengths[n], factors);
+				gainEqual = gainEqual && expected == actual;
+			}
+
+			failures += !gainEqual + !lumaEqual;
+
+			fprintf(stderr, "%-8s %-8s gain %-8s luma %s\n", krnl::name((krnl::Isa) isa), LAYOUT_NAMES[l], !reference.gain[l] ? "-" : gainEqual ? "equal" : "DIFFERS", lumaEqual ? "equal" : "DIFFERS");
+		}
+	}
+
+	return failures;
+}
+
+/**
+	\brief static function
+
+	@param results a constant reference to a std::vector containing all measurements
+	@param out a reference to a std::ostream the JSON document is written to
+*/
+static void writeJson(vector<Result> const & results, ostream & out)
+{
+	out.precision(6);
+	out << "{\n\"allocationsCounted\":";
+#ifdef BA_ALLOC
+	out << "true";
+#else
+	out << "false";
+#endif
+	out << ",\n\"benchmarks\":[";
+
+	for(size_t i = 0; i < results.size(); i++)
+	{
+		Result const & r = results[i];
+
+		out << (i ? ",\n" : "\n") << "{\"name\":\"" << r.name << "\"," << r.parameters
+			<< ",\"iterations\":" << r.iterations
+			<< ",\"meanNs\":" << r.meanNs
+			<< ",\"medianNs\":" << r.medianNs
+			<< ",\"opsPerSecond\":" << 1e9 / r.medianNs;
+
+		if(r.pixels > 0) out << ",\"nsPerPixel\":" << r.medianNs / r.pixels << ",\"megapixelsPerSecond\":" << r.pixels * 1e3 / r.medianNs;
+
+		out << ",\"allocationsPerOp\":" << r.allocations << ",\"bytesPerOp\":" << r.bytes << "}";
+	}
+
+	out << "\n]\n}\n";
+}
+
+/**
+	\brief static function
+
+	@param path a constant reference to a std::string containing the path of the budget file
+
+	Reads one stage per line as its name, the maximum number of allocations and the maximum number of allocated bytes of a single run,
+	empty lines and lines starting with # are skipped. Every stage whose worst run exceeds its budget is reported
+
+	@see aux::AllocationTracker::exceeds()
+	@return an int containing the number of stages exceeding their budget, 1 if the file cannot be read or the benchmark is built without BA_ALLOC
+*/
+static int checkBudgets(string const & path)
+{
+#ifdef BA_ALLOC
+	ifstream file(path.c_str());
+	string line;
+	int failures = 0;
+
+	if(!file)
+	{
+		fprintf(stderr, "cannot read %s\n", path.c_str());
+		return 1;
+	}
+
+	while(getline(file, line))
+	{
+		istringstream in(line);
+		string name;
+		unsigned long long maxCount;
+		unsigned long long maxBytes;
+
+		if(!(in >> name) || name[0] == '#') continue;
+
+		if(!(in >> maxCount >> maxBytes))
+		{
+			fprintf(stderr, "malformed budget of %s in %s\n", name.c_str(), path.c_str());
+			failures++;
+		}
+		else if(aux::AllocationTracker::shared().exceeds(name, maxCount, maxBytes))
+		{
+			fprintf(stderr, "%s exceeds its budget of %llu allocations and %llu bytes per run\n", name.c_str(), maxCount, maxBytes);
+			failures++;
+		}
+	}
+
+	return failures;
+#else
+	fprintf(stderr, "the budgets of %s need a benchmark built with BA_ALLOC\n", path.c_str());
+	return 1;
+#endif
+}
+
+/**
+	\brief microbenchmark suite of the native processing stages, not part of the shared library
+
+	@param argc an int containing the number of arguments
+	@param argv a char pointer array containing the options --min-time <seconds>, --filter <substring of the function name>, --output <results.json>, --budgets <budgets.txt> and --verify
+
+	Runs every proc::gnrc, proc::asmb, proc::wdr and geo:: function on synthetic frames at 480p, 720p and 1080p with a varying number of sticker blobs,
+	board placements and storage grid sizes and writes median and mean time, throughput, time per pixel and allocations per run as JSON,
+	to stdout if no output file is given. Allocations are counted if built with BA_ALLOC and Functions/AllocationHooks.cpp.
+	The kernels of krnl are measured once per instruction set the host supports. With --verify only the kernels are checked against their scalar reference instead.
+	With --budgets the worst run of every stage listed in the file, e.g. Tools/allocation_budgets.txt, is checked against its allocation budget after the measurements.
+	Built on the host as target benchmark of the CMake project of the jni directory or against the desktop OpenCV with the jni directory as include path, e.g.
+	g++ -std=c++11 -O2 -I. Tools/Benchmark.cpp Functions/ProcessingFunctions.cpp Functions/GeometryFunctions.cpp Functions/MarkerFunctions.cpp Functions/CodeFunctions.cpp Functions/KernelFunctions*.cpp -o benchmark `pkg-config --cflags --libs opencv`
+
+	@return an int containing 0 on success, 1 otherwise, also if a stage exceeds its allocation budget
+*/
+int main(int argc, char ** argv)
+{
+	Options options = { 0.2, "", "", "", false };
+
+	for(int i = 1; i < argc; i++)
+	{
+		if(!strcmp(argv[i], "--min-time") && i + 1 < argc) options.minTime = atof(argv[++i]);
+		else if(!strcmp(argv[i], "--filter") && i + 1 < argc) options.filter = argv[++i];
+		else if(!strcmp(argv[i], "--output") && i + 1 < argc) options.output = argv[++i];
+		else if(!strcmp(argv[i], "--budgets") && i + 1 < argc) options.budgets = argv[++i];
+		else if(!strcmp(argv[i], "--verify")) options.verify = true;
+		else
+		{
+			fprintf(stderr, "usage: %s [--min-time <seconds>] [--filter <name>] [--output <results.json>] [--budgets <budgets.txt>] [--verify]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	if(options.verify) return verifyKernels() ? 1 : 0;
+
+	krnl::Isa const dispatched = krnl::active();
+
+#ifdef BA_ALLOC
+	aux::AllocationTracker::shared().enable(true);
+#endif
+
+	vector<Result> results;
+
+	for(size_t r = 0; r < sizeof(RESOLUTIONS) / sizeof(RESOLUTIONS[0]); r++)
+	{
+		Resolution const & res = RESOLUTIONS[r];
+		cv::Size const size(res.width, res.height);
+		long long const pixels = (long long) res.width * res.height;
+		vector<cv::Point> const points = referencePoints(size);
+
+		for(size_t b = 0; b < sizeof(BLOB_COUNTS) / sizeof(BLOB_COUNTS[0]); b++)
+		{
+			ostringstream p;
+			p << "\"resolution\":\"" << res.name << "\",\"width\":" << res.width << ",\"height\":" << res.height << ",\"blobs\":" << BLOB_COUNTS[b];
+
+			cv::Mat const source = syntheticFrame(size, BLOB_COUNTS[b], (unsigned) (r * 7 + b));
+			cv::Mat frame;
+
+			aux::Session session;
+			session.setColorFactors(1.05, 0.95);
+			session.publish(syntheticModel(PLACEMENT_COUNTS[0], STORAGE_GRIDS[0]));
+			session.beginFrame();
+
+			cv::Mat pyramid, hsv;
+			proc::gnrc::detectionImage(pyramid, hsv, source, cnst::DETECTION_PYRAMID_LEVEL);
+
+			vector<vector<cv::Point>> contours;
+			double maxArea = 0.0;
+			proc::gnrc::contours(contours, hsv, cnst::BOTTOM_STICKERS_RED - cnst::COLOR_RADIUS_BOTTOM, cnst::BOTTOM_STICKERS_RED + cnst::COLOR_RADIUS_BOTTOM);
+
+			measure(results, options, "proc::gnrc::correctColors", p.str(), pixels, [&] { source.copyTo(frame); }, [&] { proc::gnrc::correctColors(session, frame); });
+
+			for(int isa = krnl::SCALAR; isa < krnl::ISAS && b == 0; isa++)
+			{
+				if(!krnl::select((krnl::Isa) isa)) continue;
+
+				ostringstream k;
+				k << p.str() << ",\"isa\":\"" << krnl::name((krnl::Isa) isa) << "\"";
+
+				cv::Mat gray;
+
+				measure(results, options, "krnl::gain", k.str(), pixels, [&] { source.copyTo(frame); }, [&] { krnl::gain(frame, krnl::RGBA8888, cv::Scalar(1.05, 1.0, 0.95, 1.0)); });
+				measure(results, options, "krnl::luma", k.str(), pixels, function<void()>(), [&] { krnl::luma(gray, source, krnl::RGBA8888); });
+			}
+
+			krnl::select(dispatched);
+
+			measure(results, options, "proc::gnrc::detectionImage", p.str(), pixels, function<void()>(), [&] {
+				cv::Mat y, h;
+				proc::gnrc::detectionImage(y, h, source, cnst::DETECTION_PYRAMID_LEVEL);
+			});
+
+			measure(results, options, "proc::gnrc::balanceWhite", p.str(), (long long) pyramid.total(), function<void()>(), [&] { proc::gnrc::balanceWhite(session, pyramid); });
+
+			measure(results, options, "proc::gnrc::correlatedColorTemperature", p.str(), pixels, function<void()>(), [&] { proc::gnrc::correlatedColorTemperature(source); });
+
+			measure(results, options, "proc::gnrc::regionStatistics", p.str(), (long long) pyramid.total(), function<void()>(), [&] {
+				proc::gnrc::regionStatistics(session, pyramid, cnst::DETECTION_PYRAMID_LEVEL, cv::Point(0, 0));
+			});
+
+			aux::RegionStatistics statistics;
+			statistics.build(pyramid, cnst::DETECTION_PYRAMID_LEVEL, cv::Point(0, 0));
+
+			measure(results, options, "aux::RegionStatistics::statistics", p.str(), 0, function<void()>(), [&] {
+				cv::Scalar mean, variance;
+				statistics.statistics(cv::Rect(res.width / 4, res.height / 4, res.width / 2, res.height / 2), mean, variance);
+			});
+
+			measure(results, options, "proc::gnrc::contours", p.str(), (long long) hsv.total(), function<void()>(), [&] {
+				vector<vector<cv::Point>> c;
+				proc::gnrc::contours(c, hsv, cnst::BOTTOM_STICKERS_RED - cnst::COLOR_RADIUS_BOTTOM, cnst::BOTTOM_STICKERS_RED + cnst::COLOR_RADIUS_BOTTOM);
+			});
+
+			measure(results, options, "proc::gnrc::contourVector", p.str(), (long long) hsv.total(), function<void()>(), [&] {
+				vector<vector<cv::Point>> c;
+				double area = 0.0;
+				proc::gnrc::contourVector(c, area, hsv, cnst::BOTTOM_STICKERS_RED - cnst::COLOR_RADIUS_BOTTOM, cnst::BOTTOM_STICKERS_RED + cnst::COLOR_RADIUS_BOTTOM, cnst::DETECTION_PYRAMID_LEVEL);
+			});
+
+			measure(results, options, "proc::gnrc::maxArea", p.str(), 0, function<void()>(), [&] {
+				double area = 0.0;
+				proc::gnrc::maxArea(area, contours);
+			});
+
+			proc::gnrc::maxArea(maxArea, contours);
+
+			vector<vector<cv::Point>> saved;
+			measure(results, options, "proc::gnrc::saveContours", p.str(), 0, [&] { saved.clear(); }, [&] {
+				vector<vector<cv::Point>> c(contours);
+				proc::gnrc::saveContours(saved, c, maxArea, cnst::DETECTION_PYRAMID_LEVEL);
+			});
+
+			vector<vector<cv::Point>> scaled(contours);
+			proc::gnrc::saveContours(saved, scaled, maxArea, cnst::DETECTION_PYRAMID_LEVEL);
+
+			measure(results, options, "proc::gnrc::rectangleVector", p.str(), 0, function<void()>(), [&] {
+				vector<cv::Rect> rects;
+				vector<vector<cv::Point>> c(saved);
+				proc::gnrc::rectangleVector(rects, c);
+			});
+
+			if(!saved.empty())
+			{
+				measure(results, options, "proc::gnrc::contourRectangle", p.str(), 0, function<void()>(), [&] {
+					cv::Rect rect;
+					proc::gnrc::contourRectangle(rect, saved[0]);
+				});
+			}
+
+			vector<cv::Rect> topRects { cv::Rect(points[0], cv::Size(10, 10)), cv::Rect(points[3], cv::Size(10, 10)) };
+			vector<cv::Rect> bottomRects { cv::Rect(points[1], cv::Size(10, 10)), cv::Rect(points[2], cv::Size(10, 10)) };
+
+			std::vector<double> const & reference = session.model().board().refDimensions();
+			double const aspect = reference[0] / reference[1];
+
+			measure(results, options, "proc::gnrc::centerPointsVector", p.str(), 0, function<void()>(), [&] {
+				vector<cv::Point> centers;
+				vector<cv::Rect> t(topRects), u(bottomRects);
+				proc::gnrc::centerPointsVector(centers, t, u, aspect);
+			});
+
+			vector<cv::Rect> bottomCandidates(bottomRects), topCandidates(topRects);
+
+			for(int i = 0; i < cnst::PAIRING_MAX_CANDIDATES - 2; i++)
+			{
+				bottomCandidates.push_back(cv::Rect((res.width * (i + 1)) / cnst::PAIRING_MAX_CANDIDATES, res.height / 8 + i * 7, 8 + i, 8 + i));
+				topCandidates.push_back(cv::Rect((res.width * (i + 1)) / cnst::PAIRING_MAX_CANDIDATES, (res.height * 7) / 8 - i * 5, 12 - i, 12 - i));
+			}
+
+			measure(results, options, "proc::gnrc::pairReferences", p.str(), 0, function<void()>(), [&] {
+				vector<vector<cv::Point>> quads;
+				proc::gnrc::pairReferences(quads, bottomCandidates, topCandidates, vector<double>(1, aspect), 2);
+			});
+
+			std::vector<double> const & storageReference = session.model().storage().refMidDimensions();
+			vector<double> const aspects { storageReference[0] / storageReference[1], aspect };
+			vector<cv::Point> pairs;
+
+			{
+				vector<vector<cv::Point>> quads;
+				proc::gnrc::pairReferences(quads, bottomCandidates, topCandidates, aspects, 2);
+
+				for(vector<vector<cv::Point>>::iterator it = quads.begin(); it != quads.end(); ++it) pairs.insert(pairs.end(), it->begin(), it->end());
+			}
+
+			measure(results, options, "proc::gnrc::assignReferences", p.str(), 0, function<void()>(), [&] {
+				vector<vector<cv::Point>> objects;
+				proc::gnrc::assignReferences(objects, pairs, aspects);
+			});
+
+			cv::Mat markerFrame = source.clone();
+			int const markerSide = std::max(res.height / 12, 6 * cnst::MARKER_CELL_PIXELS << cnst::DETECTION_PYRAMID_LEVEL);
+
+			for(int i = 0; i < cnst::NUMBER_CORNERS; i++)
+			{
+				cv::Rect const area(points[i].x - markerSide / 2, points[i].y - markerSide / 2, markerSide, markerSide);
+
+				cv::rectangle(markerFrame, cv::Rect(area.x - markerSide / 4, area.y - markerSide / 4, area.width + markerSide / 2, area.height + markerSide / 2), cv::Scalar::all(cnst::MAXIMUM_COLOR_CHANNEL_VALUE), -1);
+				mark::drawMarker(markerFrame, i, area);
+			}
+
+			cv::Mat luma;
+			mark::lumaImage(luma, markerFrame, cnst::DETECTION_PYRAMID_LEVEL - 1);
+
+			measure(results, options, "mark::lumaImage", p.str(), pixels, function<void()>(), [&] {
+				cv::Mat l;
+				mark::lumaImage(l, markerFrame, cnst::DETECTION_PYRAMID_LEVEL - 1);
+			});
+
+			measure(results, options, "mark::referencePoints", p.str(), (long long) luma.total(), function<void()>(), [&] {
+				vector<cv::Point> centers;
+				mark::referencePoints(centers, luma, cnst::DETECTION_PYRAMID_LEVEL - 1, cv::Point(0, 0));
+			});
+
+			cv::Mat codeLuma;
+			mark::lumaImage(codeLuma, markerFrame, cnst::CODE_PYRAMID_LEVEL);
+
+			measure(results, options, "qr::finderPatterns", p.str(), (long long) codeLuma.total(), function<void()>(), [&] {
+				vector<cv::Point2f> finders;
+				vector<float> sizes;
+				qr::finderPatterns(finders, sizes, codeLuma);
+			});
+
+			measure(results, options, "proc::gnrc::scanCode", p.str(), pixels, function<void()>(), [&] {
+				proc::gnrc::scanCode(session, markerFrame);
+			});
+
+			measure(results, options, "proc::gnrc::measuredImageValues", p.str(), pixels / 4, function<void()>(), [&] {
+				double values[5];
+				proc::gnrc::measuredImageValues(values, source, cv::Rect(res.width / 4, res.height / 4, res.width / 2, res.height / 2));
+			});
+
+			session.endFrame();
+		}
+
+		for(size_t n = 0; n < sizeof(PLACEMENT_COUNTS) / sizeof(PLACEMENT_COUNTS[0]); n++)
+		{
+			for(size_t g = 0; g < sizeof(STORAGE_GRIDS) / sizeof(STORAGE_GRIDS[0]); g++)
+			{
+				ostringstream p;
+				p << "\"resolution\":\"" << res.name << "\",\"width\":" << res.width << ",\"height\":" << res.height
+					<< ",\"placements\":" << PLACEMENT_COUNTS[n] << ",\"storageGrid\":" << STORAGE_GRIDS[g];
+
+				shared_ptr<aux::Model const> model = syntheticModel(PLACEMENT_COUNTS[n], STORAGE_GRIDS[g]);
+
+				aux::Session session;
+				session.publish(model);
+				session.beginFrame();
+
+				cv::Mat const source = syntheticFrame(size, BLOB_COUNTS[0], (unsigned) (r * 11 + n * 3 + g));
+				cv::Mat frame;
+
+				vector<cv::Point> targetPoints, corners, topPoints, bottomPoints;
+				vector<vector<cv::Point>> assemblyPlaces, middlePoints;
+				vector<aux::Box> boxes;
+
+				proc::asmb::targetPointsVector(session, targetPoints, points);
+				proc::asmb::insertionPlacesVector(session, assemblyPlaces, targetPoints, 0, size);
+				proc::wdr::cornerPointsVector(session, corners, points);
+				proc::wdr::gridPointsVectors(session, topPoints, middlePoints, bottomPoints, corners);
+				proc::wdr::boxesVector(session, boxes, topPoints, middlePoints, bottomPoints, corners);
+
+				measure(results, options, "proc::asmb::targetPointsVector", p.str(), 0, function<void()>(), [&] {
+					vector<cv::Point> t;
+					proc::asmb::targetPointsVector(session, t, points);
+				});
+
+				measure(results, options, "proc::asmb::insertionPlacesVector", p.str(), 0, function<void()>(), [&] {
+					vector<vector<cv::Point>> places;
+					proc::asmb::insertionPlacesVector(session, places, targetPoints, 0, size);
+				});
+
+				measure(results, options, "proc::asmb::displayImplementation", p.str(), pixels, [&] { source.copyTo(frame); }, [&] {
+					proc::asmb::displayImplementation(frame, targetPoints, assemblyPlaces, aux::QualityController::OVERLAY_FULL);
+				});
+
+				measure(results, options, "proc::asmb::displayImplementation/blended", p.str(), pixels, [&] { source.copyTo(frame); }, [&] {
+					proc::asmb::displayImplementation(frame, targetPoints, assemblyPlaces, aux::QualityController::OVERLAY_BLENDED);
+				});
+
+				aux::WorkOrder order;
+				vector<vector<cv::Point>> orderPlaces;
+				vector<int> orderItems;
+
+				order.add(0, aux::WorkOrder::CURRENT);
+				order.add(0, aux::WorkOrder::UPCOMING);
+				order.add(0, aux::WorkOrder::UPCOMING);
+
+				proc::asmb::workOrderPlacesVector(session, orderPlaces, orderItems, targetPoints, order, size);
+
+				measure(results, options, "proc::asmb::workOrderPlacesVector", p.str(), 0, function<void()>(), [&] {
+					vector<vector<cv::Point>> places;
+					vector<int> items;
+					proc::asmb::workOrderPlacesVector(session, places, items, targetPoints, order, size);
+				});
+
+				measure(results, options, "proc::asmb::displayWorkOrder", p.str(), pixels, [&] { source.copyTo(frame); }, [&] {
+					proc::asmb::displayWorkOrder(frame, targetPoints, orderPlaces, orderItems, order, aux::QualityController::OVERLAY_FULL);
+				});
+
+				measure(results, options, "proc::wdr::cornerPointsVector", p.str(), 0, function<void()>(), [&] {
+					vector<cv::Point> c;
+					proc::wdr::cornerPointsVector(session, c, points);
+				});
+
+				measure(results, options, "proc::wdr::gridPointsVectors", p.str(), 0, function<void()>(), [&] {
+					vector<cv::Point> t, u;
+					vector<vector<cv::Point>> m;
+					proc::wdr::gridPointsVectors(session, t, m, u, corners);
+				});
+
+				measure(results, options, "proc::wdr::boxesVector", p.str(), 0, function<void()>(), [&] {
+					vector<aux::Box> bs;
+					vector<cv::Point> t(topPoints), u(bottomPoints);
+					vector<vector<cv::Point>> m(middlePoints);
+					proc::wdr::boxesVector(session, bs, t, m, u, corners);
+				});
+
+				if(!boxes.empty())
+				{
+					measure(results, options, "proc::wdr::displayWithdrawal", p.str(), pixels, [&] { source.copyTo(frame); }, [&] {
+						proc::wdr::displayWithdrawal(session, frame, boxes, 0, corners, aux::QualityController::OVERLAY_FULL);
+					});
+
+					measure(results, options, "proc::wdr::displayWithdrawal/blended", p.str(), pixels, [&] { source.copyTo(frame); }, [&] {
+						proc::wdr::displayWithdrawal(session, frame, boxes, 0, corners, aux::QualityController::OVERLAY_BLENDED);
+					});
+				}
+
+				aux::Board<double> const & board = model->board();
+
+				measure(results, options, "geo::assemblyPointsVector", p.str(), 0, function<void()>(), [&] {
+					vector<vector<cv::Point>> locations;
+					geo::assemblyPointsVector<double>(locations, targetPoints, board, 0);
+				});
+
+				measure(results, options, "geo::assemblyPointsVector/indexed", p.str(), 0, function<void()>(), [&] {
+					vector<vector<cv::Point>> locations;
+					geo::assemblyPointsVector<double>(locations, targetPoints, board, model->placementIndex(), 0, size);
+				});
+
+				measure(results, options, "geo::withdrawalGridPointsVectorsFactors", p.str(), 0, function<void()>(), [&] {
+					for(int c = 0; c < STORAGE_GRIDS[g]; c++) sink = geo::withdrawalGridPointsVectorsFactors<double>(model->storage(), c, c)[0];
+				});
+
+				session.endFrame();
+			}
+		}
+
+		ostringstream p;
+		p << "\"resolution\":\"" << res.name << "\",\"width\":" << res.width << ",\"height\":" << res.height;
+
+		vector<double> const factors { 0.25, 0.75 };
+
+		measure(results, options, "geo::vectorToPoint", p.str(), 0, function<void()>(), [&] { sink = geo::vectorToPoint(points, factors).x; });
+		measure(results, options, "geo::intersection", p.str(), 0, function<void()>(), [&] { sink = geo::intersection(points[0], points[2], points[1], points[3]).x; });
+		measure(results, options, "geo::areTargetAnglesSufficient", p.str(), 0, function<void()>(), [&] { sink = geo::areTargetAnglesSufficient(points); });
+		measure(results, options, "geo::visibleBoardRegion", p.str(), 0, function<void()>(), [&] { sink = geo::visibleBoardRegion(points, 300.0, 200.0, size).width; });
+		measure(results, options, "geo::pixelsPerBoardUnit", p.str(), 0, function<void()>(), [&] { sink = geo::pixelsPerBoardUnit(points, 300.0, 200.0); });
+
+		cv::Matx33d const cameraMatrix(0.8 * size.width, 0.0, 0.5 * size.width, 0.0, 0.8 * size.width, 0.5 * size.height, 0.0, 0.0, 1.0);
+		cv::Vec<double, cnst::CAMERA_DISTORTION_COEFFICIENTS> const distortion(-0.28, 0.09, 0.001, -0.0005, -0.012);
+		aux::CameraModel const camera(cameraMatrix, distortion, size, size);
+		vector<vector<cv::Point>> const overlay(16, points);
+		vector<cv::Point> pinhole;
+		vector<vector<cv::Point>> distorted;
+
+		measure(results, options, "aux::CameraModel", p.str(), 0, function<void()>(), [&] { sink = aux::CameraModel(camera, size).size().width; });
+		measure(results, options, "proc::gnrc::undistortPoints", p.str(), 0, function<void()>(), [&] { proc::gnrc::undistortPoints(pinhole, points, &camera); });
+		measure(results, options, "proc::gnrc::distortPoints", p.str(), 0, [&] { distorted = overlay; }, [&] { proc::gnrc::distortPoints(distorted, &camera); });
+	}
+
+	if(options.output.empty())
+	{
+		writeJson(results, cout);
+	}
+	else
+	{
+		ofstream file(options.output.c_str(), ios::trunc);
+		writeJson(results, file);
+
+		if(!file)
+		{
+			fprintf(stderr, "cannot write %s\n", options.output.c_str());
+			return 1;
+		}
+	}
+
+	if(!options.budgets.empty() && checkBudgets(options.budgets) > 0) return 1;
+
+	return 0;
+}
@@ -0,0 +1,288 @@
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "AuxiliaryClasses/Model.hpp"
+#include "Functions/FileReadingFunctions.hpp"
+
+using namespace std;
+
+/**
+	\brief static inline function
+
+	@param value a constant reference to a std::string
+
+	@return a std::string containing the value as C++ string literal
+*/
+static inline string literal(string const & value)
+{
+	ostringstream out;
+
+	out << '"';
+
+	for(size_t i = 0; i < value.size(); i++)
+	{
+		unsigned char c = value[i];
+
+		if(c == '"' || c == '\\') out << '\\' << c;
+		else if(isprint(c)) out << c;
+		else out << '\\' << oct << setw(3) << setfill('0') << (int) c << dec;
+	}
+
+	out << '"';
+
+	return out.str();
+}
+
+/**
+	\brief static inline function
+
+	@param value a constant reference to a std::string containing a board id
+
+	@return a std::string containing the board id as C++ identifier
+*/
+static inline string identifier(string const & value)
+{
+	string id = "Board_";
+
+	for(size_t i = 0; i < value.size(); i++)
+		id += isalnum((unsigned char) value[i]) ? value[i] : '_';
+
+	return id;
+}
+
+/**
+	\brief static inline function
+
+	@param values a constant pointer to the first of the doubles
+	@param count a size_t containing the number of doubles
+
+	@return a std::string containing the doubles as braced initializer list with full precision
+*/
+static inline string doubles(double const * values, size_t const count)
+{
+	ostringstream out;
+
+	out << setprecision(numeric_limits<double>::max_digits10) << "{ ";
+
+	for(size_t i = 0; i < count; i++)
+		out << (i ? ", " : "") << values[i];
+
+	out << " }";
+
+	return out.str();
+}
+
+/**
+	\brief static inline function
+
+	@param values a constant reference to a std::vector of std::vectors of doubles containing cnst::NUMBER_CORNERS target vector factors
+
+	@return a std::string containing the factors as braced initializer list
+*/
+static inline string factors(vector<vector<double>> const & values)
+{
+	string out = "{ ";
+
+	for(size_t i = 0; i < values.size(); i++)
+		out += (i ? ", " : "") + doubles(values[i].data(), values[i].size());
+
+	return out + " }";
+}
+
+/**
+	\brief static inline function
+
+	@param matrix a constant reference to a cv::Mat of double with 2 columns
+
+	@return a std::string containing the rows of the matrix as braced initializer list
+*/
+static inline string rows(cv::Mat const & matrix)
+{
+	string out = "{ ";
+
+	for(int i = 0; i < matrix.rows; i++)
+	{
+		double row[2] = { matrix.at<double>(i, 0), matrix.at<double>(i, 1) };
+		out += (i ? ", " : "") + doubles(row, 2);
+	}
+
+	return out + " }";
+}
+
+/**
+	\brief offline board table generator, not part of the shared library
+
+	@param argc an int containing the number of arguments
+	@param argv a char pointer array containing the path of the xml configuration file, the board id, the path of the template and the path of the header to be written
+
+	Parses the xml configuration file once, builds the aux::Model including its aux::PlacementIndex and writes all values as constexpr tables
+	into the template Tools/BoardTable.hpp.in. The placeholders @GUARD@, @ID@, @IDENTIFIER@, @SOURCE@ and @DATA@ are replaced.
+	The generated header defines boards::<identifier>::table which is registered in Boards/BoardTables.hpp.
+	Built on the host as target boardtablegenerator of the CMake project of the jni directory or against the desktop OpenCV with the jni directory as include path, e.g.
+	g++ -std=c++11 -O2 -I. Tools/BoardTableGenerator.cpp -o boardtablegenerator `pkg-config --cflags --libs opencv`
+
+	@see readf::readFile<T1, T2>()
+	@see aux::BoardTable
+	@see aux::PlacementIndex::grid()
+
+	@return an int containing 0 on success, 1 otherwise
+*/
+int main(int argc, char ** argv)
+{
+	if(argc != 5)
+	{
+		fprintf(stderr, "usage: %s <configuration.xml> <board id> <BoardTable.hpp.in> <output.hpp>\n", argv[0]);
+		return 1;
+	}
+
+	string const id = argv[2];
+	string const name = identifier(id);
+
+	aux::Board<double> board;
+	aux::Storage<double> storage;
+
+	readf::readFile<double, double>(board, storage, string(argv[1]));
+
+	aux::Model model(board, storage);
+	aux::Board<double> const & b = model.board();
+	aux::Storage<double> const & s = model.storage();
+
+	ostringstream data;
+	ostringstream components;
+	ostringstream grids;
+
+	data << setprecision(numeric_limits<double>::max_digits10);
+
+	for(size_t c = 0; c < b.components().size(); c++)
+	{
+		aux::Component<double> const & component = b.components()[c];
+		aux::PlacementIndex::GridView grid = model.placementIndex().grid((int) c);
+		cv::Mat coordinates = component.coordinates();
+		int const n = component.occurrences();
+		int const cells = grid.columns * grid.rows;
+
+		if(n > 0)
+		{
+			data << "\t\tconstexpr double coordinates" << c << "[" << n << "][4] = {\n";
+
+			for(int i = 0; i < n; i++)
+			{
+				double row[4] = { coordinates.at<double>(i, 0), coordinates.at<double>(i, 1), coordinates.at<double>(i, 2), coordinates.at<double>(i, 3) };
+				data << "\t\t\t" << doubles(row, 4) << (i + 1 < n ? ",\n" : "\n");
+			}
+
+			data << "\t\t};\n\n";
+
+			data << "\t\tconstexpr aux::PlacementIndex::Placement placements" << c << "[" << n << "] = {\n";
+
+			for(int i = 0; i < n; i++)
+			{
+				aux::PlacementIndex::Placement const & p = grid.placements[i];
+				double row[6] = { p.coordX, p.coordY, p.mX, p.mY, p.cornerX, p.cornerY };
+				data << "\t\t\t" << doubles(row, 6) << (i + 1 < n ? ",\n" : "\n");
+			}
+
+			data << "\t\t};\n\n";
+		}
+
+		data << "\t\tconstexpr int cellStart" << c << "[" << cells + 1 << "] = { ";
+
+		for(int i = 0; i <= cells; i++)
+			data << (i ? ", " : "") << grid.cellStart[i];
+
+		data << " };\n\n";
+
+		ostringstream view;
+		view << setprecision(numeric_limits<double>::max_digits10)
+			<< "{ " << grid.columns << ", " << grid.rows << ", " << grid.cellWidth << ", " << grid.cellHeight << ", " << grid.maxCornerX << ", " << grid.maxCornerY
+			<< ", cellStart" << c << ", " << (n > 0 ? "placements" + to_string(c) : string("nullptr")) << " }";
+
+		grids << (c ? ",\n" : "") << "\t\t\t" << view.str();
+
+		components << setprecision(numeric_limits<double>::max_digits10) << (c ? ",\n" : "")
+			<< "\t\t\t{ " << literal(component.name()) << ", " << n << ", " << component.width() << ", " << component.height() << ", "
+			<< (component.polarity() ? "true" : "false") << ", " << component.boxNum() << ", "
+			<< (n > 0 ? "coordinates" + to_string(c) : string("nullptr")) << ", " << view.str() << " }";
+	}
+
+	size_t const count = b.components().size();
+
+	if(count > 0)
+	{
+		data << "\t\tconstexpr aux::PlacementIndex::GridView grids[" << count << "] = {\n" << grids.str() << "\n\t\t};\n\n";
+		data << "\t\tconstexpr aux::BoardTable::Component components[" << count << "] = {\n" << components.str() << "\n\t\t};\n\n";
+	}
+
+	data << "\t\tconstexpr aux::BoardTable table = {\n"
+		<< "\t\t\t" << literal(id) << ",\n"
+		<< "\t\t\t" << literal(b.name()) << ",\n"
+		<< "\t\t\t" << (b.rotated() ? "true" : "false") << ",\n"
+		<< "\t\t\t" << (b.markers() ? "true" : "false") << ",\n"
+		<< "\t\t\t" << doubles(b.originXY().data(), 2) << ",\n"
+		<< "\t\t\t" << doubles(b.refDimensions().data(), 2) << ",\n"
+		<< "\t\t\t" << doubles(b.boardDimensions().data(), 2) << ",\n"
+		<< "\t\t\t" << rows(b.distRefToCorners()) << ",\n"
+		<< "\t\t\t{ " << s.storageMatrix()[0] << ", " << s.storageMatrix()[1] << " },\n"
+		<< "\t\t\t" << doubles(s.refMidDimensions().data(), 2) << ",\n"
+		<< "\t\t\t" << doubles(s.refCornerDimensions().data(), 2) << ",\n"
+		<< "\t\t\t" << doubles(s.boxOffsetXY().data(), 2) << ",\n"
+		<< "\t\t\t" << doubles(s.boxDimensions().data(), 2) << ",\n"
+		<< "\t\t\t" << rows(s.distRefsToCorners()) << ",\n"
+		<< "\t\t\t" << factors(model.boardTargetPointsVectors()) << ",\n"
+		<< "\t\t\t" << factors(model.storageTargetPointsVectors()) << ",\n"
+		<< "\t\t\t" << count << ",\n"
+		<< "\t\t\t" << (count > 0 ? "components" : "nullptr") << ",\n"
+		<< "\t\t\t" << (count > 0 ? "grids" : "nullptr") << "\n"
+		<< "\t\t};";
+
+	string header;
+
+	{
+		ifstream file(argv[3], ios::binary);
+		ostringstream content;
+
+		if(!(content << file.rdbuf()))
+		{
+			fprintf(stderr, "cannot read %s\n", argv[3]);
+			return 1;
+		}
+
+		header = content.str();
+	}
+
+	string body = data.str();
+
+	if(header.find("\r\n") != string::npos)
+		for(size_t pos = body.find('\n'); pos != string::npos; pos = body.find('\n', pos + 2))
+			body.replace(pos, 1, "\r\n");
+
+	string guard = "BOARDS_" + name + "_HPP_";
+
+	for(size_t i = 0; i < guard.size(); i++)
+		guard[i] = toupper((unsigned char) guard[i]);
+
+	string const placeholders[5][2] = { { "@GUARD@", guard }, { "@ID@", id }, { "@IDENTIFIER@", name }, { "@SOURCE@", argv[1] }, { "@DATA@", body } };
+
+	for(int k = 0; k < 5; k++)
+		for(size_t pos = header.find(placeholders[k][0]); pos != string::npos; pos = header.find(placeholders[k][0], pos + placeholders[k][1].size()))
+			header.replace(pos, placeholders[k][0].size(), placeholders[k][1]);
+
+	{
+		ofstream file(argv[4], ios::binary | ios::trunc);
+
+		if(!file.write(header.data(), header.size()))
+		{
+			fprintf(stderr, "cannot write %s\n", argv[4]);
+			return 1;
+		}
+	}
+
+	printf("%s: boards::%s::table, %zu components\n", argv[4], name.c_str(), count);
+
+	return 0;
+}
@@ -0,0 +1,75 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "AuxiliaryClasses/Model.hpp"
+#include "AuxiliaryClasses/ModelImage.hpp"
+#include "Functions/FileReadingFunctions.hpp"
+
+using namespace std;
+
+/**
+	\brief offline model compiler, not part of the shared library
+
+	@param argc an int containing the number of arguments
+	@param argv a char pointer array containing the path of the xml configuration file and the path of the model image to be written
+
+	Parses the xml configuration file once, calculates the derived values and writes them as an aux::ModelImage together with the optional camera model.
+	The written image is mapped, its checksum is verified and it is compared against the xml model before the compiler reports success.
+	Built on the host as target modelcompiler of the CMake project of the jni directory or against the desktop OpenCV with the jni directory as include path, e.g.
+	g++ -std=c++11 -O2 -I. Tools/ModelCompiler.cpp -o modelcompiler `pkg-config --cflags --libs opencv`
+
+	@see readf::readFile<T1, T2>()
+	@see readf::readCameraModel()
+	@see aux::ModelImage::compile()
+
+	@return an int containing 0 on success, 1 otherwise
+*/
+int main(int argc, char ** argv)
+{
+	if(argc != 3)
+	{
+		fprintf(stderr, "usage: %s <configuration.xml> <model.bin>\n", argv[0]);
+		return 1;
+	}
+
+	aux::Board<double> board;
+	aux::Storage<double> storage;
+
+	readf::readFile<double, double>(board, storage, string(argv[1]));
+
+	aux::Model model(board, storage);
+	shared_ptr<aux::CameraModel const> camera = readf::readCameraModel(string(argv[1]));
+
+	vector<unsigned char> image = aux::ModelImage::compile(model.board(), model.storage(), model.boardTargetPointsVectors(), model.storageTargetPointsVectors(), camera.get());
+
+	{
+		ofstream file(argv[2], ios::binary | ios::trunc);
+
+		if(!file.write((char const *) image.data(), image.size()))
+		{
+			fprintf(stderr, "cannot write %s\n", argv[2]);
+			return 1;
+		}
+	}
+
+	if(!aux::ModelImage(string(argv[2])).verify())
+	{
+		fprintf(stderr, "checksum of %s does not match\n", argv[2]);
+		return 1;
+	}
+
+	shared_ptr<aux::Model const> compiled = readf::readModel(string(argv[2]));
+	shared_ptr<aux::CameraModel const> compiledCamera = readf::readCameraModel(string(argv[2]));
+
+	if(!compiled || compiled->board().components().size() != model.board().components().size() || compiled->boardTargetPointsVectors() != model.boardTargetPointsVectors() || compiled->storageTargetPointsVectors() != model.storageTargetPointsVectors() || !compiledCamera != !camera)
+	{
+		fprintf(stderr, "verification of %s failed\n", argv[2]);
+		return 1;
+	}
+
+	printf("%s: %s, %zu components, %s camera model, %zu bytes\n", argv[2], compiled->board().name().c_str(), compiled->board().components().size(), camera ? "with" : "without", image.size());
+
+	return 0;
+}
@@ -0,0 +1,419 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <opencv2/core/core.hpp>
+#include <opencv2/highgui/highgui.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+#include "Functions/ProcessingFunctions.hpp"
+#include "Functions/FileReadingFunctions.hpp"
+#include "AuxiliaryClasses/ThreadPool.hpp"
+#include "AuxiliaryClasses/Trace.hpp"
+#include "AuxiliaryClasses/Recording.hpp"
+
+using namespace std;
+
+/**
+	\struct Options
+	\brief the command line options of the replay
+*/
+struct Options
+{
+	bool withdrawal;
+	int component;
+	unsigned jobs;
+	bool scan;
+	cv::Rect scanRect;
+	string output;
+	string trace;
+	double budget;
+	string model;
+	vector<string> sequences;
+};
+
+/**
+	\struct Result
+	\brief the measurement of one replayed sequence
+*/
+struct Result
+{
+	string sequence;
+	bool opened;
+	bool recording;
+	int frames;
+	int processed;
+	int mismatches;
+	std::uint64_t adjustments;
+	double seconds;
+	vector<double> milliseconds;
+};
+
+/**
+	\brief static function
+
+	@param[out] options a reference to the Options to be filled as function output
+	@param[in] argc an int containing the number of arguments
+	@param[in] argv a char pointer array containing the arguments
+
+	@return true if the arguments are complete and valid, false otherwise
+*/
+static bool parse(Options & options, int argc, char ** argv)
+{
+	options.withdrawal = true;
+	options.component = 0;
+	options.jobs = max(1u, thread::hardware_concurrency());
+	options.scan = false;
+	options.budget = 0.0;
+
+	int i = 1;
+
+	for(; i < argc && !strncmp(argv[i], "--", 2); i++)
+	{
+		if(!strcmp(argv[i], "--action") && i + 1 < argc)
+		{
+			string action = argv[++i];
+
+			if(action != "withdrawal" && action != "implementation") return false;
+
+			options.withdrawal = action == "withdrawal";
+		}
+		else if(!strcmp(argv[i], "--component") && i + 1 < argc) options.component = atoi(argv[++i]);
+		else if(!strcmp(argv[i], "--jobs") && i + 1 < argc) options.jobs = max(1, atoi(argv[++i]));
+		else if(!strcmp(argv[i], "--scan") && i + 4 < argc)
+		{
+			options.scan = true;
+			options.scanRect = cv::Rect(atoi(argv[i + 1]), atoi(argv[i + 2]), atoi(argv[i + 3]), atoi(argv[i + 4]));
+			i += 4;
+		}
+		else if(!strcmp(argv[i], "--output") && i + 1 < argc) options.output = argv[++i];
+		else if(!strcmp(argv[i], "--trace") && i + 1 < argc) options.trace = argv[++i];
+		else if(!strcmp(argv[i], "--budget") && i + 1 < argc) options.budget = atof(argv[++i]);
+		else return false;
+	}
+
+	if(argc - i < 2) return false;
+
+	options.model = argv[i++];
+
+	for(; i < argc; i++) options.sequences.push_back(argv[i]);
+
+	return true;
+}
+
+/**
+	\brief static function
+
+	@param[out] session a reference to the aux::Session whose quality controller is configured
+	@param[in] options a constant reference to the Options containing the budget, 0 to keep the controller disabled
+
+	@see aux::QualityController::configure()
+*/
+static void configureQuality(aux::Session & session, Options const & options)
+{
+	if(options.budget <= 0.0) return;
+
+	aux::QualityController::Bounds bounds = session.quality().bounds();
+
+	bounds.budget = options.budget;
+	session.quality().configure(bounds);
+}
+
+/**
+	\brief static function
+
+	@param[out] result a reference to the Result of the sequence to be filled as function output
+	@param[in] options a constant reference to the Options
+	@param[in] model a constant reference to a std::shared_ptr to the aux::Model shared by all sessions
+	@param[in] index a size_t containing the index of the sequence
+
+	Replays the sequence through its own aux::Session like a camera stream of the app. Each frame is converted to RGBA and processed by the
+	withdrawal or implementation pipeline on the shared thread pool, the time of each frame is measured. The color correction factors are
+	calibrated from the scan rectangle of the first frame if one is given and stay neutral otherwise. The camera model of the configuration file is used
+	in both cases. The highlighted frames are written to
+	the output directory as <index>_<frame>.png if one is given.
+
+	@see proc::gnrc::calibrate()
+	@see proc::gnrc::configure()
+	@see proc::wdr::processWithdrawal()
+	@see proc::asmb::processImplementation()
+*/
+static void replay(Result & result, Options const & options, shared_ptr<aux::Model const> const & model, size_t const index)
+{
+	cv::VideoCapture capture(options.sequences[index]);
+
+	result.sequence = options.sequences[index];
+	result.opened = capture.isOpened();
+	result.recording = false;
+	result.frames = 0;
+	result.processed = 0;
+	result.mismatches = 0;
+	result.adjustments = 0;
+	result.seconds = 0.0;
+
+	if(!result.opened) return;
+
+	aux::Session session;
+	aux::FrameResult frameResult;
+	vector<vector<string>> strings;
+	cv::Mat bgr, rgba;
+
+	configureQuality(session, options);
+
+	chrono::steady_clock::time_point const start = chrono::steady_clock::now();
+
+	while(capture.read(bgr) && !bgr.empty())
+	{
+		cv::cvtColor(bgr, rgba, cv::COLOR_BGR2RGBA);
+
+		if(result.frames == 0)
+		{
+			if(options.scan) proc::gnrc::calibrate(session, strings, rgba, rgba.cols, rgba.rows, options.scanRect.x, options.scanRect.y, options.scanRect.width, options.scanRect.height, options.model);
+			else
+			{
+				session.setCamera(readf::readCameraModel(options.model));
+				proc::gnrc::configure(session, strings, model);
+			}
+		}
+
+		chrono::steady_clock::time_point const begin = chrono::steady_clock::now();
+
+		bool const processed = options.withdrawal
+			? proc::wdr::processWithdrawal(session, rgba, options.component, aux::Recording::now(), aux::ThreadPool::shared(), frameResult)
+			: proc::asmb::processImplementation(session, rgba, options.component, aux::Recording::now(), aux::ThreadPool::shared(), frameResult);
+
+		result.milliseconds.push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count());
+
+		if(processed) result.processed++;
+
+		if(!options.output.empty())
+		{
+			ostringstream path;
+			path << options.output << "/" << index << "_";
+			path.width(6);
+			path.fill('0');
+			path << result.frames << ".png";
+
+			cv::cvtColor(rgba, bgr, cv::COLOR_RGBA2BGR);
+			cv::imwrite(path.str(), bgr);
+		}
+
+		result.frames++;
+	}
+
+	result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	result.adjustments = session.quality().adjustments();
+}
+
+/**
+	\brief static function
+
+	@param[out] result a reference to the Result of the recording to be filled as function output
+	@param[in] options a constant reference to the Options
+	@param[in] model a constant reference to a std::shared_ptr to the aux::Model shared by all sessions
+	@param[in] index a size_t containing the index of the recording
+
+	Replays a recording of aux::RecordingWriter through its own aux::Session with the action, component number and color correction factors
+	recorded for each frame and compares the results with the recorded ones. Frames which were recorded before the session was calibrated are skipped.
+	The frames are read in place from the mapped recording and copied once, since the pipeline modifies them. The camera model of the configuration file
+	has to be the one of the recording device, otherwise the corrected corners and locations do not match
+
+	@see aux::RecordingReader
+	@see aux::FrameResult::operator==()
+*/
+static void replayRecording(Result & result, Options const & options, shared_ptr<aux::Model const> const & model, size_t const index)
+{
+	aux::RecordingReader reader(options.sequences[index]);
+
+	result.sequence = options.sequences[index];
+	result.opened = reader.valid();
+	result.recording = true;
+	result.frames = 0;
+	result.processed = 0;
+	result.mismatches = 0;
+	result.adjustments = 0;
+	result.seconds = 0.0;
+
+	if(!result.opened) return;
+
+	aux::Session session;
+	aux::FrameResult recorded, replayed;
+	vector<vector<string>> strings;
+	cv::Mat rgba;
+
+	session.setCamera(readf::readCameraModel(options.model));
+	proc::gnrc::configure(session, strings, model);
+	configureQuality(session, options);
+
+	chrono::steady_clock::time_point const start = chrono::steady_clock::now();
+
+	for(size_t i = 0; i < reader.size(); i++)
+	{
+		aux::Recording::FrameHeader const & h = reader.header(i);
+
+		result.frames++;
+
+		if(!h.processed) continue;
+
+		reader.decode(rgba, i);
+		reader.result(recorded, i);
+		session.setColorFactors(h.blueFactor, h.redFactor);
+
+		chrono::steady_clock::time_point const begin = chrono::steady_clock::now();
+
+		bool const processed = h.action == aux::Recording::WITHDRAWAL
+			? proc::wdr::processWithdrawal(session, rgba, h.componentNumber, h.timestamp, aux::ThreadPool::shared(), replayed)
+			: proc::asmb::processImplementation(session, rgba, h.componentNumber, h.timestamp, aux::ThreadPool::shared(), replayed);
+
+		result.milliseconds.push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count());
+
+		if(processed) result.processed++;
+		if(!(replayed == recorded)) result.mismatches++;
+	}
+
+	result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	result.adjustments = session.quality().adjustments();
+}
+
+/**
+	\brief static function
+
+	@param milliseconds a std::vector containing the sorted frame times
+	@param p a double containing the percentile between 0 and 1
+
+	@return a double containing the frame time of the percentile, 0 if there are no frames
+*/
+static double percentile(vector<double> const & milliseconds, double const p)
+{
+	if(milliseconds.empty()) return 0.0;
+
+	return milliseconds[min(milliseconds.size() - 1, (size_t) (p * milliseconds.size()))];
+}
+
+/**
+	\brief video replay of the native processing, not part of the shared library
+
+	@param argc an int containing the number of arguments
+	@param argv a char pointer array containing the options, the path of the xml configuration file or model image and the paths of the sequences
+
+	Replays recorded videos or image sequences, e.g. frames/%05d.png, through the withdrawal or implementation pipeline of the native core.
+	Recordings of the app, files ending with cnst::RECORDING_EXTENSION, are replayed with their recorded parameters and verified frame by frame.
+	Every sequence is processed by its own aux::Session, --jobs sequences are processed in parallel and share the model and the thread pool.
+	Options: --action withdrawal|implementation, --component <number>, --jobs <sequences in parallel>, --scan <x> <y> <width> <height>,
+	--output <directory for the highlighted frames>, --trace <chrome trace file, built with BA_TRACE> and --budget <milliseconds per frame the quality controller holds>.
+	A recording replayed with a budget is only reproduced exactly as long as the controller keeps full quality.
+	Writes the frames, processed frames, frames per second and the frame time percentiles of each sequence and of all together as JSON to stdout.
+	Built on the host as target replay of the CMake project of the jni directory.
+
+	@see replay()
+	@see replayRecording()
+
+	@return an int containing 0 if all sequences could be opened and all recordings were reproduced exactly, 1 otherwise
+*/
+int main(int argc, char ** argv)
+{
+	Options options;
+
+	if(!parse(options, argc, argv))
+	{
+		fprintf(stderr, "usage: %s [--action withdrawal|implementation] [--component <number>] [--jobs <number>] [--scan <x> <y> <width> <height>] [--output <directory>] [--trace <trace.json>] [--budget <milliseconds>] <configuration.xml|model image> <sequence>...\n", argv[0]);
+		return 1;
+	}
+
+	shared_ptr<aux::Model const> model = readf::readModel(options.model);
+
+	if(!model)
+	{
+		fprintf(stderr, "cannot read model %s\n", options.model.c_str());
+		return 1;
+	}
+
+#ifdef BA_TRACE
+	if(!options.trace.empty()) aux::Trace::shared().enable(true);
+#endif
+
+	vector<Result> results(options.sequences.size());
+	atomic<size_t> next(0);
+	vector<thread> workers;
+
+	chrono::steady_clock::time_point const start = chrono::steady_clock::now();
+
+	for(unsigned i = 0; i < min<size_t>(options.jobs, options.sequences.size()); i++)
+	{
+		workers.push_back(thread([&] {
+			for(size_t index = next++; index < options.sequences.size(); index = next++)
+			{
+				string const & sequence = options.sequences[index];
+				size_t const length = strlen(cnst::RECORDING_EXTENSION);
+
+				if(sequence.size() > length && sequence.compare(sequence.size() - length, length, cnst::RECORDING_EXTENSION) == 0) replayRecording(results[index], options, model, index);
+				else replay(results[index], options, model, index);
+			}
+		}));
+	}
+
+	for(vector<thread>::iterator it = workers.begin(); it != workers.end(); ++it)
+		it->join();
+
+	double const seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	int frames = 0;
+	int processed = 0;
+	int mismatches = 0;
+	bool opened = true;
+	vector<double> all;
+
+	cout.precision(3);
+	cout << fixed << "{\n\"sequences\":[";
+
+	for(size_t i = 0; i < results.size(); i++)
+	{
+		Result & r = results[i];
+
+		sort(r.milliseconds.begin(), r.milliseconds.end());
+		all.insert(all.end(), r.milliseconds.begin(), r.milliseconds.end());
+
+		frames += r.frames;
+		processed += r.processed;
+		mismatches += r.mismatches;
+		opened = opened && r.opened;
+
+		if(!r.opened) fprintf(stderr, "cannot open %s\n", r.sequence.c_str());
+
+		cout << (i ? ",\n" : "\n") << "{\"sequence\":\"" << r.sequence << "\",\"opened\":" << (r.opened ? "true" : "false")
+			<< ",\"frames\":" << r.frames << ",\"processed\":" << r.processed;
+
+		if(r.recording) cout << ",\"mismatches\":" << r.mismatches;
+		if(options.budget > 0.0) cout << ",\"adjustments\":" << r.adjustments;
+
+		cout << ",\"seconds\":" << r.seconds
+			<< ",\"fps\":" << (r.seconds > 0 ? r.frames / r.seconds : 0.0)
+			<< ",\"p50Ms\":" << percentile(r.milliseconds, 0.5) << ",\"p99Ms\":" << percentile(r.milliseconds, 0.99)
+			<< ",\"maxMs\":" << (r.milliseconds.empty() ? 0.0 : r.milliseconds.back()) << "}";
+	}
+
+	sort(all.begin(), all.end());
+
+	cout << "\n],\n\"total\":{\"jobs\":" << options.jobs << ",\"frames\":" << frames << ",\"processed\":" << processed << ",\"mismatches\":" << mismatches << ",\"seconds\":" << seconds
+		<< ",\"fps\":" << (seconds > 0 ? frames / seconds : 0.0)
+		<< ",\"p50Ms\":" << percentile(all, 0.5) << ",\"p99Ms\":" << percentile(all, 0.99) << "}\n}\n";
+
+#ifdef BA_TRACE
+	if(!options.trace.empty())
+	{
+		ofstream file(options.trace.c_str(), ios::trunc);
+		file << aux::Trace::shared().chromeTrace();
+
+		if(!file) fprintf(stderr, "cannot write %s\n", options.trace.c_str());
+	}
+#endif
+
+	return opened && mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,458 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <opencv2/core/core.hpp>
+#include <opencv2/highgui/highgui.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+#include "Functions/ProcessingFunctions.hpp"
+#include "Functions/FileReadingFunctions.hpp"
+#include "AuxiliaryClasses/ThreadPool.hpp"
+#include "AuxiliaryClasses/FrameResult.hpp"
+#include "Tools/SceneGenerator.hpp"
+
+using namespace std;
+
+/**
+	\struct Options
+	\brief the command line options of the evaluation
+*/
+struct Options
+{
+	aux::SceneGenerator::Parameters scene;
+	int frames;
+	unsigned seed;
+	bool whiteBalance;
+	string output;
+	string model;
+	vector<cv::Size> sizes;
+};
+
+/**
+	\struct Errors
+	\brief the point distances in pixels of one kind of point over all frames of a resolution
+*/
+struct Errors
+{
+	vector<double> pixels;
+};
+
+/**
+	\struct Result
+	\brief the measurement of one resolution
+*/
+struct Result
+{
+	cv::Size size;
+	int frames;
+	int detected;
+	int overlays;
+	int truthOverlays;
+	Errors references;
+	Errors outline;
+	Errors overlay;
+	double outlineRelative;
+	double seconds;
+	vector<double> milliseconds;
+};
+
+/**
+	\brief static function
+
+	@param[out] size a reference to a cv::Size to be filled as function output
+	@param[in] value a char pointer containing the size as <width>x<height>
+
+	@return true if the size is valid, false otherwise
+*/
+static bool parseSize(cv::Size & size, char const * value)
+{
+	return sscanf(value, "%dx%d", &size.width, &size.height) == 2 && size.width > 0 && size.height > 0;
+}
+
+/**
+	\brief static function
+
+	@param[out] options a reference to the Options to be filled as function output
+	@param[in] argc an int containing the number of arguments
+	@param[in] argv a char pointer array containing the arguments
+
+	@return true if the arguments are complete and valid, false otherwise
+*/
+static bool parse(Options & options, int argc, char ** argv)
+{
+	options.frames = 100;
+	options.seed = 1;
+	options.whiteBalance = false;
+
+	int i = 1;
+
+	for(; i < argc && !strncmp(argv[i], "--", 2); i++)
+	{
+		aux::SceneGenerator::Parameters & s = options.scene;
+
+		if(!strcmp(argv[i], "--action") && i + 1 < argc)
+		{
+			string action = argv[++i];
+
+			if(action != "withdrawal" && action != "implementation") return false;
+
+			s.action = action == "withdrawal" ? aux::Recording::WITHDRAWAL : aux::Recording::IMPLEMENTATION;
+		}
+		else if(!strcmp(argv[i], "--component") && i + 1 < argc) s.component = atoi(argv[++i]);
+		else if(!strcmp(argv[i], "--frames") && i + 1 < argc) options.frames = max(1, atoi(argv[++i]));
+		else if(!strcmp(argv[i], "--seed") && i + 1 < argc) options.seed = (unsigned) strtoul(argv[++i], 0, 10);
+		else if(!strcmp(argv[i], "--size") && i + 1 < argc)
+		{
+			cv::Size size;
+
+			if(!parseSize(size, argv[++i])) return false;
+
+			options.sizes.push_back(size);
+		}
+		else if(!strcmp(argv[i], "--coverage") && i + 2 < argc)
+		{
+			s.minCoverage = atof(argv[++i]);
+			s.maxCoverage = atof(argv[++i]);
+		}
+		else if(!strcmp(argv[i], "--kelvin") && i + 2 < argc)
+		{
+			s.minKelvin = atof(argv[++i]);
+			s.maxKelvin = atof(argv[++i]);
+		}
+		else if(!strcmp(argv[i], "--rotation") && i + 1 < argc) s.rotation = atof(argv[++i]);
+		else if(!strcmp(argv[i], "--perspective") && i + 1 < argc) s.perspective = atof(argv[++i]);
+		else if(!strcmp(argv[i], "--noise") && i + 1 < argc) s.noise = atof(argv[++i]);
+		else if(!strcmp(argv[i], "--blur") && i + 1 < argc) s.blur = atof(argv[++i]);
+		else if(!strcmp(argv[i], "--sticker") && i + 1 < argc) s.stickerSize = atof(argv[++i]);
+		else if(!strcmp(argv[i], "--white-balance")) options.whiteBalance = true;
+		else if(!strcmp(argv[i], "--output") && i + 1 < argc) options.output = argv[++i];
+		else return false;
+	}
+
+	if(options.sizes.empty()) options.sizes = { cv::Size(640, 480), cv::Size(1280, 720), cv::Size(1920, 1080) };
+
+	if(!(options.scene.minCoverage > 0 && options.scene.minCoverage <= options.scene.maxCoverage && options.scene.maxCoverage <= 1)) return false;
+
+	if(argc - i != 1) return false;
+
+	options.model = argv[i];
+
+	return true;
+}
+
+/**
+	\brief static inline function
+
+	@param a a constant reference to a cv::Point detected by the pipeline
+	@param b a constant reference to a cv::Point2d of the ground truth
+
+	@return a double containing the distance of both points in pixels
+*/
+static inline double distance(cv::Point const & a, cv::Point2d const & b)
+{
+	return std::sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
+}
+
+/**
+	\brief static function
+
+	@param[out] result a reference to the Result of the resolution to be extended as function output
+	@param[in] detected a constant reference to the aux::FrameResult of the pipeline
+	@param[in] truth a constant reference to the aux::SceneGenerator::GroundTruth of the frame
+
+	Compares the reference points and the outline index by index. Every detected overlay polygon is assigned the ground truth polygon
+	with the nearest center and compared corner by corner, the pipeline only returns the placements within the frame, so the numbers of polygons may differ
+*/
+static void compare(Result & result, aux::FrameResult const & detected, aux::SceneGenerator::GroundTruth const & truth)
+{
+	result.overlays += (int) detected.overlay.size();
+	result.truthOverlays += (int) truth.overlay.size();
+
+	if(detected.referencePoints.size() != truth.referencePoints.size() || detected.outline.size() != truth.outline.size()) return;
+
+	result.detected++;
+
+	double const diagonal = std::sqrt((truth.outline[0].x - truth.outline[2].x) * (truth.outline[0].x - truth.outline[2].x) + (truth.outline[0].y - truth.outline[2].y) * (truth.outline[0].y - truth.outline[2].y));
+
+	for(size_t i = 0; i < truth.referencePoints.size(); i++)
+		result.references.pixels.push_back(distance(detected.referencePoints[i], truth.referencePoints[i]));
+
+	for(size_t i = 0; i < truth.outline.size(); i++)
+	{
+		result.outline.pixels.push_back(distance(detected.outline[i], truth.outline[i]));
+		result.outlineRelative += result.outline.pixels.back() / diagonal;
+	}
+
+	for(size_t i = 0; i < detected.overlay.size(); i++)
+	{
+		vector<cv::Point> const & polygon = detected.overlay[i];
+
+		if(polygon.size() != cnst::NUMBER_CORNERS) continue;
+
+		cv::Point2d center;
+		double nearest = numeric_limits<double>::max();
+		size_t match = truth.overlay.size();
+
+		for(size_t k = 0; k < polygon.size(); k++) center += cv::Point2d(polygon[k].x, polygon[k].y) * 0.25;
+
+		for(size_t k = 0; k < truth.overlay.size(); k++)
+		{
+			vector<cv::Point2d> const & t = truth.overlay[k];
+			cv::Point2d const d = (t[0] + t[1] + t[2] + t[3]) * 0.25 - center;
+
+			if(d.x * d.x + d.y * d.y < nearest)
+			{
+				nearest = d.x * d.x + d.y * d.y;
+				match = k;
+			}
+		}
+
+		if(match == truth.overlay.size()) continue;
+
+		for(size_t k = 0; k < polygon.size(); k++)
+			result.overlay.pixels.push_back(distance(polygon[k], truth.overlay[match][k]));
+	}
+}
+
+/**
+	\brief static function
+
+	@param path a constant reference to a std::string containing the path of the file to be written
+	@param truth a constant reference to the aux::SceneGenerator::GroundTruth to be written
+
+	@return true if the ground truth was written as JSON, false otherwise
+*/
+static bool writeTruth(string const & path, aux::SceneGenerator::GroundTruth const & truth)
+{
+	ofstream file(path.c_str(), ios::trunc);
+
+	file.precision(3);
+	file << fixed << "{\"kelvin\":" << truth.kelvin << ",\"blur\":" << truth.blur
+		<< ",\"gains\":[" << truth.gains[0] << "," << truth.gains[1] << "," << truth.gains[2] << "],\"referencePoints\":[";
+
+	for(size_t i = 0; i < truth.referencePoints.size(); i++)
+		file << (i ? "," : "") << "[" << truth.referencePoints[i].x << "," << truth.referencePoints[i].y << "]";
+
+	file << "],\"outline\":[";
+
+	for(size_t i = 0; i < truth.outline.size(); i++)
+		file << (i ? "," : "") << "[" << truth.outline[i].x << "," << truth.outline[i].y << "]";
+
+	file << "],\"overlay\":[";
+
+	for(size_t i = 0; i < truth.overlay.size(); i++)
+	{
+		file << (i ? "," : "") << "[";
+
+		for(size_t k = 0; k < truth.overlay[i].size(); k++)
+			file << (k ? "," : "") << "[" << truth.overlay[i][k].x << "," << truth.overlay[i][k].y << "]";
+
+		file << "]";
+	}
+
+	file << "]}\n";
+
+	return (bool) file;
+}
+
+/**
+	\brief static function
+
+	@param[out] result a reference to the Result of the resolution to be filled as function output
+	@param[in] options a constant reference to the Options
+	@param[in] model a constant reference to a std::shared_ptr to the aux::Model to be rendered and detected
+	@param[in] size a constant reference to a cv::Size containing the resolution
+
+	Generates the frames of the resolution from the seed of the options, so every resolution sees the same sequence of random scenes,
+	and processes them through one aux::Session like a camera stream of the app. Only the pipeline is timed, not the rendering.
+	The color correction factors stay neutral unless --white-balance is given, then they are set to what proc::gnrc::calibrate() measures
+	on a gray card under the light of the frame. The frames and their ground truth are written to the output directory as
+	<width>x<height>_<frame>.png and .json if one is given
+
+	@see aux::SceneGenerator::generate()
+	@see compare()
+*/
+static void evaluate(Result & result, Options const & options, shared_ptr<aux::Model const> const & model, cv::Size const & size)
+{
+	aux::SceneGenerator::Parameters parameters = options.scene;
+	parameters.size = size;
+
+	aux::SceneGenerator generator(model, parameters, options.seed);
+	aux::SceneGenerator::GroundTruth truth;
+	aux::Session session;
+	aux::FrameResult detected;
+	vector<vector<string>> strings;
+	cv::Mat rgba, bgr;
+
+	result.size = size;
+	result.frames = 0;
+	result.detected = 0;
+	result.overlays = 0;
+	result.truthOverlays = 0;
+	result.outlineRelative = 0.0;
+	result.seconds = 0.0;
+
+	proc::gnrc::configure(session, strings, model);
+
+	for(int i = 0; i < options.frames; i++)
+	{
+		generator.generate(rgba, truth);
+
+		if(!options.output.empty())
+		{
+			ostringstream path;
+			path << options.output << "/" << size.width << "x" << size.height << "_";
+			path.width(6);
+			path.fill('0');
+			path << i;
+
+			cv::cvtColor(rgba, bgr, cv::COLOR_RGBA2BGR);
+			cv::imwrite(path.str() + ".png", bgr);
+
+			if(!writeTruth(path.str() + ".json", truth)) fprintf(stderr, "cannot write %s.json\n", path.str().c_str());
+		}
+
+		if(options.whiteBalance) session.setColorFactors(truth.gains[1] / truth.gains[2], truth.gains[1] / truth.gains[0]);
+
+		chrono::steady_clock::time_point const begin = chrono::steady_clock::now();
+
+		if(parameters.action == aux::Recording::WITHDRAWAL) proc::wdr::processWithdrawal(session, rgba, parameters.component, aux::Recording::now(), aux::ThreadPool::shared(), detected);
+		else proc::asmb::processImplementation(session, rgba, parameters.component, aux::Recording::now(), aux::ThreadPool::shared(), detected);
+
+		double const milliseconds = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+
+		result.milliseconds.push_back(milliseconds);
+		result.seconds += milliseconds / 1000.0;
+		result.frames++;
+
+		compare(result, detected, truth);
+	}
+}
+
+/**
+	\brief static function
+
+	@param values a std::vector containing the sorted values
+	@param p a double containing the percentile between 0 and 1
+
+	@return a double containing the value of the percentile, 0 if there are no values
+*/
+static double percentile(vector<double> const & values, double const p)
+{
+	if(values.empty()) return 0.0;
+
+	return values[min(values.size() - 1, (size_t) (p * values.size()))];
+}
+
+/**
+	\brief static function
+
+	@param out a reference to the std::ostream the errors are written to
+	@param errors a reference to the Errors to be sorted and written
+
+	Writes the mean, median, 95th percentile and maximum of the distances as JSON object
+*/
+static void writeErrors(ostream & out, Errors & errors)
+{
+	double sum = 0.0;
+
+	sort(errors.pixels.begin(), errors.pixels.end());
+
+	for(size_t i = 0; i < errors.pixels.size(); i++) sum += errors.pixels[i];
+
+	out << "{\"points\":" << errors.pixels.size() << ",\"meanPx\":" << (errors.pixels.empty() ? 0.0 : sum / errors.pixels.size())
+		<< ",\"p50Px\":" << percentile(errors.pixels, 0.5) << ",\"p95Px\":" << percentile(errors.pixels, 0.95)
+		<< ",\"maxPx\":" << (errors.pixels.empty() ? 0.0 : errors.pixels.back()) << "}";
+}
+
+/**
+	\brief synthetic accuracy and speed evaluation of the native processing, not part of the shared library
+
+	@param argc an int containing the number of arguments
+	@param argv a char pointer array containing the options and the path of the xml configuration file or model image
+
+	Renders the storage or the board of the configuration with aux::SceneGenerator at every resolution and measures how far the points of the pipeline are
+	from the ground truth together with the time the pipeline takes, so a faster detection can be checked against its cost in accuracy.
+	Options: --action withdrawal|implementation, --component <number>, --frames <per resolution>, --seed <number>, --size <width>x<height> (repeatable,
+	480p, 720p and 1080p by default), --coverage <min> <max>, --kelvin <min> <max>, --rotation <degrees>, --perspective <fraction>, --noise <standard deviation>,
+	--blur <pixels>, --sticker <fraction of the reference width>, --white-balance and --output <directory for the frames and their ground truth>.
+	Writes the detection rate, the distances of the reference points, outline and overlay corners and the frame time percentiles of each resolution as JSON to stdout.
+	Built on the host as target sceneevaluation of the CMake project of the jni directory.
+
+	@see evaluate()
+	@see compare()
+
+	@return an int containing 0 if the model could be read and the component exists, 1 otherwise
+*/
+int main(int argc, char ** argv)
+{
+	Options options;
+
+	if(!parse(options, argc, argv))
+	{
+		fprintf(stderr, "usage: %s [--action withdrawal|implementation] [--component <number>] [--frames <number>] [--seed <number>] [--size <width>x<height>]... [--coverage <min> <max>] [--kelvin <min> <max>] [--rotation <degrees>] [--perspective <fraction>] [--noise <sigma>] [--blur <pixels>] [--sticker <fraction>] [--white-balance] [--output <directory>] <configuration.xml|model image>\n", argv[0]);
+		return 1;
+	}
+
+	shared_ptr<aux::Model const> model = readf::readModel(options.model);
+
+	if(!model)
+	{
+		fprintf(stderr, "cannot read model %s\n", options.model.c_str());
+		return 1;
+	}
+
+	if(options.scene.component < 0 || options.scene.component >= (int) model->board().components().size())
+	{
+		fprintf(stderr, "component %d does not exist\n", options.scene.component);
+		return 1;
+	}
+
+	vector<Result> results(options.sizes.size());
+
+	for(size_t i = 0; i < options.sizes.size(); i++)
+		evaluate(results[i], options, model, options.sizes[i]);
+
+	cout.precision(3);
+	cout << fixed << "{\n\"action\":\"" << (options.scene.action == aux::Recording::WITHDRAWAL ? "withdrawal" : "implementation") << "\",\"component\":" << options.scene.component
+		<< ",\"seed\":" << options.seed << ",\"whiteBalance\":" << (options.whiteBalance ? "true" : "false") << ",\n\"resolutions\":[";
+
+	for(size_t i = 0; i < results.size(); i++)
+	{
+		Result & r = results[i];
+
+		sort(r.milliseconds.begin(), r.milliseconds.end());
+
+		cout << (i ? ",\n" : "\n") << "{\"width\":" << r.size.width << ",\"height\":" << r.size.height << ",\"frames\":" << r.frames << ",\"detected\":" << r.detected
+			<< ",\"detectionRate\":" << (r.frames ? (double) r.detected / r.frames : 0.0)
+			<< ",\"references\":";
+
+		writeErrors(cout, r.references);
+
+		cout << ",\"outline\":";
+
+		writeErrors(cout, r.outline);
+
+		cout << ",\"outlineRelative\":" << (r.outline.pixels.empty() ? 0.0 : r.outlineRelative / r.outline.pixels.size())
+			<< ",\"overlay\":";
+
+		writeErrors(cout, r.overlay);
+
+		cout << ",\"overlays\":" << r.overlays << ",\"truthOverlays\":" << r.truthOverlays
+			<< ",\"fps\":" << (r.seconds > 0 ? r.frames / r.seconds : 0.0)
+			<< ",\"p50Ms\":" << percentile(r.milliseconds, 0.5) << ",\"p99Ms\":" << percentile(r.milliseconds, 0.99)
+			<< ",\"maxMs\":" << (r.milliseconds.empty() ? 0.0 : r.milliseconds.back()) << "}";
+	}
+
+	cout << "\n]\n}\n";
+
+	return 0;
+}
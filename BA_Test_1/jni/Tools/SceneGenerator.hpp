@@ -0,0 +1,554 @@
+#ifndef TOOLS_SCENEGENERATOR_HPP_
+#define TOOLS_SCENEGENERATOR_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+#include "AuxiliaryClasses/Model.hpp"
+#include "AuxiliaryClasses/Recording.hpp"
+#include "Functions/GeometryFunctions.hpp"
+#include "Constants.hpp"
+
+/** \namespace
+	part of the namespace aux which supports the software with datastructures
+*/
+namespace aux
+{
+	/**
+		\class SceneGenerator
+		\brief SceneGenerator class serving as a renderer of synthetic camera frames of a board or storage with exact ground truth, not part of the shared library
+
+		Usage: This class serves as the source of labelled frames for measuring detection accuracy and speed together!
+		The board or storage of a aux::Model is laid out once on the plane of its reference stickers, the unit of the plane is the unit of the xml file.
+		Every frame places this plane under a random perspective, scale and rotation, lights it with a random color temperature and adds motion blur and noise.
+		The ground truth is the exact projection of the plane points, the corners are ordered like the pipeline orders them,
+		so a aux::FrameResult of proc::wdr::processWithdrawal() or proc::asmb::processImplementation() can be compared point by point.
+
+		@see Parameters
+		@see GroundTruth
+		@see generate()
+	*/
+	class SceneGenerator
+	{
+		public:
+
+			/**
+				\struct Parameters
+				\brief the ranges the random scene properties are drawn from
+			*/
+			struct Parameters
+			{
+				Recording::Action action;
+				int component;
+				cv::Size size;
+				double minCoverage;
+				double maxCoverage;
+				double rotation;
+				double perspective;
+				double minKelvin;
+				double maxKelvin;
+				double noise;
+				double blur;
+				double stickerSize;
+
+				/**
+					default constructor
+
+					A storage at 720p covering 50 to 90 percent of the frame, rotated by up to 10 degrees, lit between 3000 and 8000 Kelvin, with noise and blur
+				*/
+				Parameters()
+					:
+						action(Recording::WITHDRAWAL),
+						component(0),
+						size(1280, 720),
+						minCoverage(0.5),
+						maxCoverage(0.9),
+						rotation(10.0),
+						perspective(0.08),
+						minKelvin(3000.0),
+						maxKelvin(8000.0),
+						noise(4.0),
+						blur(6.0),
+						stickerSize(0.06)
+				{}
+			};
+
+			/**
+				\struct GroundTruth
+				\brief the exact geometry and the drawn properties of a generated frame
+
+				referencePoints, outline and overlay correspond to the members of aux::FrameResult in subpixel precision,
+				gains contains the factors the red, green and blue channels were lit with
+			*/
+			struct GroundTruth
+			{
+				std::vector<cv::Point2d> referencePoints;
+				std::vector<cv::Point2d> outline;
+				std::vector<std::vector<cv::Point2d>> overlay;
+				double kelvin;
+				double blur;
+				double gains[3];
+			};
+
+		private:
+
+			/**
+				a std::shared_ptr to the aux::Model whose board or storage is rendered
+			*/
+			std::shared_ptr<Model const> d_model;
+
+			/**
+				the Parameters of all generated frames
+			*/
+			Parameters d_parameters;
+
+			/**
+				the cv::RNG all random properties are drawn from, seeded once so a sequence of frames is reproducible
+			*/
+			cv::RNG d_rng;
+
+			/**
+				a std::vector containing the reference sticker centers on the plane in the order of proc::gnrc::centerPointsVector()
+			*/
+			std::vector<cv::Point2d> d_references;
+
+			/**
+				a std::vector containing the corners of the board or storage on the plane
+			*/
+			std::vector<cv::Point2d> d_outline;
+
+			/**
+				a std::vector of std::vectors containing the corners of the placements of the component or of all boxes on the plane
+			*/
+			std::vector<std::vector<cv::Point2d>> d_overlay;
+
+			/**
+				a std::vector of std::vectors containing the corners of the placements of all components on the plane, drawn as pads of the board
+			*/
+			std::vector<std::vector<cv::Point2d>> d_pads;
+
+			/**
+				a cv::Rect_ of double containing the bounds of everything drawn on the plane
+			*/
+			cv::Rect_<double> d_bounds;
+
+			/**
+				a cv::Scalar containing the RGBA color of the red reference stickers
+			*/
+			cv::Scalar d_red;
+
+			/**
+				a cv::Scalar containing the RGBA color of the blue reference stickers
+			*/
+			cv::Scalar d_blue;
+
+			/**
+				\brief private static inline function
+
+				@param hsv a constant reference to a cv::Scalar containing a color in the full range HSV space of proc::gnrc::contours()
+
+				@return a cv::Scalar containing the color as opaque RGBA
+			*/
+			static cv::Scalar inline rgba(cv::Scalar const & hsv)
+			{
+				cv::Mat pixel(1, 1, CV_8UC3, hsv), rgb;
+
+				cv::cvtColor(pixel, rgb, cv::COLOR_HSV2RGB_FULL);
+
+				cv::Vec3b const & c = rgb.at<cv::Vec3b>(0, 0);
+
+				return cv::Scalar(c[0], c[1], c[2], cnst::MAXIMUM_COLOR_CHANNEL_VALUE);
+			}
+
+			/**
+				\brief private static inline function
+
+				@param points a constant reference to a std::vector containing the three cv::Point2d objects of a corner triple as used by geo::vectorToPoint()
+				@param factors a constant reference to a std::vector containing the two vector factors
+
+				@return a cv::Point2d containing the point geo::vectorToPoint() approximates in whole pixels
+			*/
+			static cv::Point2d inline vectorToPoint(std::vector<cv::Point2d> const & points, std::vector<double> const & factors)
+			{
+				return points[0] + (points[1] - points[0]) * factors[1] + (points[2] - points[0]) * factors[0];
+			}
+
+			/**
+				\brief private static inline function
+
+				@param corners a constant reference to a std::vector containing the corner points of a parallelogram in the order top left, bottom left, bottom right, top right
+				@param u a double containing the fraction from the left to the right edge
+				@param v a double containing the fraction from the top to the bottom edge
+
+				@return a cv::Point2d containing the point within the parallelogram
+			*/
+			static cv::Point2d inline within(std::vector<cv::Point2d> const & corners, double const u, double const v)
+			{
+				return corners[0] + (corners[3] - corners[0]) * u + (corners[1] - corners[0]) * v;
+			}
+
+			/**
+				\brief private static inline function
+
+				@param h a constant reference to a cv::Mat containing a 3 x 3 homography of double
+				@param p a constant reference to a cv::Point2d on the plane
+
+				@return a cv::Point2d containing the point in the frame
+			*/
+			static cv::Point2d inline project(cv::Mat const & h, cv::Point2d const & p)
+			{
+				double const x = h.at<double>(0, 0) * p.x + h.at<double>(0, 1) * p.y + h.at<double>(0, 2);
+				double const y = h.at<double>(1, 0) * p.x + h.at<double>(1, 1) * p.y + h.at<double>(1, 2);
+				double const w = h.at<double>(2, 0) * p.x + h.at<double>(2, 1) * p.y + h.at<double>(2, 2);
+
+				return cv::Point2d(x / w, y / w);
+			}
+
+			/**
+				\brief private static inline function
+
+				@param[out] frame a reference to a cv::Mat containing the frame to be drawn on as function output
+				@param[in] h a constant reference to a cv::Mat containing the homography of the frame
+				@param[in] polygon a constant reference to a std::vector containing the convex polygon on the plane
+				@param[in] color a constant reference to a cv::Scalar containing the fill color
+
+				Fills the projected polygon antialiased with cnst::SCENE_SUBPIXEL_SHIFT fractional bits
+			*/
+			static void inline fill(cv::Mat & frame, cv::Mat const & h, std::vector<cv::Point2d> const & polygon, cv::Scalar const & color)
+			{
+				double const scale = 1 << cnst::SCENE_SUBPIXEL_SHIFT;
+				std::vector<cv::Point> points(polygon.size());
+
+				for(std::size_t i = 0; i < polygon.size(); i++)
+				{
+					cv::Point2d const p = SceneGenerator::project(h, polygon[i]);
+
+					points[i] = cv::Point(cvRound(p.x * scale), cvRound(p.y * scale));
+				}
+
+				cv::fillConvexPoly(frame, points.data(), (int) points.size(), color, cnst::ANTI_ALIASING, cnst::SCENE_SUBPIXEL_SHIFT);
+			}
+
+			/**
+				\brief private static inline function
+
+				@param kelvin a double containing a color temperature
+
+				@return a cv::Vec3d containing the approximate RGB color of a black body of the temperature between 0 and 255
+			*/
+			static cv::Vec3d inline blackBody(double const kelvin)
+			{
+				double const t = std::min(std::max(kelvin, 1000.0), 40000.0) / 100.0;
+
+				double const r = t <= 66.0 ? 255.0 : 329.698727446 * std::pow(t - 60.0, -0.1332047592);
+				double const g = t <= 66.0 ? 99.4708025861 * std::log(t) - 161.1195681661 : 288.1221695283 * std::pow(t - 60.0, -0.0755148492);
+				double const b = t >= 66.0 ? 255.0 : t <= 19.0 ? 0.0 : 138.5177312231 * std::log(t - 10.0) - 305.0447927307;
+
+				return cv::Vec3d(std::min(std::max(r, 1.0), 255.0), std::min(std::max(g, 1.0), 255.0), std::min(std::max(b, 1.0), 255.0));
+			}
+
+			/**
+				\brief private member inline function
+
+				Lays out the reference stickers, the outline and the placements of the component of a board or the boxes of a storage on the plane
+				with the same vector factors the pipeline uses, so the pipeline is exact for a frame without perspective, blur and noise up to its rounding
+
+				@see aux::Model::boardTargetPointsVectors()
+				@see aux::Model::storageTargetPointsVectors()
+				@see geo::withdrawalGridPointsVectorsFactors<T>()
+				@see geo::generateAssemblyLocation<T>()
+			*/
+			void inline layout()
+			{
+				Model const & m = *this->d_model;
+				bool const withdrawal = this->d_parameters.action == Recording::WITHDRAWAL;
+
+				double const w = withdrawal ? m.storage().refMidDimensions()[0] : m.board().refDimensions()[0];
+				double const h = withdrawal ? m.storage().refMidDimensions()[1] : m.board().refDimensions()[1];
+
+				std::vector<std::vector<double>> const & factors = withdrawal ? m.storageTargetPointsVectors() : m.boardTargetPointsVectors();
+
+				this->d_references = { cv::Point2d(0, 0), cv::Point2d(0, h), cv::Point2d(w, h), cv::Point2d(w, 0) };
+
+				std::vector<cv::Point2d> const & p = this->d_references;
+
+				this->d_outline = {
+						SceneGenerator::vectorToPoint({ p[0], p[1], p[3] }, factors[0]),
+						SceneGenerator::vectorToPoint({ p[1], p[0], p[2] }, factors[1]),
+						SceneGenerator::vectorToPoint({ p[2], p[3], p[1] }, factors[2]),
+						SceneGenerator::vectorToPoint({ p[3], p[2], p[0] }, factors[3])
+				};
+
+				if(withdrawal) this->layoutBoxes();
+				else this->layoutPlacements();
+
+				double const half = this->d_parameters.stickerSize * std::max(w, h) / 2;
+
+				double left = -half, top = -half, right = w + half, bottom = h + half;
+
+				for(std::size_t i = 0; i < this->d_outline.size(); i++)
+				{
+					left = std::min(left, this->d_outline[i].x);
+					right = std::max(right, this->d_outline[i].x);
+					top = std::min(top, this->d_outline[i].y);
+					bottom = std::max(bottom, this->d_outline[i].y);
+				}
+
+				this->d_bounds = cv::Rect_<double>(left, top, right - left, bottom - top);
+			}
+
+			/**
+				\brief private member inline function
+
+				Lays out the boxes of the storage row by row from the top and column by column from the left like proc::wdr::boxesVector().
+				The last column and row end at the outline, all others are spaced by the box size and half the box offset
+
+				@see geo::withdrawalGridPointsVectorsFactors<T>()
+			*/
+			void inline layoutBoxes()
+			{
+				Storage<double> const & storage = this->d_model->storage();
+
+				int const rows = storage.storageMatrix()[0];
+				int const columns = storage.storageMatrix()[1];
+
+				if(rows <= cnst::MINIMUM_NUMBER_BOXES_IN_ROW && columns <= cnst::MINIMUM_NUMBER_BOXES_IN_COLUMN) return;
+
+				std::vector<double> const step = geo::withdrawalGridPointsVectorsFactors<double>(storage, 1, 1);
+				std::vector<double> u, v;
+
+				for(int k = 0; k < columns; k++) u.push_back(k * step[0]);
+				u.push_back(1.0);
+
+				v.push_back(0.0);
+				for(int i = rows - 1; i > 0; i--) v.push_back(1.0 - i * step[1]);
+				v.push_back(1.0);
+
+				if(rows <= cnst::MINIMUM_NUMBER_BOXES_IN_ROW) v = { 0.0, 1.0 };
+
+				for(std::size_t i = 1; i < v.size(); i++)
+					for(std::size_t k = 1; k < u.size(); k++)
+						this->d_overlay.push_back({
+								SceneGenerator::within(this->d_outline, u[k - 1], v[i - 1]),
+								SceneGenerator::within(this->d_outline, u[k - 1], v[i]),
+								SceneGenerator::within(this->d_outline, u[k], v[i]),
+								SceneGenerator::within(this->d_outline, u[k], v[i - 1])
+						});
+			}
+
+			/**
+				\brief private member inline function
+
+				Lays out the placements of all components as pads and those of the rendered component as overlay,
+				the corners of each placement are ordered like geo::generateAssemblyLocation<T>() orders them
+
+				@see aux::PlacementIndex::grid()
+			*/
+			void inline layoutPlacements()
+			{
+				Model const & m = *this->d_model;
+
+				double const boardWidth = m.board().boardDimensions()[0];
+				double const boardHeight = m.board().boardDimensions()[1];
+
+				for(int c = 0; c < m.placementIndex().size(); c++)
+				{
+					PlacementIndex::GridView const grid = m.placementIndex().grid(c);
+
+					for(int i = 0; i < grid.cellStart[grid.rows * grid.columns]; i++)
+					{
+						PlacementIndex::Placement const & p = grid.placements[i];
+
+						double const s = p.coordY >= boardHeight / 2 ? 1.0 : -1.0;
+						double const x = p.coordX + p.mX;
+						double const y = p.coordY + p.mY;
+
+						std::vector<cv::Point2d> corners = {
+								SceneGenerator::within(this->d_outline, (x + s * p.cornerX) / boardWidth, (y + s * p.cornerY) / boardHeight),
+								SceneGenerator::within(this->d_outline, (x + s * p.cornerX) / boardWidth, (y - s * p.cornerY) / boardHeight),
+								SceneGenerator::within(this->d_outline, (x - s * p.cornerX) / boardWidth, (y - s * p.cornerY) / boardHeight),
+								SceneGenerator::within(this->d_outline, (x - s * p.cornerX) / boardWidth, (y + s * p.cornerY) / boardHeight)
+						};
+
+						if(c == this->d_parameters.component) this->d_overlay.push_back(corners);
+
+						this->d_pads.push_back(corners);
+					}
+				}
+			}
+
+			/**
+				\brief private member inline function
+
+				@return a cv::Mat containing a random homography from the plane to the frame which keeps the bounds of the plane within the frame
+				and the blue reference stickers above the red ones
+			*/
+			cv::Mat inline homography()
+			{
+				Parameters const & p = this->d_parameters;
+
+				double const coverage = this->d_rng.uniform(p.minCoverage, p.maxCoverage);
+				double const scale = coverage * std::min(p.size.width / this->d_bounds.width, p.size.height / this->d_bounds.height);
+				double const angle = this->d_rng.uniform(-p.rotation, p.rotation) * cnst::PI / cnst::ANGLE_DEGREE_MULTIPLIER;
+				double const jitter = p.perspective * scale * std::min(this->d_bounds.width, this->d_bounds.height);
+
+				cv::Point2d const center(this->d_bounds.x + this->d_bounds.width / 2, this->d_bounds.y + this->d_bounds.height / 2);
+				cv::Point2d const offset(
+						this->d_rng.uniform(-0.5, 0.5) * (1.0 - coverage) * p.size.width,
+						this->d_rng.uniform(-0.5, 0.5) * (1.0 - coverage) * p.size.height);
+
+				cv::Point2f plane[cnst::NUMBER_CORNERS], frame[cnst::NUMBER_CORNERS];
+
+				for(int i = 0; i < cnst::NUMBER_CORNERS; i++)
+				{
+					cv::Point2d const corner(this->d_bounds.x + (i >= 2 ? this->d_bounds.width : 0), this->d_bounds.y + (i == 1 || i == 2 ? this->d_bounds.height : 0));
+					cv::Point2d const d = (corner - center) * scale;
+
+					plane[i] = cv::Point2f((float) corner.x, (float) corner.y);
+					frame[i] = cv::Point2f(
+							(float) (p.size.width / 2 + offset.x + d.x * std::cos(angle) - d.y * std::sin(angle) + this->d_rng.uniform(-jitter, jitter)),
+							(float) (p.size.height / 2 + offset.y + d.x * std::sin(angle) + d.y * std::cos(angle) + this->d_rng.uniform(-jitter, jitter)));
+				}
+
+				return cv::getPerspectiveTransform(plane, frame);
+			}
+
+		public:
+
+			/**
+				explicit constructor
+
+				@param model a constant reference to a std::shared_ptr to the aux::Model to be rendered
+				@param parameters a constant reference to the Parameters of all generated frames
+				@param seed an unsigned containing the seed of the random scene properties
+
+				Lays out the plane once, the sticker colors are the centers of the color intervals proc::gnrc::detectionGraph() detects
+
+				@see cnst::BOTTOM_STICKERS_RED
+				@see cnst::TOP_STICKERS_BLUE
+			*/
+			explicit SceneGenerator(std::shared_ptr<Model const> const & model, Parameters const & parameters, unsigned const seed)
+				:
+					d_model(model),
+					d_parameters(parameters),
+					d_rng(seed),
+					d_red(SceneGenerator::rgba(cnst::BOTTOM_STICKERS_RED)),
+					d_blue(SceneGenerator::rgba(cnst::TOP_STICKERS_BLUE))
+			{
+				this->layout();
+			}
+
+			/**
+				default destructor
+			*/
+			~SceneGenerator() {}
+
+			/**
+				\brief public member inline function
+
+				@param[out] frame a reference to a cv::Mat to be filled with the RGBA frame as first function output
+				@param[out] truth a reference to the GroundTruth of the frame as second function output
+
+				Draws the background, the board with the pads of all placements or the storage with its boxes and the four reference stickers
+				under a new random homography, then multiplies the channels with the color of a random temperature relative to cnst::SCENE_NEUTRAL_KELVIN,
+				smears the frame along a random direction and adds gaussian noise
+			*/
+			void inline generate(cv::Mat & frame, GroundTruth & truth)
+			{
+				Parameters const & p = this->d_parameters;
+				cv::Mat const h = this->homography();
+				bool const withdrawal = p.action == Recording::WITHDRAWAL;
+
+				frame.create(p.size, CV_8UC4);
+				frame.setTo(cv::Scalar(150, 148, 140, 255));
+
+				SceneGenerator::fill(frame, h, this->d_outline, withdrawal ? cv::Scalar(190, 190, 185, 255) : cv::Scalar(30, 90, 45, 255));
+
+				for(std::size_t i = 0; i < this->d_pads.size(); i++)
+					SceneGenerator::fill(frame, h, this->d_pads[i], cv::Scalar(200, 200, 190, 255));
+
+				if(withdrawal)
+				{
+					for(std::size_t i = 0; i < this->d_overlay.size(); i++)
+					{
+						std::vector<cv::Point2d> const & box = this->d_overlay[i];
+						cv::Point2d const center = (box[0] + box[1] + box[2] + box[3]) * 0.25;
+						std::vector<cv::Point2d> inner(box.size());
+
+						for(std::size_t k = 0; k < box.size(); k++) inner[k] = center + (box[k] - center) * 0.92;
+
+						SceneGenerator::fill(frame, h, inner, cv::Scalar(120, 120, 118, 255));
+					}
+				}
+
+				double const half = p.stickerSize * std::max(this->d_references[2].x, this->d_references[2].y) / 2;
+
+				for(int i = 0; i < cnst::NUMBER_CORNERS; i++)
+				{
+					cv::Point2d const & c = this->d_references[i];
+					std::vector<cv::Point2d> const sticker = { c + cv::Point2d(-half, -half), c + cv::Point2d(-half, half), c + cv::Point2d(half, half), c + cv::Point2d(half, -half) };
+
+					SceneGenerator::fill(frame, h, sticker, i == 0 || i == 3 ? this->d_blue : this->d_red);
+				}
+
+				truth.kelvin = this->d_rng.uniform(p.minKelvin, p.maxKelvin);
+
+				cv::Vec3d const light = SceneGenerator::blackBody(truth.kelvin);
+				cv::Vec3d const neutral = SceneGenerator::blackBody(cnst::SCENE_NEUTRAL_KELVIN);
+
+				for(int i = 0; i < 3; i++) truth.gains[i] = (light[i] / neutral[i]) / (light[1] / neutral[1]);
+
+				cv::multiply(frame, cv::Scalar(truth.gains[0], truth.gains[1], truth.gains[2], 1.0), frame);
+
+				truth.blur = this->d_rng.uniform(0.0, p.blur);
+
+				if(truth.blur >= 1.0)
+				{
+					double const angle = this->d_rng.uniform(0.0, cnst::PI);
+					int const size = 2 * (int) std::ceil(truth.blur / 2) + 1;
+					cv::Point2d const d(std::cos(angle) * truth.blur / 2, std::sin(angle) * truth.blur / 2);
+					cv::Point const c(size / 2, size / 2);
+					cv::Mat kernel = cv::Mat::zeros(size, size, CV_32F), blurred;
+
+					cv::line(kernel, cv::Point(cvRound(c.x - d.x), cvRound(c.y - d.y)), cv::Point(cvRound(c.x + d.x), cvRound(c.y + d.y)), cv::Scalar::all(1.0));
+
+					kernel /= cv::sum(kernel)[0];
+
+					cv::filter2D(frame, blurred, -1, kernel);
+					frame = blurred;
+				}
+
+				if(p.noise > 0)
+				{
+					cv::Mat noisy, noise(p.size, CV_16SC4);
+
+					this->d_rng.fill(noise, cv::RNG::NORMAL, cv::Scalar::all(0), cv::Scalar(p.noise, p.noise, p.noise, 0));
+
+					frame.convertTo(noisy, CV_16SC4);
+					noisy += noise;
+					noisy.convertTo(frame, CV_8UC4);
+				}
+
+				truth.referencePoints.clear();
+				truth.outline.clear();
+				truth.overlay.clear();
+
+				for(std::size_t i = 0; i < this->d_references.size(); i++) truth.referencePoints.push_back(SceneGenerator::project(h, this->d_references[i]));
+				for(std::size_t i = 0; i < this->d_outline.size(); i++) truth.outline.push_back(SceneGenerator::project(h, this->d_outline[i]));
+
+				for(std::size_t i = 0; i < this->d_overlay.size(); i++)
+				{
+					std::vector<cv::Point2d> corners;
+
+					for(std::size_t k = 0; k < this->d_overlay[i].size(); k++) corners.push_back(SceneGenerator::project(h, this->d_overlay[i][k]));
+
+					truth.overlay.push_back(corners);
+				}
+			}
+	};
+}
+
+#endif /* TOOLS_SCENEGENERATOR_HPP_ */
@@ -203,12 +203,14 @@ public class MainActivity extends Activity implements OnGlobalLayoutListener {
 		Called when program is shutdown 
 		
 		@see de.ur.juergenhahn.ba.Handler.CameraHandler.disable()
+		@see de.ur.juergenhahn.ba.Handler.CameraHandler.release()
 		@see batteryInfoReciever
 	*/
     @Override
     public void onDestroy() {
         super.onDestroy();
         cameraHandler.disable();
+        cameraHandler.release();
         this.unregisterReceiver(this.batteryInfoReciever);
     }
 
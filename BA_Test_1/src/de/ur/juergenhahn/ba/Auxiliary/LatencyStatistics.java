@@ -0,0 +1,126 @@
+package de.ur.juergenhahn.ba.Auxiliary;
+
+/**
+	\class LatencyStatistics
+	
+	rudimentary class to save the latency statistics of a camera stream in Java
+	
+	@see aux::LatencyMonitor::Statistics in C++ documentation part
+*/
+public class LatencyStatistics {
+	
+	public static final int LATENCY = 0;
+	public static final int PROCESSING = 1;
+	public static final int INTERVAL = 2;
+	
+	private long frames;
+	private long dropped;
+	private long windowFrames;
+	private long windowDropped;
+	private double windowSeconds;
+	private double fps;
+	private double[][] percentiles;
+
+	/**
+		\brief constructor
+		
+		@param values a double array as returned by the native layer, six counters followed by the 50th, 90th and 99th percentile and the maximum of each metric
+	
+		Basic constructor for initialization purposes
+		
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.latencyStatistics()
+	*/
+	public LatencyStatistics(double[] values) {
+		this.frames = (long) values[0];
+		this.dropped = (long) values[1];
+		this.windowFrames = (long) values[2];
+		this.windowDropped = (long) values[3];
+		this.windowSeconds = values[4];
+		this.fps = values[5];
+		this.percentiles = new double[3][4];
+		
+		for(int m = 0; m < 3; m++) {
+			for(int p = 0; p < 4; p++) {
+				this.percentiles[m][p] = values[6 + 4 * m + p];
+			}
+		}
+	}
+
+	/**
+		\brief get the number of frames with a result since the session was created or reset
+		
+		@return a long containing the number of frames
+	*/
+	public long getFrames() {
+		return this.frames;
+	}
+
+	/**
+		\brief get the number of frames dropped before processing since the session was created or reset
+		
+		@return a long containing the number of dropped frames
+	*/
+	public long getDropped() {
+		return this.dropped;
+	}
+
+	/**
+		\brief get the number of frames with a result in the rolling windows
+		
+		@return a long containing the number of frames
+	*/
+	public long getWindowFrames() {
+		return this.windowFrames;
+	}
+
+	/**
+		\brief get the number of frames dropped in the rolling windows
+		
+		@return a long containing the number of dropped frames
+	*/
+	public long getWindowDropped() {
+		return this.windowDropped;
+	}
+
+	/**
+		\brief get the time the rolling windows cover
+		
+		@return a double containing the seconds
+	*/
+	public double getWindowSeconds() {
+		return this.windowSeconds;
+	}
+
+	/**
+		\brief get the effective frame rate of the results in the rolling windows
+		
+		@return a double containing the frames per second
+	*/
+	public double getFps() {
+		return this.fps;
+	}
+
+	/**
+		\brief get a percentile of a metric
+		
+		@param metric an int containing LATENCY, PROCESSING or INTERVAL
+		@param percentile a double containing 50, 90 or 99, any other value gives the maximum
+		
+		@return a double containing the percentile in milliseconds, 0 if nothing was measured
+	*/
+	public double getPercentile(int metric, double percentile) {
+		int p = percentile == 50 ? 0 : percentile == 90 ? 1 : percentile == 99 ? 2 : 3;
+		
+		return this.percentiles[metric][p];
+	}
+
+	/**
+		\brief get the statistics as a short line of text
+		
+		@return a String containing the frame rate, the dropped frames and the median and 99th percentile of the latency
+	*/
+	@Override
+	public String toString() {
+		return String.format("%.1f fps, %d dropped, latency p50 %.1f ms p99 %.1f ms", this.fps, this.windowDropped, this.percentiles[LATENCY][0], this.percentiles[LATENCY][2]);
+	}
+}
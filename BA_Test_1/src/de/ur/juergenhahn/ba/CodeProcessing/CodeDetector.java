@@ -1,132 +1,65 @@
 package de.ur.juergenhahn.ba.CodeProcessing;
 
-import org.opencv.android.Utils;
 import org.opencv.core.Mat;
 
-import android.graphics.Bitmap;
-import com.google.zxing.BinaryBitmap;
-import com.google.zxing.ChecksumException;
-import com.google.zxing.FormatException;
-import com.google.zxing.LuminanceSource;
-import com.google.zxing.NotFoundException;
-import com.google.zxing.RGBLuminanceSource;
-import com.google.zxing.Reader;
-import com.google.zxing.Result;
-import com.google.zxing.common.HybridBinarizer;
-import com.google.zxing.qrcode.QRCodeReader;
+import de.ur.juergenhahn.ba.Handler.NativeHandler;
 
 /**
 	\class CodeDetector
-	
-	evaluates frames for QR Codes and retrieves their data
+
+	retrieves the data of the QR Codes the native session decodes from the frames of a camera stream
 */
 public class CodeDetector {
-	
-	private boolean hasCode = false;
+
 	private String code = "";
-	private boolean isEnabled;
-	
+
 	/**
-		\brief constructor
+		\brief the memory address of the native session searching the frames for QR Codes
 	*/
-	public CodeDetector() {}
+	private long sessionAddress;
 
 	/**
-		\brief public member function
-		
-		@return a boolean which contains whether a QR code has been found (true) or not (false)
-		
-		@see hasCode
+		\brief constructor
+
+		@param sessionAddress a long variable containing the memory address of the native session of the camera stream
 	*/
-	public boolean hasCode() {		
-		return hasCode;
+	public CodeDetector(long sessionAddress) {
+		this.sessionAddress = sessionAddress;
 	}
 
 	/**
 	 	\brief public member function
-	 	
-		@param mRgba a Mat object containing frame data
-
-		evaluates the received Mat object for QR Codes
-		
-		@see isEnabled
-		@see detectCode()
-		@see getDecodableBinaryBitmap()
+
+		@param mRgba a Mat object containing frame data which is not processed by an action
+
+		evaluates the received Mat object for QR Codes if it is due, a found code is retrieved by the next update
+
+		@see update()
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.scanCode()
 	*/
 	public void processCode(Mat mRgba) {
-		if(isEnabled) {
-			if(detectCode(getDecodableBinaryBitmap(mRgba))) return;       
-		}
-	}	
-	
-	/**	
-		\brief private member function
-		
-		@param bitmap a BinaryBitmap object containing frame data
-		
-		Searches a QR Code in the given bitmap
-		
-		@see code
-		@see hasCode
-		
-		@throws ChecksumException
-		@throws FormatException
-		@throws NotFoundException
-		
-		@return true if a QR Code was successfully found and decoded, false else
-	*/
-	private boolean detectCode(BinaryBitmap bitmap) {
-		Reader reader = new QRCodeReader();
-	
-        Result result = null;
-        
-		try {		
-			result = reader.decode(bitmap);						
-            code = result.getText();	
-                       
-            reader.reset();    
-                       
-            hasCode = true;    
-            
-            return true;
-		} catch (ChecksumException ce) {
-			hasCode = false;
-		} catch (FormatException fe) {
-			hasCode = false;
-		} catch (NotFoundException nfe) {
-			hasCode = false;
-		}
-        
-        reader.reset();
-        
-        return false;
+		NativeHandler.scanCode(sessionAddress, mRgba.getNativeObjAddr());
 	}
-	
+
 	/**
-		\brief private member function
-		
-		@param mRgba a Mat object containing frame data
-		
-		Converts a Mat object to a BinaryBitmap object
-		
-		@return a BinaryBitmap containing the data of the given Mat object which was converted
-	*/
-	private BinaryBitmap getDecodableBinaryBitmap(Mat mRgba) {				
-		Bitmap bMap = Bitmap.createBitmap(mRgba.width(), mRgba.height(), Bitmap.Config.ARGB_8888);
-		Utils.matToBitmap(mRgba, bMap);		
-		
-        int[] intArray = new int[bMap.getWidth() * bMap.getHeight()];
+	 	\brief public member function
 
-        bMap.getPixels(intArray, 0, bMap.getWidth(), 0, 0, bMap.getWidth(), bMap.getHeight());
+		takes the QR Code the native session decoded since the last update, the previous code is kept if there is none
 
-        LuminanceSource source = new RGBLuminanceSource(bMap.getWidth(), bMap.getHeight(), intArray);
+		@see code
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.takeCode()
+	*/
+	public void update() {
+		String decoded = NativeHandler.takeCode(sessionAddress);
 
-        return new BinaryBitmap(new HybridBinarizer(source));		
+		if(!decoded.equals("")) {
+			code = decoded;
+		}
 	}
-	
+
 	/**
 		\brief resets the code variable to an empty String
-		
+
 		@see code
 	*/
 	public void reset() {
@@ -135,37 +68,28 @@ public class CodeDetector {
 
 	/**
 	 	\brief get the data of the QR Code
-	 	
+
 		@return a String containing the data of the QR Code
 	*/
 	public String getCodeInterpretation() {
 		return code;
 	}
-	
-	/**
-		\brief resets the hasCode to false
-		
-		@see hasCode
-	*/
-	public void resetCodeAvailable() {
-		hasCode = false;
-	}
 
 	/**
-		\brief enables QR Code detection by setting isEnabled to true
-		
-		@see isEnabled
+		\brief enables QR Code detection of the native session
+
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.setCodeScanning()
 	*/
 	public void enable() {
-		isEnabled = true;
+		NativeHandler.setCodeScanning(sessionAddress, true);
 	}
 
 	/**
-		\brief disables QR Code detection by setting isEnabled to false
-		
-		@see isEnabled
+		\brief disables QR Code detection of the native session, a code which was decoded but not retrieved yet is dropped
+
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.setCodeScanning()
 	*/
 	public void disable() {
-		isEnabled = false;
+		NativeHandler.setCodeScanning(sessionAddress, false);
 	}
 }
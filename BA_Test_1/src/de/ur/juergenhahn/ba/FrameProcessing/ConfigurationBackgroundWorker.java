@@ -92,14 +92,15 @@ public class ConfigurationBackgroundWorker extends Thread {
 	 	\brief public member function 
 	 	
 		@param filepath a String object containing the path to a configuration file
+		@param sessionAddress a long variable containing the memory address of the native session to be calibrated
 	 	@see de.ur.juergenhahn.ba.Handler.NativeHandler.configurate()
 		@see stack
 		@see de.ur.juergenhahn.ba.Datastructures.BlockingStack.poll()
 
 	 	@return an array of arrays of string object containing the work task related meta data
 	 */
-	public String[][] configurate(String filepath) {
-		return NativeHandler.configurate(stack.poll().getNativeObjAddr(), ccv.getWidth(), ccv.getHeight(), (int) scanRectangleCoordinates[0], (int) scanRectangleCoordinates[1], (int) scanRectangleCoordinates[2], (int) scanRectangleCoordinates[3], filepath);
+	public String[][] configurate(String filepath, long sessionAddress) {
+		return NativeHandler.configurate(sessionAddress, stack.poll().getNativeObjAddr(), ccv.getWidth(), ccv.getHeight(), (int) scanRectangleCoordinates[0], (int) scanRectangleCoordinates[1], (int) scanRectangleCoordinates[2], (int) scanRectangleCoordinates[3], filepath);
 	}
 	
 	/**
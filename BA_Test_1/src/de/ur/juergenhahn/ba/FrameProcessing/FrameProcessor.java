@@ -11,23 +11,75 @@ import de.ur.juergenhahn.ba.Handler.NativeHandler;
 */
 public class FrameProcessor {		
 
+	/**
+		\brief the processing time per frame in milliseconds the native quality controller holds, one frame at 30 frames per second
+	*/
+	private static final double FRAME_BUDGET = 33.0;
+	
+	/**
+		\brief the states of a component of a work order, matching aux::WorkOrder::State of the native layer
+		
+		@see processWorkOrder()
+	*/
+	public static final int DONE = 0;
+	public static final int CURRENT = 1;
+	public static final int UPCOMING = 2;
+
+	/**
+		\brief the memory address of the native session holding the calibration data of this camera stream
+	*/
+	private long sessionAddress;
+
 	/**
 		\brief constructor
+		
+		creates the native session of this camera stream and sets its budget per frame
+		
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.createSession()
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.setQualityBudget()
 	*/
-	public FrameProcessor(){}
+	public FrameProcessor() {
+		sessionAddress = NativeHandler.createSession();
+		NativeHandler.setQualityBudget(sessionAddress, FRAME_BUDGET);
+	}
+	
+	/**
+		\brief public member function
+		
+		@return a long variable containing the memory address of the native session
+	*/
+	public long getSessionAddress() {
+		return sessionAddress;
+	}
+	
+	/**
+		\brief public member function
+		
+		releases the native session, the FrameProcessor must not be used afterwards
+		
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.releaseSession()
+	*/
+	public void release() {
+		if(sessionAddress != 0) {
+			NativeHandler.releaseSession(sessionAddress);
+			sessionAddress = 0;
+		}
+	}
 	
 	/**
 		\brief public member function
 	 	
 		@param m a Mat object containing frame data to be processed according to the withdrawal sub task
 		@param process a int variable containing the number of the current component to be withdrawn
+		@param captureTimestamp a long variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a long variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
 		
 		processes the given frame for withdrawal sub task
 		
 		@see de.ur.juergenhahn.ba.Handler.NativeHandler.processWithdrawal()
 	*/
-	public void processWithdrawal(Mat m, int process) {  
-		NativeHandler.processWithdrawal(m.getNativeObjAddr(), process);
+	public void processWithdrawal(Mat m, int process, long captureTimestamp, long droppedFrames) {  
+		NativeHandler.processWithdrawal(sessionAddress, m.getNativeObjAddr(), process, captureTimestamp, droppedFrames);
 	}
 	
 	/**
@@ -35,12 +87,47 @@ public class FrameProcessor {
 	 
 		@param m a Mat object containing frame data to be processed according to the implementation sub task
 		@param cn a int variable containing the number of the current component to be implemented
+		@param captureTimestamp a long variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a long variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
 		
 		processes the given frame for implementation sub task
 		
 		@see de.ur.juergenhahn.ba.Handler.NativeHandler.processImplementation()
 	*/
-	public void processImplementation(Mat m, int cn) {
-		NativeHandler.processImplementation(m.getNativeObjAddr(), cn);
+	public void processImplementation(Mat m, int cn, long captureTimestamp, long droppedFrames) {
+		NativeHandler.processImplementation(sessionAddress, m.getNativeObjAddr(), cn, captureTimestamp, droppedFrames);
+	}
+	
+	/**
+		\brief public member function
+	 
+		@param m a Mat object containing frame data showing the storage and the board
+		@param cn a int variable containing the number of the current component to be withdrawn and implemented
+		@param captureTimestamp a long variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a long variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
+		
+		processes the given frame for the withdrawal and implementation sub task together
+		
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.processCombined()
+	*/
+	public void processCombined(Mat m, int cn, long captureTimestamp, long droppedFrames) {
+		NativeHandler.processCombined(sessionAddress, m.getNativeObjAddr(), cn, captureTimestamp, droppedFrames);
+	}
+	
+	/**
+		\brief public member function
+	 
+		@param m a Mat object containing frame data to be processed according to the implementation sub task
+		@param components an array of int variables containing the numbers of the components to be highlighted
+		@param states an array of int variables containing the state of each component, one of DONE, CURRENT and UPCOMING
+		@param captureTimestamp a long variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a long variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
+		
+		processes the given frame for the implementation sub task of several components at once
+		
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.processWorkOrder()
+	*/
+	public void processWorkOrder(Mat m, int[] components, int[] states, long captureTimestamp, long droppedFrames) {
+		NativeHandler.processWorkOrder(sessionAddress, m.getNativeObjAddr(), components, states, captureTimestamp, droppedFrames);
 	}
 }
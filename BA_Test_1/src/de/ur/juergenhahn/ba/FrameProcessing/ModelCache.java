@@ -0,0 +1,64 @@
+package de.ur.juergenhahn.ba.FrameProcessing;
+
+import de.ur.juergenhahn.ba.Handler.NativeHandler;
+
+/**
+	\class ModelCache
+	
+	Keeps the models of all boards of a directory ready so a board is switched by its QR code without reading its configuration file again
+*/
+public class ModelCache {
+	
+	/**
+		\brief the maximum estimated number of bytes of all models kept in memory
+	*/
+	private static final long MEMORY_BUDGET = 64L * 1024L * 1024L;
+	
+	/**
+		\brief the memory address of the native model cache
+	*/
+	private long cacheAddress;
+	
+	/**
+		\brief constructor
+		
+		@param directory a String object containing the path of the directory containing the board configuration files
+		
+		creates the native model cache and starts loading the directory in the background
+		
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.createModelCache()
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.preloadModels()
+	*/
+	public ModelCache(String directory) {
+		cacheAddress = NativeHandler.createModelCache(MEMORY_BUDGET);
+		NativeHandler.preloadModels(cacheAddress, directory);
+	}
+	
+	/**
+		\brief public member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session to be switched
+		@param boardId a String object containing the id of the board, the content of its QR code
+		
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.activateModel()
+		
+		@return an array of arrays of String objects containing the work related meta data, empty if the board is unknown
+	*/
+	public String[][] activate(long sessionAddress, String boardId) {
+		return NativeHandler.activateModel(sessionAddress, cacheAddress, boardId);
+	}
+	
+	/**
+		\brief public member function
+		
+		releases the native model cache, the ModelCache must not be used afterwards
+		
+		@see de.ur.juergenhahn.ba.Handler.NativeHandler.releaseModelCache()
+	*/
+	public void release() {
+		if(cacheAddress != 0) {
+			NativeHandler.releaseModelCache(cacheAddress);
+			cacheAddress = 0;
+		}
+	}
+}
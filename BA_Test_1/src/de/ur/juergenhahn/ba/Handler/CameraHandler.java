@@ -18,10 +18,10 @@ import android.widget.ProgressBar;
 import android.widget.TextView;
 
 import de.ur.juergenhahn.ba.Auxiliary.Component;
-import de.ur.juergenhahn.ba.CodeProcessing.CodeBackgroundWorker;
 import de.ur.juergenhahn.ba.CodeProcessing.CodeDetector;
 import de.ur.juergenhahn.ba.FrameProcessing.ConfigurationBackgroundWorker;
 import de.ur.juergenhahn.ba.FrameProcessing.FrameProcessor;
+import de.ur.juergenhahn.ba.FrameProcessing.ModelCache;
 import de.ur.juergenhahn.ba.Views.CustomCameraView;
 
 /** 
@@ -41,18 +41,18 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
     private FrameProcessor frameProcessor;
     
     /**
-		\brief a CodeDetector object
+		\brief a ModelCache object
 		
-		@see de.ur.juergenhahn.ba.CodeProcessing.CodeDetector
+		@see de.ur.juergenhahn.ba.FrameProcessing.ModelCache
 	*/
-    private CodeDetector codeDetector;
+    private ModelCache modelCache;
     
     /**
-		\brief a CodeBackgroundWorker object
+		\brief a CodeDetector object
 		
-		@see de.ur.juergenhahn.ba.CodeProcessing.CodeBackgroundWorker
+		@see de.ur.juergenhahn.ba.CodeProcessing.CodeDetector
 	*/
-    private CodeBackgroundWorker codeBackgroundWorker;    
+    private CodeDetector codeDetector;
     
     /**
     	\brief a ConfigurationBackgroundWorker object
@@ -76,6 +76,16 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
     private UIUpdateHandler uiUpdateHandler;
     
     private Mat currentFrame;
+    private long captureTimestamp = 0;
+    private int droppedFrames = 0;
+    private boolean isProcessing = false;
+    
+    /**
+		\brief the number of components following the current one whose locations are shown while implementing, 0 shows the current component only
+		
+		@see setUpcomingComponents()
+	*/
+    private int upcomingComponents = 0;
 	private TextView[] elements;
 	private double[] scanRectangleCoordinates;
 	private View[] scanRectangleElements;
@@ -86,6 +96,7 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
 	private String configFilePath;
 	private boolean isWhiteBalanced = false;
 	private String previousCode = "";
+	private String activeBoardId = "";
 	private int maxProcessingNum;
 	
 	 /**
@@ -153,18 +164,16 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
     /**
     	\brief public member function
     	
-    	Disables the camera view if it is initialized and interrupts background workers
+    	Disables the camera view if it is initialized and interrupts the background worker
     
     	@see mOpenCvCameraView
-    	@see codeBackgroundWorker
-    	@see codeBackgroundWorker
+    	@see configurationBackgroundWorker
     */
     public void disable() {
         if (mOpenCvCameraView != null) { 
         	mOpenCvCameraView.disableView(); 
         }
         
-        codeBackgroundWorker.interrupt();
         configurationBackgroundWorker.interrupt();
     }
 
@@ -186,12 +195,14 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
     	@param width
     	@param height
   		
-  		sets all given variables at the initial start of the camera preview and enables the background workers
+  		sets all given variables at the start of the camera preview and enables the QR code search of the native session.
+  		The native session and the model cache are created at the first start only and kept while the preview is paused,
+  		so the calibration and the active board survive a pause of the activity
   		
   		@see codeDetector
   		@see uiUpdateHandler
   		@see frameProcessor
-  		@see codeBackgroundWorker
+  		@see modelCache
   		@see configurationBackgroundWorker
   		@see configFilePath
   		@see context
@@ -202,13 +213,19 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
     */
     @Override
     public void onCameraViewStarted(int width, int height) {
-    	codeDetector = new CodeDetector();
         uiUpdateHandler = new UIUpdateHandler(context, elements, scanRectangleElements, progressBar, progressBarSR);
-        frameProcessor = new FrameProcessor();        
-        codeBackgroundWorker = new CodeBackgroundWorker(codeDetector);
+        
+        if(frameProcessor == null) {
+        	frameProcessor = new FrameProcessor();
+        }
+        
+        if(modelCache == null) {
+        	modelCache = new ModelCache(Environment.getExternalStorageDirectory().getAbsolutePath() + context.getString(R.string.modelDirectory));
+        }
+        
+        codeDetector = new CodeDetector(frameProcessor.getSessionAddress());
         configurationBackgroundWorker = new ConfigurationBackgroundWorker(mOpenCvCameraView, scanRectangleCoordinates, uiUpdateHandler);
         codeDetector.enable();
-        codeBackgroundWorker.start();
     
         configFilePath = Environment.getExternalStorageDirectory().getAbsolutePath() + context.getString(R.string.configFilePath);
     }
@@ -216,39 +233,89 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
     /**
     	\brief public overridden function
     	
-    	shuts down the background workers once the camera preview is stopped
+    	shuts down the background worker once the camera preview is stopped, the native session and the model cache are kept until release()
     	
     	@see currentFrame
-    	@see codeBackgroundWorker
     	@see configurationBackgroundWorker
+    	@see release()
     */
     @Override
     public void onCameraViewStopped() {
-        currentFrame.release();        
-        codeBackgroundWorker.interrupt();
+        if(currentFrame != null) {
+        	currentFrame.release();
+        }
+        
         configurationBackgroundWorker.interrupt();
     }
+    
+    /**
+    	\brief public member function
+    	
+    	@param count an int containing the number of components following the current one whose locations are shown while implementing
+    	
+    	sets how far ahead the implementation task shows the work order, 0 (the default) shows the current component only
+    	
+    	@see upcomingComponents
+    	@see handleImplementation()
+    */
+    public void setUpcomingComponents(int count) {
+    	upcomingComponents = Math.max(count, 0);
+    }
+    
+    /**
+    	\brief public member function
+    	
+    	releases the native session and the model cache once the handler is not used anymore, the camera view has to be disabled before
+    	
+    	@see frameProcessor
+    	@see modelCache
+    	@see disable()
+    */
+    public void release() {
+        if(frameProcessor != null) {
+        	frameProcessor.release();
+        	frameProcessor = null;
+        }
+        
+        if(modelCache != null) {
+        	modelCache.release();
+        	modelCache = null;
+        }
+    }
            
     /**
     	\brief public overriden function
     	
     	@param inputFrame a final CvCameraViewFrame object containing frame data
     
-    	Receives each camera frame and delegates it to further processing and then displays it
+    	Receives each camera frame and delegates it to further processing and then displays it.
+    	A frame which is not processed by an action is searched for a QR code on its own, the actions search their frames natively.
+    	The frames the camera dropped count only while the previous frame was processed, not the ones consumed by calibration, the QR search or idling
     	
     	@see currentFrame
-    	@see codeBackgroundWorker
-    	@see de.ur.juergenhahn.ba.CodeProcessing.CodeBackgroundWorker.insertFrame()
+    	@see captureTimestamp
+    	@see droppedFrames
+    	@see isProcessing
+    	@see codeDetector
+    	@see de.ur.juergenhahn.ba.CodeProcessing.CodeDetector.update()
+    	@see de.ur.juergenhahn.ba.CodeProcessing.CodeDetector.processCode()
   		@see handleConfiguration()
   		@see handleFrameProcessing()
     */
     @Override
     public Mat onCameraFrame(final CvCameraViewFrame inputFrame) { 
+        captureTimestamp = mOpenCvCameraView.getCaptureTimestamp();
+        droppedFrames = isProcessing ? mOpenCvCameraView.getDroppedFrames() : 0;
         currentFrame = inputFrame.rgba();   
-        codeBackgroundWorker.insertFrame(currentFrame);   
+        codeDetector.update();
         
         handleConfiguration();
-        handleFrameProcessing();            
+        
+        isProcessing = handleFrameProcessing();
+        
+        if(!isProcessing) {
+        	codeDetector.processCode(currentFrame);
+        }
          
         return currentFrame;
     }       
@@ -278,30 +345,31 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
     	@see isWhiteBalanced
     	@see configFilePath
     	@see context
+    	@see isBoardCode()
+    	@see activateBoard()
+    	@see applyWorkTask()
     */
 	private void handleConfiguration() {
 		if(codeDetector.getCodeInterpretation().equals(context.getString(R.string.calibration)) 
 			&& !configurationBackgroundWorker.isAlive()) {
 			
 			applyConfiguration();
-		} 		
+		} else if(isBoardCode(codeDetector.getCodeInterpretation()) 
+			&& !codeDetector.getCodeInterpretation().equals(activeBoardId)
+			&& !configurationBackgroundWorker.isAlive()) {
+			
+			activateBoard(codeDetector.getCodeInterpretation());
+		}
 		
 		if(configurationBackgroundWorker.isAlive()) {
 			configurationBackgroundWorker.insertFrame(currentFrame);
 		} else if(configurationBackgroundWorker.size() > 0) {	
 			
-			String[][] uiValues = configurationBackgroundWorker.configurate(configFilePath);			
+			String[][] uiValues = configurationBackgroundWorker.configurate(configFilePath, frameProcessor.getSessionAddress());			
 			
 			if(uiValues.length > 0) {
-				maxProcessingNum = uiValues[1].length - 1;	
-				String boardName = uiValues[0][0];
-				uiUpdateHandler.updateTextViewTLC(boardName);		
-				
-				for(int i = 0; i < uiValues[1].length; i++) {
-					components.add(new Component(uiValues[1][i], Integer.parseInt(uiValues[2][i]), Integer.parseInt(uiValues[3][i]) != 0));
-				}
-				
-				progressBar.setMax(uiValues[1].length);
+				applyWorkTask(uiValues);
+				activeBoardId = "";
 			} 
 			
 			codeDetector.enable();			
@@ -312,6 +380,75 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
 		} 		
 	}
 	
+	/**
+		\brief private member function
+		
+		@param code a String object containing the content of a QR Code
+		
+		@return true if the QR Code names a board, i.e. it is neither empty nor one of the calibration, withdrawal, implementation or combined codes
+	*/
+	private boolean isBoardCode(String code) {
+		return !code.equals("")
+			&& !code.equals(context.getString(R.string.calibration))
+			&& !code.equals(context.getString(R.string.withdraw))
+			&& !code.equals(context.getString(R.string.implement))
+			&& !code.equals(context.getString(R.string.combine));
+	}
+	
+	/**
+		\brief private member function
+		
+		@param boardId a String object containing the id of the board to be worked on
+		
+		switches the session to the model of the board kept by the model cache, the white balancing of the camera is kept
+		
+		@see modelCache
+		@see de.ur.juergenhahn.ba.FrameProcessing.ModelCache.activate()
+		@see activeBoardId
+		@see applyWorkTask()
+	*/
+	private void activateBoard(String boardId) {
+		String[][] uiValues = modelCache.activate(frameProcessor.getSessionAddress(), boardId);
+		
+		activeBoardId = boardId;
+		
+		if(uiValues.length > 0) {
+			applyWorkTask(uiValues);
+			uiUpdateHandler.updateTextViewBRC(context.getString(R.string.board_activated));
+		}
+	}
+	
+	/**
+		\brief private member function
+		
+		@param uiValues an array of arrays of String objects containing the board name, component names, occurrences and polarities
+		
+		replaces the work task meta data by the one of a newly configured board and restarts the work process
+		
+		@see components
+		@see process
+		@see isWithdrawn
+		@see maxProcessingNum
+		@see uiUpdateHandler
+		@see de.ur.juergenhahn.ba.Handler.UIUpdateHandler.updateTextViewTLC()
+		@see progressBar
+	*/
+	private void applyWorkTask(String[][] uiValues) {
+		maxProcessingNum = uiValues[1].length - 1;	
+		String boardName = uiValues[0][0];
+		uiUpdateHandler.updateTextViewTLC(boardName);		
+		
+		components.clear();
+		process = -1;
+		isWithdrawn = false;
+		
+		for(int i = 0; i < uiValues[1].length; i++) {
+			components.add(new Component(uiValues[1][i], Integer.parseInt(uiValues[2][i]), Integer.parseInt(uiValues[3][i]) != 0));
+		}
+		
+		progressBar.setMax(uiValues[1].length);
+	}
+	
 	/**
 		\brief private member function
 		
@@ -324,20 +461,32 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
 		@see previousCode
 		@see handleWithdrawal()
 		@see handleImplementation()
+		@see handleCombined()
 		@see context
+		
+		@return true if the frame was handed to an action, false if it was left to the QR code search
 	*/
-	private void handleFrameProcessing() {
+	private boolean handleFrameProcessing() {
 		if(!configurationBackgroundWorker.isAlive() && isWhiteBalanced) {				
 			if(codeDetector.getCodeInterpretation().equals(context.getString(R.string.withdraw)) 
 					|| (codeDetector.getCodeInterpretation().equals("") 
 							&& previousCode.equals(context.getString(R.string.withdraw)))) {
 				handleWithdrawal();
+				return true;
 			} else if((codeDetector.getCodeInterpretation().equals(context.getString(R.string.implement)) 
 					|| (codeDetector.getCodeInterpretation().equals("")
 							&& previousCode.equals(context.getString(R.string.implement)))) && process > -1 ) {	
 				handleImplementation();
+				return true;
+			} else if(codeDetector.getCodeInterpretation().equals(context.getString(R.string.combine)) 
+					|| (codeDetector.getCodeInterpretation().equals("") 
+							&& previousCode.equals(context.getString(R.string.combine)))) {
+				handleCombined();
+				return true;
 			}
 		}		
+		
+		return false;
 	}
 
 	/**
@@ -401,7 +550,7 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
 			uiUpdateHandler.displayEnteredMode(context.getString(R.string.withdraw), components.get(process).getName());
 		}
 		
-		frameProcessor.processWithdrawal(currentFrame, process);
+		frameProcessor.processWithdrawal(currentFrame, process, captureTimestamp, droppedFrames);
 		uiUpdateHandler.updateTextViewBRC(context.getString(R.string.withdrawing));
 		uiUpdateHandler.updateComponentInfo(components.get(process));
 		uiUpdateHandler.updateProcessProgess(process + 1, maxProcessingNum + 1);
@@ -410,8 +559,10 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
 	/**
 		\brief private member function
 		
-		Handles the processing of frames in the context of the implementation task
+		Handles the processing of frames in the context of the implementation task.
+		The locations of the current component are shown on their own, or as work order together with the ones of the next upcomingComponents components
 		
+		@see upcomingComponents
 		@see isWithdrawn
 		@see uiUpdateHandler
 		@see de.ur.juergenhahn.ba.Handler.UIUpdateHandler.displayEnteredMode()
@@ -421,8 +572,10 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
 		@see previousCode
 		@see frameProcessor
 		@see de.ur.juergenhahn.ba.FrameProcessing.FrameProcessor.processImplementation()
+		@see de.ur.juergenhahn.ba.FrameProcessing.FrameProcessor.processWorkOrder()
 		@see currentFrame
 		@see process
+		@see maxProcessingNum
 	*/
 	private void handleImplementation() {
 		if(isWithdrawn) {
@@ -430,8 +583,66 @@ public class CameraHandler implements CameraBridgeViewBase.CvCameraViewListener2
 		}
 		
 		previousCode = context.getString(R.string.implement);
-		frameProcessor.processImplementation(currentFrame, process);  
+		
+		int count = Math.min(upcomingComponents, maxProcessingNum - process) + 1;
+		
+		if(count > 1) {
+			int[] workOrder = new int[count];
+			int[] states = new int[count];
+			
+			for(int i = 0; i < count; i++) {
+				workOrder[i] = process + i;
+				states[i] = i == 0 ? FrameProcessor.CURRENT : FrameProcessor.UPCOMING;
+			}
+			
+			frameProcessor.processWorkOrder(currentFrame, workOrder, states, captureTimestamp, droppedFrames);
+		} else {
+			frameProcessor.processImplementation(currentFrame, process, captureTimestamp, droppedFrames);
+		}
+		
 		isWithdrawn = false;
 		uiUpdateHandler.updateTextViewBRC(context.getString(R.string.implementing));
 	}
+	
+	/**
+		\brief private member function
+		
+		Handles the processing of frames showing the storage and the board in the context of the withdrawal and implementation task together.
+		Entering the combined mode takes the next component, unless the current one is withdrawn but not implemented yet
+		
+		@see previousCode
+		@see context
+		@see isWithdrawn
+		@see process
+		@see maxProcessingNum
+		@see uiUpdateHandler
+		@see de.ur.juergenhahn.ba.Handler.UIUpdateHandler.displayEnteredMode()
+		@see de.ur.juergenhahn.ba.Handler.UIUpdateHandler.updateTextViewBRC()
+		@see de.ur.juergenhahn.ba.Handler.UIUpdateHandler.updateComponentInfo()
+		@see de.ur.juergenhahn.ba.Handler.UIUpdateHandler.updateProcessProgess()
+		@see frameProcessor
+		@see de.ur.juergenhahn.ba.FrameProcessing.FrameProcessor.processCombined()
+	*/
+	private void handleCombined() {
+		if(!previousCode.equals(context.getString(R.string.combine))) {
+			
+			if(!isWithdrawn) {
+				if(process == maxProcessingNum) {
+					process = -1;
+					uiUpdateHandler.displayEnteredMode(context.getString(R.string.completion), "");
+				}
+				
+				process++;
+			}
+			
+			uiUpdateHandler.displayEnteredMode(context.getString(R.string.combine), components.get(process).getName());
+		}
+		
+		previousCode = context.getString(R.string.combine);
+		isWithdrawn = false;
+		frameProcessor.processCombined(currentFrame, process, captureTimestamp, droppedFrames);
+		uiUpdateHandler.updateTextViewBRC(context.getString(R.string.combining));
+		uiUpdateHandler.updateComponentInfo(components.get(process));
+		uiUpdateHandler.updateProcessProgess(process + 1, maxProcessingNum + 1);
+	}
 }
@@ -1,5 +1,7 @@
 package de.ur.juergenhahn.ba.Handler;
 
+import de.ur.juergenhahn.ba.Auxiliary.LatencyStatistics;
+
 /**
 	\class NativeHandler
 	
@@ -8,6 +10,118 @@ package de.ur.juergenhahn.ba.Handler;
 */
 public class NativeHandler {
 	
+	/**
+		\brief private native static member function
+		
+		Creates the native processing session of a camera stream which holds all calibration data
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_createSessionNative()
+		
+		@return a long variable containing the memory address of the native session
+	*/
+	private native static long createSessionNative();
+	
+	/**
+		\brief private native static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		
+		Releases the native processing session of a camera stream
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_releaseSessionNative()
+	*/
+	private native static void releaseSessionNative(long sessionAddress);
+	
+	/**
+		\brief private native static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_latencyStatisticsNative()
+		
+		@return a double array containing the frame counters, the frame rate and the percentiles of the latency, processing time and result interval
+	*/
+	private native static double[] latencyStatisticsNative(long sessionAddress);
+	
+	/**
+		\brief private native static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_resetLatencyStatisticsNative()
+	*/
+	private native static void resetLatencyStatisticsNative(long sessionAddress);
+	
+	/**
+		\brief private native static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param budget a double variable containing the milliseconds per frame to be held, 0 to always process at full quality
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setQualityBudgetNative()
+	*/
+	private native static void setQualityBudgetNative(long sessionAddress, double budget);
+	
+	/**
+		\brief private native static member function
+		
+		@param budget a long variable containing the maximum estimated number of bytes of all models kept in memory
+		
+		Creates the native model cache which holds ready to use board models for all sessions
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_createModelCacheNative()
+		
+		@return a long variable containing the memory address of the native model cache
+	*/
+	private native static long createModelCacheNative(long budget);
+	
+	/**
+		\brief private native static member function
+		
+		@param cacheAddress a long variable containing the memory address of the native model cache
+		
+		Releases the native model cache
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_releaseModelCacheNative()
+	*/
+	private native static void releaseModelCacheNative(long cacheAddress);
+	
+	/**
+		\brief private native static member function
+		
+		@param cacheAddress a long variable containing the memory address of the native model cache
+		@param directory a String object containing the path of the directory containing the board configuration files
+		
+		Loads the board configurations of the directory in the background
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_preloadModelsNative()
+	*/
+	private native static void preloadModelsNative(long cacheAddress, String directory);
+	
+	/**
+		\brief private native static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param cacheAddress a long variable containing the memory address of the native model cache
+		@param boardId a String object containing the id of the board, the content of its QR code
+		
+		Switches the session to the model of the board and retrieves the work related meta data like calibrateNative()
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_activateModelNative()
+		
+		@return an array of array of String objects containing the work related meta data, empty if the board is unknown
+	*/
+	private native static String[][] activateModelNative(long sessionAddress, long cacheAddress, String boardId);
+	
 	/**
 		\brief private native static member function
 		
@@ -22,10 +136,71 @@ public class NativeHandler {
 		@return an array of double variables containing the color channel values and correlated color temperature
 	*/
 	private native static double[] measureImageValuesNative(long frameAdress, double[] values);
+	
+	/**
+		\brief private native static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param enabled a boolean variable containing whether the following frames build region statistics
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setRegionStatisticsNative()
+	*/
+	private native static void setRegionStatisticsNative(long sessionAddress, boolean enabled);
+	
+	/**
+		\brief private native static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param rects an array of double variables containing x, y, width and height of each region in frame coordinates
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_regionStatisticsNative()
+		
+		@return an array of double variables containing the red, green and blue mean followed by their variances for each region
+	*/
+	private native static double[] regionStatisticsNative(long sessionAddress, double[] rects);
+	
+	/**
+		\brief private native static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param enabled a boolean variable containing whether the following frames are searched for QR codes
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setCodeScanningNative()
+	*/
+	private native static void setCodeScanningNative(long sessionAddress, boolean enabled);
+	
+	/**
+		\brief private native static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param frameAddress a long variable containing the memory address of the Mat object containing the frame
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_scanCodeNative()
+		
+		@return true if a QR code was decoded, false otherwise
+	*/
+	private native static boolean scanCodeNative(long sessionAddress, long frameAddress);
+	
+	/**
+		\brief private native static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_takeCodeNative()
+		
+		@return a String object containing the QR code decoded since the last call, empty if there is none
+	*/
+	private native static String takeCodeNative(long sessionAddress);
 
 	/**
 		\brief private native static member function
 	
+		@param sessionAddress a long variable containing the memory address of the native session to be calibrated
 		@param frameAddress a long variable containing the memory address of a Mat object containing frame data
 		@param ccvWidth an int variable containing the width of a custom camera view
 		@param ccvHeight an int variable containing the width of a custom camera view
@@ -43,13 +218,16 @@ public class NativeHandler {
 		
 		@return an array of array of String objects containing the work related meta data board name, component names, occurrences per component and if the component has polarity
 	*/
-	private native static String[][] calibrateNative(long frameAddress, int ccvWidth, int ccvHeight, int srX, int srY, int srWidth, int srHeight, String filepath);
+	private native static String[][] calibrateNative(long sessionAddress, long frameAddress, int ccvWidth, int ccvHeight, int srX, int srY, int srWidth, int srHeight, String filepath);
 	
 	/**
 		\brief private native static member function
 	
+		@param sessionAddress a long variable containing the memory address of the native session
 		@param frameAddress a long variable containing the memory address of a Mat object containing frame data
 		@param componentNumber an int variable containing the number of a component to be implemented
+		@param captureTimestamp a long variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a long variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
 		
 		Processes the given frame in the implementation context
 		
@@ -59,13 +237,16 @@ public class NativeHandler {
 		@return 0 if the function was executed correctly 
 	 
 	*/
-	private native static int processImplementationNative(long frameAddress, int componentNumber);
+	private native static int processImplementationNative(long sessionAddress, long frameAddress, int componentNumber, long captureTimestamp, long droppedFrames);
 	
 	/**
 		\brief private native static member function
 	
+		@param sessionAddress a long variable containing the memory address of the native session
 		@param frameAddress a long variable containing the memory address of a Mat object containing frame data
 		@param process an int variable containing the number of the box a component is stored in
+		@param captureTimestamp a long variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a long variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
 		
 		Processes the given frame in the withdrawal context
 		
@@ -75,11 +256,260 @@ public class NativeHandler {
 		@return 0 if the function was executed correctly 
 	 
 	*/
-	private native static int processWithdrawalNative(long frameAddress, int process);
+	private native static int processWithdrawalNative(long sessionAddress, long frameAddress, int process, long captureTimestamp, long droppedFrames);
+	
+	/**
+		\brief private native static member function
+	
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param frameAddress a long variable containing the memory address of a Mat object containing frame data
+		@param componentNumber an int variable containing the number of a component to be withdrawn and implemented
+		@param captureTimestamp a long variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a long variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
+		
+		Processes the given frame in the withdrawal and implementation context together
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_processCombinedNative()
+		
+		@return 0 if the function was executed correctly 
+	 
+	*/
+	private native static int processCombinedNative(long sessionAddress, long frameAddress, int componentNumber, long captureTimestamp, long droppedFrames);
+	
+	/**
+		\brief private native static member function
+	
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param frameAddress a long variable containing the memory address of a Mat object containing frame data
+		@param componentNumbers an array of int variables containing the numbers of the components to be highlighted
+		@param states an array of int variables containing the state of each component, one of FrameProcessor.DONE, FrameProcessor.CURRENT and FrameProcessor.UPCOMING
+		@param captureTimestamp a long variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a long variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
+		
+		Processes the given frame in the implementation context for several components at once
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_processWorkOrderNative()
+		
+		@return 0 if the function was executed correctly 
+	 
+	*/
+	private native static int processWorkOrderNative(long sessionAddress, long frameAddress, int[] componentNumbers, int[] states, long captureTimestamp, long droppedFrames);
+	
+	/**
+		\brief private native static member function
+		
+		@param enabled a boolean variable containing whether the native processing stages are recorded from now on
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setTracingNative()
+	*/
+	private native static void setTracingNative(boolean enabled);
+	
+	/**
+		\brief private native static member function
+		
+		@param filepath a String object containing the path of the trace event file to be written
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_exportTraceNative()
+		
+		@return true if the file was written, false otherwise
+	*/
+	private native static boolean exportTraceNative(String filepath);
+	
+	/**
+		\brief private native static member function
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_traceSummaryNative()
+		
+		@return a String object containing the JSON summary of the duration percentiles per processing stage
+	*/
+	private native static String traceSummaryNative();
+	
+	/**
+		\brief private native static member function
+		
+		@param enabled a boolean variable containing whether the hardware performance counters of the native processing stages are recorded from now on
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setPerfCountersNative()
+	*/
+	private native static void setPerfCountersNative(boolean enabled);
+	
+	/**
+		\brief private native static member function
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_perfSummaryNative()
+		
+		@return a String object containing the JSON summary of the hardware performance counters per processing stage
+	*/
+	private native static String perfSummaryNative();
+	
+	/**
+		\brief private native static member function
+		
+		@param enabled a boolean variable containing whether the allocations of the native frames and processing stages are recorded from now on
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_setAllocationTrackingNative()
+	*/
+	private native static void setAllocationTrackingNative(boolean enabled);
+	
+	/**
+		\brief private native static member function
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_allocationSummaryNative()
+		
+		@return a String object containing the JSON summary of the allocations per frame type and processing stage
+	*/
+	private native static String allocationSummaryNative();
+	
+	/**
+		\brief private native static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session whose frames are recorded
+		@param filepath a String object containing the path of the recording to be created
+		@param nv21 a boolean variable containing whether the frames are stored as NV21 instead of RGBA
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_startRecordingNative()
+		
+		@return a boolean variable containing true if the recording was created
+	*/
+	private native static boolean startRecordingNative(long sessionAddress, String filepath, boolean nv21);
+	
+	/**
+		\brief private native static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session whose frames are recorded
+		
+		@see Native Library Documentation for further details
+		@see Java_de_ur_juergenhahn_ba_Handler_NativeHandler_stopRecordingNative()
+	*/
+	private native static void stopRecordingNative(long sessionAddress);
+		
+	/**
+		\brief public static member function
+		
+		@see createSessionNative()
+		
+		@return a long variable containing the memory address of a newly created native session
+	*/
+	public static long createSession() {
+		return createSessionNative();
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session to be released
+		
+		@see releaseSessionNative()
+	*/
+	public static void releaseSession(long sessionAddress) {
+		releaseSessionNative(sessionAddress);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		
+		Cheap enough to be called every frame, e.g. to show the frame rate and latency on screen
+		
+		@see latencyStatisticsNative()
+		
+		@return a LatencyStatistics object containing the statistics of the rolling windows of the session
+	*/
+	public static LatencyStatistics latencyStatistics(long sessionAddress) {
+		return new LatencyStatistics(latencyStatisticsNative(sessionAddress));
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		
+		@see resetLatencyStatisticsNative()
+	*/
+	public static void resetLatencyStatistics(long sessionAddress) {
+		resetLatencyStatisticsNative(sessionAddress);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param budget a double variable containing the milliseconds per frame to be held, 0 to always process at full quality
+		
+		Lowers the detection and overlay quality while the frames take longer and raises it again once there is headroom
+		
+		@see setQualityBudgetNative()
+	*/
+	public static void setQualityBudget(long sessionAddress, double budget) {
+		setQualityBudgetNative(sessionAddress, budget);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param budget a long variable containing the maximum estimated number of bytes of all models kept in memory
+		
+		@see createModelCacheNative()
+		
+		@return a long variable containing the memory address of a newly created native model cache
+	*/
+	public static long createModelCache(long budget) {
+		return createModelCacheNative(budget);
+	}
+	
+	/**
+		\brief public static member function
 		
+		@param cacheAddress a long variable containing the memory address of the native model cache to be released
+		
+		@see releaseModelCacheNative()
+	*/
+	public static void releaseModelCache(long cacheAddress) {
+		releaseModelCacheNative(cacheAddress);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param cacheAddress a long variable containing the memory address of the native model cache
+		@param directory a String object containing the path of the directory containing the board configuration files
+		
+		@see preloadModelsNative()
+	*/
+	public static void preloadModels(long cacheAddress, String directory) {
+		preloadModelsNative(cacheAddress, directory);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param cacheAddress a long variable containing the memory address of the native model cache
+		@param boardId a String object containing the id of the board, the content of its QR code
+		
+		@see activateModelNative()
+		
+		@return an array of arrays of String objects containing the work related meta data, empty if the board is unknown
+	*/
+	public static String[][] activateModel(long sessionAddress, long cacheAddress, String boardId) {
+		return activateModelNative(sessionAddress, cacheAddress, boardId);
+	}
+	
 	/**
 	 	\brief public static member function
 	
+		@param sessionAddress a long variable containing the memory address of the native session to be calibrated
 		@param frameAddress a long variable containing the memory address of a Mat object containing frame data
 		@param ccvWidth an int variable containing the width of a custom camera view
 		@param ccvHeight an int variable containing the width of a custom camera view
@@ -92,15 +522,18 @@ public class NativeHandler {
 		
 		@return an array of arrays of String objects containing the work related meta data board name, component names, occurrences per component and if the component has polarity
 	 */
-	public static String[][] configurate(long frameAddress, int ccvWidth, int ccvHeight, int srX, int srY, int srWidth, int srHeight, String filepath) {
-		return calibrateNative(frameAddress, ccvWidth, ccvHeight, srX, srY, srWidth, srHeight, filepath);
+	public static String[][] configurate(long sessionAddress, long frameAddress, int ccvWidth, int ccvHeight, int srX, int srY, int srWidth, int srHeight, String filepath) {
+		return calibrateNative(sessionAddress, frameAddress, ccvWidth, ccvHeight, srX, srY, srWidth, srHeight, filepath);
 	}
 	
 	/**
 		\brief public static member function
 	
+		@param sessionAddress a long variable containing the memory address of the native session
 		@param frameAddress a long variable containing the memory address of a Mat object containing frame data
 		@param componentNumber an int variable containing the number of the box a component is stored in
+		@param captureTimestamp a long variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a long variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
 		
 		Processes the given frame in the withdrawal context
 		
@@ -109,15 +542,18 @@ public class NativeHandler {
 		@return 0 if the function was executed correctly 
 	 
 	*/
-	public static void processWithdrawal(long frameAddress, int componentNumber) {
-		processWithdrawalNative(frameAddress, componentNumber);
+	public static void processWithdrawal(long sessionAddress, long frameAddress, int componentNumber, long captureTimestamp, long droppedFrames) {
+		processWithdrawalNative(sessionAddress, frameAddress, componentNumber, captureTimestamp, droppedFrames);
 	}
 	
 	/**
 		\brief public static member function
 	
+		@param sessionAddress a long variable containing the memory address of the native session
 		@param frameAddress a long variable containing the memory address of a Mat object containing frame data
 		@param componentNumber an int variable containing the number of the box a component is stored in
+		@param captureTimestamp a long variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a long variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
 		
 		Processes the given frame in the implementation context
 		
@@ -126,8 +562,43 @@ public class NativeHandler {
 		@return 0 if the function was executed correctly 
 	 
 	*/
-	public static void processImplementation(long frameAddress, int componentNumber) {
-		processImplementationNative(frameAddress, componentNumber);
+	public static void processImplementation(long sessionAddress, long frameAddress, int componentNumber, long captureTimestamp, long droppedFrames) {
+		processImplementationNative(sessionAddress, frameAddress, componentNumber, captureTimestamp, droppedFrames);
+	}
+	
+	/**
+		\brief public static member function
+	
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param frameAddress a long variable containing the memory address of a Mat object containing frame data
+		@param componentNumber an int variable containing the number of a component to be withdrawn and implemented
+		@param captureTimestamp a long variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a long variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
+		
+		Processes the given frame in the withdrawal and implementation context together, the storage and the board are detected from one pass
+		
+		@see processCombinedNative()
+	*/
+	public static void processCombined(long sessionAddress, long frameAddress, int componentNumber, long captureTimestamp, long droppedFrames) {
+		processCombinedNative(sessionAddress, frameAddress, componentNumber, captureTimestamp, droppedFrames);
+	}
+	
+	/**
+		\brief public static member function
+	
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param frameAddress a long variable containing the memory address of a Mat object containing frame data
+		@param componentNumbers an array of int variables containing the numbers of the components to be highlighted
+		@param states an array of int variables containing the state of each component, one of FrameProcessor.DONE, FrameProcessor.CURRENT and FrameProcessor.UPCOMING
+		@param captureTimestamp a long variable containing the System.nanoTime() the frame was captured at, 0 if unknown
+		@param droppedFrames a long variable containing the number of frames the camera overwrote right before this one was delivered, 0 if none or not counted
+		
+		Processes the given frame in the implementation context for several components at once, the board is detected and blended once for all of them
+		
+		@see processWorkOrderNative()
+	*/
+	public static void processWorkOrder(long sessionAddress, long frameAddress, int[] componentNumbers, int[] states, long captureTimestamp, long droppedFrames) {
+		processWorkOrderNative(sessionAddress, frameAddress, componentNumbers, states, captureTimestamp, droppedFrames);
 	}
 	
 	/**
@@ -145,4 +616,180 @@ public class NativeHandler {
 	public static double[] measureImageValues(long frameAdress, double[] values) {
 		return measureImageValuesNative(frameAdress, values);
 	}
+	
+	/**
+		\brief public static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param enabled a boolean variable containing whether the following frames build region statistics
+		
+		Each processed frame then keeps a summed-area table of its detection image, so any number of regions can be measured cheaply
+		
+		@see setRegionStatisticsNative()
+	*/
+	public static void setRegionStatistics(long sessionAddress, boolean enabled) {
+		setRegionStatisticsNative(sessionAddress, enabled);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param rects an array of double variables containing x, y, width and height of each region in frame coordinates
+		
+		Measures the regions on the last processed frame, the values of a region are NaN if it was not covered by the frame or no statistics were built
+		
+		@see regionStatisticsNative()
+		
+		@return an array of double variables containing the red, green and blue mean followed by their variances for each region
+	*/
+	public static double[] regionStatistics(long sessionAddress, double[] rects) {
+		return regionStatisticsNative(sessionAddress, rects);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param enabled a boolean variable containing whether the following frames are searched for QR codes
+		
+		@see setCodeScanningNative()
+	*/
+	public static void setCodeScanning(long sessionAddress, boolean enabled) {
+		setCodeScanningNative(sessionAddress, enabled);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		@param frameAddress a long variable containing the memory address of the Mat object containing a frame which is not processed by an action
+		
+		Searches the frame for a QR code if it is due, frames processed by an action are searched natively as part of the action
+		
+		@see scanCodeNative()
+		
+		@return true if a QR code was decoded, false otherwise
+	*/
+	public static boolean scanCode(long sessionAddress, long frameAddress) {
+		return scanCodeNative(sessionAddress, frameAddress);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session
+		
+		@see takeCodeNative()
+		
+		@return a String object containing the QR code decoded since the last call, empty if there is none
+	*/
+	public static String takeCode(long sessionAddress) {
+		return takeCodeNative(sessionAddress);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param enabled a boolean variable containing whether the native processing stages are recorded from now on
+		
+		@see setTracingNative()
+	*/
+	public static void setTracing(boolean enabled) {
+		setTracingNative(enabled);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param filepath a String object containing the path of the trace event file to be written
+		
+		@see exportTraceNative()
+		
+		@return true if the file was written, false otherwise
+	*/
+	public static boolean exportTrace(String filepath) {
+		return exportTraceNative(filepath);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@see traceSummaryNative()
+		
+		@return a String object containing the JSON summary of the duration percentiles per processing stage
+	*/
+	public static String traceSummary() {
+		return traceSummaryNative();
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param enabled a boolean variable containing whether the hardware performance counters of the native processing stages are recorded from now on
+		
+		@see setPerfCountersNative()
+	*/
+	public static void setPerfCounters(boolean enabled) {
+		setPerfCountersNative(enabled);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@see perfSummaryNative()
+		
+		@return a String object containing the JSON summary of cycles, instructions, cache misses, branch misses, IPC and bytes per pixel per processing stage
+	*/
+	public static String perfSummary() {
+		return perfSummaryNative();
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param enabled a boolean variable containing whether the allocations of the native frames and processing stages are recorded from now on
+		
+		@see setAllocationTrackingNative()
+	*/
+	public static void setAllocationTracking(boolean enabled) {
+		setAllocationTrackingNative(enabled);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@see allocationSummaryNative()
+		
+		@return a String object containing the JSON summary of allocations, bytes and peak of live bytes per frame type and processing stage
+	*/
+	public static String allocationSummary() {
+		return allocationSummaryNative();
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session whose frames are recorded from now on
+		@param filepath a String object containing the path of the recording to be created
+		@param nv21 a boolean variable containing whether the frames are stored as NV21, which is smaller but not replayed exactly
+		
+		@see startRecordingNative()
+		
+		@return a boolean variable containing true if the recording was created
+	*/
+	public static boolean startRecording(long sessionAddress, String filepath, boolean nv21) {
+		return startRecordingNative(sessionAddress, filepath, nv21);
+	}
+	
+	/**
+		\brief public static member function
+		
+		@param sessionAddress a long variable containing the memory address of the native session whose recording is stopped
+		
+		@see stopRecordingNative()
+	*/
+	public static void stopRecording(long sessionAddress) {
+		stopRecordingNative(sessionAddress);
+	}
 }
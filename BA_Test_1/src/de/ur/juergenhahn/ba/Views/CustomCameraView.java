@@ -1,5 +1,7 @@
 package de.ur.juergenhahn.ba.Views;
 
+import java.lang.reflect.Field;
+
 import android.content.Context;
 import android.hardware.Camera;
 import android.util.AttributeSet;
@@ -12,6 +14,21 @@ import android.view.SurfaceHolder;
 */
 public class CustomCameraView extends org.opencv.android.JavaCameraView implements SurfaceHolder.Callback {
 
+	/**
+		\brief the private field of JavaCameraView holding the index of the frame buffer the camera writes into, null if it cannot be read
+	*/
+	private static final Field CHAIN_INDEX = chainIndexField();
+
+	private final long[] bufferTimestamps = new long[2];
+	private final long[] bufferNumbers = { -1, -1 };
+	private final int[] bufferOverwrites = new int[2];
+	private final boolean[] bufferPending = new boolean[2];
+	private long frameCount = -1;
+
+	private long captureTimestamp = 0;
+	private long frameNumber = -1;
+	private int droppedFrames = 0;
+
 	/**
 	 	\brief constructor
 	 	
@@ -49,4 +66,122 @@ public class CustomCameraView extends org.opencv.android.JavaCameraView implemen
         params.setAutoExposureLock(isLocked);
         mCamera.setParameters(params);
     }
+    
+    /**
+     	\brief public member function
+		
+		@param frame a byte array containing the NV21 data of the preview frame
+		@param camera a Camera object containing the camera which delivered the frame
+		
+		Stamps and numbers the frame in the slot of the buffer JavaCameraView copies it into.
+		The camera does not report a sensor timestamp, so the arrival of the preview frame is the capture time.
+		A buffer whose previous frame was never delivered counts that frame as overwritten.
+		The lock is the one JavaCameraView swaps its buffers under, so the slot cannot change before the frame is copied
+		
+		@see deliverAndDrawFrame()
+    */
+    @Override
+    public void onPreviewFrame(byte[] frame, Camera camera) {
+    	synchronized(this) {
+    		int slot = writeSlot();
+    		
+    		if(bufferPending[slot]) {
+    			bufferOverwrites[slot]++;
+    		}
+    		
+    		bufferTimestamps[slot] = System.nanoTime();
+    		bufferNumbers[slot] = ++frameCount;
+    		bufferPending[slot] = true;
+    		
+    		super.onPreviewFrame(frame, camera);
+    	}
+    }
+    
+    /**
+     	\brief protected member function
+		
+		@param frame a CvCameraViewFrame object containing the frame which is delivered
+		
+		Takes over the stamps of the buffer which is delivered, before the listener receives the frame on this same thread.
+		JavaCameraView delivers the buffer it swapped away from, which keeps its index until the delivery returns
+		
+		@see getCaptureTimestamp()
+		@see getFrameNumber()
+		@see getDroppedFrames()
+    */
+    @Override
+    protected void deliverAndDrawFrame(CvCameraViewFrame frame) {
+    	synchronized(this) {
+    		int slot = CHAIN_INDEX == null ? 0 : 1 - writeSlot();
+    		
+    		captureTimestamp = bufferTimestamps[slot];
+    		frameNumber = bufferNumbers[slot];
+    		droppedFrames = bufferOverwrites[slot];
+    		bufferOverwrites[slot] = 0;
+    		bufferPending[slot] = false;
+    	}
+    	
+    	super.deliverAndDrawFrame(frame);
+    }
+    
+    /**
+     	\brief public member function
+		
+		@return a long containing the System.nanoTime() the delivered frame arrived at, 0 before the first one
+    */
+    public long getCaptureTimestamp() {
+    	return captureTimestamp;
+    }
+    
+    /**
+     	\brief public member function
+		
+		@return a long containing the number of the delivered frame, -1 before the first one
+    */
+    public long getFrameNumber() {
+    	return frameNumber;
+    }
+    
+    /**
+     	\brief public member function
+		
+		@return an int containing the number of frames overwritten in the buffer of the delivered frame before it was delivered
+    */
+    public int getDroppedFrames() {
+    	return droppedFrames;
+    }
+    
+    /**
+     	\brief private member function
+		
+		@return an int containing the index of the frame buffer the camera writes into, 0 if it cannot be read
+    */
+    private int writeSlot() {
+    	if(CHAIN_INDEX == null) {
+    		return 0;
+    	}
+    	
+    	try {
+    		return CHAIN_INDEX.getInt(this);
+    	} catch (IllegalAccessException e) {
+    		return 0;
+    	}
+    }
+    
+    /**
+     	\brief private static function
+		
+		@return a Field object giving access to the buffer index of JavaCameraView, null if the OpenCV version does not have it
+    */
+    private static Field chainIndexField() {
+    	try {
+    		Field field = org.opencv.android.JavaCameraView.class.getDeclaredField("mChainIdx");
+    		field.setAccessible(true);
+    		return field;
+    	} catch (NoSuchFieldException e) {
+    		return null;
+    	} catch (SecurityException e) {
+    		return null;
+    	}
+    }
 }